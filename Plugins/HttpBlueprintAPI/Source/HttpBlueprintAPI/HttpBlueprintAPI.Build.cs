@@ -13,9 +13,18 @@ public class HttpBlueprintAPI : ModuleRules
             "Engine",
             "HTTP",
             "Json",
-            "JsonUtilities"
+            "JsonUtilities",
+            "DeveloperSettings"
         });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        PrivateDependencyModuleNames.AddRange(new string[]
+        {
+            // Metrics export: Prometheus scrape endpoint and StatsD datagrams
+            "HTTPServer",
+            "Sockets"
+        });
+
+        // Response pipeline decompression (gzip and zlib bodies of unknown size)
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
     }
 }
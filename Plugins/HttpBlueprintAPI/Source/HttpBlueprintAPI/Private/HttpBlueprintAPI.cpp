@@ -1,18 +1,60 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpRequestLogger.h"
+#include "HttpRequestTracer.h"
+#include "HttpMetricsExporter.h"
+#include "HttpTrafficArchive.h"
+#include "HttpCallbackDispatcher.h"
+#include "HttpPrefetcher.h"
+#include "HttpProtobufCodec.h"
+#include "HttpRequestProfiler.h"
+#include "HttpStructDeserializer.h"
+
+DEFINE_LOG_CATEGORY(LogHttpBlueprintAPI);
 
 #define LOCTEXT_NAMESPACE "FHttpBlueprintAPIModule"
 
 void FHttpBlueprintAPIModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FHttpBlueprintRuntimeSettings::Initialize();
+
+#if !UE_BUILD_SHIPPING
+	// Install the allocation counter of the benchmarks and perf tests once, before any request is measured
+	FHttpAllocationCounter::Startup();
+#endif
+
+	// Register the callback dispatcher's ticker on the game thread before any request completes
+	FHttpCallbackDispatcher::Get();
+
+	// Register the metrics export ticker
+	FHttpMetricsExporter::Get();
+
+	// Register the prefetch ticker and the memory trim handler
+	FHttpPrefetcher::Get();
+
+	// Drop compiled field tables and protobuf schemas of reinstanced or collected structs
+	FHttpStructDeserializer::Startup();
+	FHttpProtobufCodec::Startup();
 }
 
 void FHttpBlueprintAPIModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHttpPrefetcher::Get().Shutdown();
+	FHttpCallbackDispatcher::Get().Shutdown();
+	// The only place that waits for the HAR writer: the file must be complete before the module goes away
+	FHttpTrafficArchive::Get().StopCapture();
+	FHttpTrafficArchive::Get().WaitForWriter();
+	FHttpRequestTracer::Get().StopExport();
+	FHttpMetricsExporter::Get().Shutdown();
+	FHttpRequestLogger::Get().Shutdown();
+	FHttpStructDeserializer::Shutdown();
+	FHttpProtobufCodec::Shutdown();
+	FHttpBlueprintRuntimeSettings::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -1,12 +1,98 @@
 #include "HttpBlueprintFunctionLibrary.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpRequestLogger.h"
+#include "HttpRequestTracer.h"
+#include "HttpMetricsExporter.h"
+#include "HttpTrafficMonitor.h"
+#include "HttpCallSites.h"
+#include "HttpResponseCache.h"
+#include "HttpPrefetcher.h"
+#include "HttpTrafficArchive.h"
+#include "HttpFixtureStore.h"
+#include "HttpFaultInjection.h"
+#include "HttpCallbackDispatcher.h"
+#include "HttpResponsePipeline.h"
+#include "HttpJsonStreamReader.h"
+#include "HttpJsonFieldExtractor.h"
+#include "HttpPayloadCodec.h"
+#include "HttpStatusCodes.h"
+#include "HttpMemoryTracker.h"
+#include "HttpRequestProfiler.h"
+#include "HttpBlueprintStats.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Misc/DateTime.h"
+#include "Tasks/Task.h"
+#include "Containers/Ticker.h"
 
-// Define logging category
-DEFINE_LOG_CATEGORY_STATIC(LogHttpBlueprintAPI, Log, All);
+// =============================================================================
+// RESPONSE DATA AND CALLBACK
+// =============================================================================
+
+FString FHttpResponseData::GetErrorMessage() const
+{
+    if (!ErrorMessage.IsEmpty())
+    {
+        return ErrorMessage;
+    }
+    return FormatErrorMessage(ErrorKind, ResponseCode, ErrorValue, ErrorLimit);
+}
+
+void FHttpResponseData::SetError(EHttpErrorKind Kind, int64 Value, int64 Limit)
+{
+    bWasSuccessful = false;
+    ErrorKind = Kind;
+    ErrorValue = Value;
+    ErrorLimit = Limit;
+}
+
+FString FHttpResponseData::FormatErrorMessage(EHttpErrorKind Kind, int32 ResponseCode, int64 Value, int64 Limit)
+{
+    switch (Kind)
+    {
+    case EHttpErrorKind::None:                  return FString();
+    case EHttpErrorKind::InvalidRequest:        return TEXT("Invalid HTTP request");
+    case EHttpErrorKind::ConnectionFailed:      return TEXT("Network error: Could not connect to the server");
+    case EHttpErrorKind::Timeout:
+        return FString::Printf(TEXT("Network error: Request timed out after %.1fs (timeout %.1fs)"), Value / 1000.0, Limit / 1000.0);
+    case EHttpErrorKind::Cancelled:             return TEXT("Request was cancelled");
+    case EHttpErrorKind::NetworkError:          return TEXT("Network error: Request failed to complete");
+    case EHttpErrorKind::HttpClientError:
+    case EHttpErrorKind::HttpServerError:
+    case EHttpErrorKind::HttpUnexpectedStatus:  return FHttpStatusCodes::FormatError(ResponseCode);
+    case EHttpErrorKind::BodyTooLarge:
+        return FString::Printf(TEXT("Response body is %lld bytes, limit is %lld"), Value, Limit);
+    case EHttpErrorKind::DecodeError:           return TEXT("Response body could not be decoded");
+    case EHttpErrorKind::PipelineStageFailed:   return TEXT("Response pipeline stage failed");
+    case EHttpErrorKind::FixtureMissing:        return TEXT("No HTTP fixture recorded for the request");
+    }
+    return FString();
+}
+
+void FHttpResponseCallback::Execute(const FHttpResponseData& ResponseData) const
+{
+    if (NativeDelegate.IsBound())
+    {
+        NativeDelegate.Execute(ResponseData);
+    }
+    else if (BlueprintDelegate.IsBound())
+    {
+        BlueprintDelegate.ExecuteIfBound(
+            ResponseData.bWasSuccessful,
+            ResponseData.ResponseCode,
+            ResponseData.ResponseBody,
+            ResponseData.GetErrorMessage()
+        );
+    }
+    else
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HTTP response received but no callback delegate was bound"));
+    }
+}
 
 // =============================================================================
 // PUBLIC HTTP REQUEST FUNCTIONS
@@ -19,7 +105,7 @@ void UHttpBlueprintFunctionLibrary::MakeHttpGetRequest(
 {
     // Use the generic request function with GET method and no body
     TMap<FString, FString> DefaultHeaders;
-    DefaultHeaders.Add(TEXT("Content-Type"), TEXT("application/json"));
+    DefaultHeaders.Add(TEXT("Content-Type"), FHttpBlueprintRuntimeSettings::Get().DefaultContentType);
 
     MakeHttpRequestWithHeaders(
         URL,
@@ -40,7 +126,7 @@ void UHttpBlueprintFunctionLibrary::MakeHttpPostRequest(
 {
     // Set up headers with the specified content type
     TMap<FString, FString> Headers;
-    Headers.Add(TEXT("Content-Type"), ContentType.IsEmpty() ? TEXT("application/json") : ContentType);
+    Headers.Add(TEXT("Content-Type"), ContentType.IsEmpty() ? FHttpBlueprintRuntimeSettings::Get().DefaultContentType : ContentType);
 
     MakeHttpRequestWithHeaders(
         URL,
@@ -60,81 +146,292 @@ void UHttpBlueprintFunctionLibrary::MakeHttpRequestWithHeaders(
     const FOnHttpResponseReceived& OnResponseReceived,
     UObject* WorldContextObject)
 {
-    // Validate input parameters
-    FString ErrorMessage;
-    if (!ValidateHttpRequest(URL, Method, ErrorMessage))
-    {
-        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("HTTP Request validation failed: %s"), *ErrorMessage);
+    MakeHttpRequestWithOptions(
+        URL,
+        Method,
+        RequestBody,
+        Headers,
+        FHttpRequestOptions(),
+        OnResponseReceived,
+        WorldContextObject
+    );
+}
 
-        // Call delegate immediately with error
-        if (OnResponseReceived.IsBound())
+void UHttpBlueprintFunctionLibrary::MakeHttpRequestWithOptions(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FOnHttpResponseReceived& OnResponseReceived,
+    UObject* WorldContextObject)
+{
+    StartHttpRequest(URL, Method, RequestBody, Headers, Options, FHttpResponseCallback(OnResponseReceived), WorldContextObject);
+}
+
+void UHttpBlueprintFunctionLibrary::MakeHttpRequestWithResponse(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FOnHttpResponseDataReceived& OnResponse,
+    UObject* WorldContextObject)
+{
+    // Blueprint delegates may only run on the game thread, whatever Options asks for
+    FHttpRequestOptions GameThreadOptions = Options;
+    GameThreadOptions.CompletionThread = EHttpCompletionThread::GameThread;
+
+    StartHttpRequest(URL, Method, RequestBody, Headers, GameThreadOptions, FHttpResponseCallback(FOnHttpResponseNative::CreateLambda(
+        [OnResponse](const FHttpResponseData& Response)
         {
-            // Execute on game thread to ensure Blueprint safety
-            AsyncTask(ENamedThreads::GameThread, [OnResponseReceived, ErrorMessage]()
+            OnResponse.ExecuteIfBound(Response);
+        })), WorldContextObject);
+}
+
+void UHttpBlueprintFunctionLibrary::MakeHttpRequestAndExtractFields(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const TArray<FString>& Paths,
+    const FOnHttpFieldsReceived& OnFieldsReceived,
+    UObject* WorldContextObject)
+{
+    FHttpRequestOptions Options;
+    Options.ExtractFields = Paths;
+
+    // The native callback still completes on the game thread (Options.CompletionThread)
+    StartHttpRequest(URL, Method, RequestBody, Headers, Options, FHttpResponseCallback(FOnHttpResponseNative::CreateLambda(
+        [OnFieldsReceived, NumPaths = Paths.Num()](const FHttpResponseData& Response)
+        {
+            const bool bAllFound = Response.ExtractedFields.Num() == NumPaths;
+            OnFieldsReceived.ExecuteIfBound(
+                Response.bWasSuccessful && bAllFound,
+                Response.ResponseCode,
+                Response.ExtractedFields,
+                Response.bWasSuccessful && !bAllFound ? FString(TEXT("Not every JSON field was found in the response")) : Response.GetErrorMessage()
+            );
+        })), WorldContextObject);
+}
+
+void UHttpBlueprintFunctionLibrary::MakeHttpRequestNative(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FOnHttpResponseNative& OnResponse)
+{
+    StartHttpRequest(URL, Method, RequestBody, Headers, Options, FHttpResponseCallback(OnResponse));
+}
+
+void UHttpBlueprintFunctionLibrary::MakeStreamingJsonRequest(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FString& ArrayField,
+    int32 BatchSize,
+    const FOnHttpJsonElementsReceived& OnElementsReceived,
+    const FOnHttpResponseReceived& OnResponseReceived,
+    UObject* WorldContextObject)
+{
+    FHttpRequestOptions Options;
+    const EHttpCallbackPriority Priority = Options.CallbackPriority;
+
+    // Elements are converted to strings on the HTTP thread; only the delegate call reaches the game thread
+    Options.JsonStream = MakeShared<FHttpJsonStreamReader>(
+        ArrayField,
+        BatchSize > 0 ? BatchSize : FHttpBlueprintRuntimeSettings::Get().StreamBatchSize,
+        [OnElementsReceived, Priority](FHttpJsonElementBatch&& Batch)
+        {
+            TArray<FString> Elements;
+            Elements.Reserve(Batch.Num());
+            for (int32 Index = 0; Index < Batch.Num(); ++Index)
+            {
+                Elements.Add(Batch.GetElementString(Index));
+            }
+
+            FHttpCallbackDispatcher::Get().Enqueue(Priority,
+                [OnElementsReceived, Elements = MoveTemp(Elements), FirstIndex = Batch.FirstIndex]()
                 {
-                    OnResponseReceived.ExecuteIfBound(
-                        false,          // bWasSuccessful
-                        0,              // ResponseCode
-                        TEXT(""),       // ResponseBody
-                        ErrorMessage    // ErrorMessage
-                    );
+                    OnElementsReceived.ExecuteIfBound(Elements, FirstIndex);
                 });
-        }
-        return;
-    }
+        });
 
-    // Check if HTTP module is available
-    FHttpModule* Http = &FHttpModule::Get();
-    if (!Http)
-    {
-        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("HTTP module not available"));
+    StartHttpRequest(URL, Method, RequestBody, Headers, Options, FHttpResponseCallback(OnResponseReceived), WorldContextObject);
+}
 
-        if (OnResponseReceived.IsBound())
+void UHttpBlueprintFunctionLibrary::MakeStreamingJsonRequestNative(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FString& ArrayField,
+    int32 BatchSize,
+    const FOnHttpJsonBatchNative& OnBatch,
+    const FOnHttpResponseNative& OnResponse)
+{
+    // Batches are dispatched like the completion callback, so on the game thread they always arrive before it
+    FHttpRequestOptions StreamOptions = Options;
+    StreamOptions.JsonStream = MakeShared<FHttpJsonStreamReader>(
+        ArrayField,
+        BatchSize > 0 ? BatchSize : FHttpBlueprintRuntimeSettings::Get().StreamBatchSize,
+        [OnBatch, Options](FHttpJsonElementBatch&& Batch)
         {
-            AsyncTask(ENamedThreads::GameThread, [OnResponseReceived]()
+            FHttpCallbackDispatcher::Get().Dispatch(Options, false, [OnBatch, Batch = MoveTemp(Batch)]()
                 {
-                    OnResponseReceived.ExecuteIfBound(
-                        false, 0, TEXT(""), TEXT("HTTP module not available")
-                    );
+                    OnBatch.ExecuteIfBound(Batch);
                 });
+        });
+
+    StartHttpRequest(URL, Method, RequestBody, Headers, StreamOptions, FHttpResponseCallback(OnResponse));
+}
+
+void UHttpBlueprintFunctionLibrary::MakeSignedHttpRequest(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpSigningConfig& SigningConfig,
+    const FOnHttpResponseReceived& OnResponseReceived,
+    UObject* WorldContextObject)
+{
+    const FHttpRequestOptions Options;
+    const FHttpResponseCallback Callback(OnResponseReceived);
+
+    FHttpResponseData ErrorResponse;
+    if (!ValidateHttpRequest(URL, Method, ErrorResponse.ErrorMessage))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("HTTP Request validation failed: %s"), *ErrorResponse.ErrorMessage);
+        ErrorResponse.SetError(EHttpErrorKind::InvalidRequest);
+
+        if (Callback.IsBound())
+        {
+            DeliverResponse(ErrorResponse, Callback, Options);
         }
         return;
     }
 
-    // Create and configure the HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest(URL, Method, RequestBody, Headers);
+    // One snapshot for the whole request; published snapshots outlive any request that holds one
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
 
-    // Set up the completion callback
-    // This is the key part - when the request completes, our internal callback will be called,
-    // which will then call the user's Blueprint delegate
-    Request->OnProcessRequestComplete().BindStatic(
-        &UHttpBlueprintFunctionLibrary::OnHttpRequestComplete,
-        OnResponseReceived
-    );
+    const uint32 RequestId = FHttpRequestLogger::NextRequestId();
+    const uint32 CallSiteId = FHttpCallSites::Capture(WorldContextObject);
+    if (TryServeRecordedResponse(URL, Method, RequestBody, Callback, Options, Settings, RequestId, CallSiteId))
+    {
+        return;
+    }
 
-    // Log the request details
-    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Starting HTTP %s request to: %s"), *Method, *URL);
-    if (!RequestBody.IsEmpty())
+    // Fail the request locally when fault injection decides to drop it or return a synthetic error
+    if (TryInjectRequestFault(URL, Method, RequestBody, Headers, Callback, Options, Settings, RequestId, CallSiteId))
     {
-        UE_LOG(LogHttpBlueprintAPI, Verbose, TEXT("Request body: %s"), *RequestBody);
+        return;
     }
 
-    // Start the HTTP request
-    bool bRequestStarted = Request->ProcessRequest();
-    if (!bRequestStarted)
+    // Create the request on the game thread, but leave the body empty if it will be streamed from file
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest(
+        URL, Method, SigningConfig.BodyFilePath.IsEmpty() ? RequestBody : FString(), Headers, Settings);
+
+    if (!SigningConfig.BodyFilePath.IsEmpty())
     {
-        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Failed to start HTTP request"));
+        Request->SetContentAsStreamedFile(SigningConfig.BodyFilePath);
+    }
+
+    Request->OnProcessRequestComplete().BindStatic(
+        &UHttpBlueprintFunctionLibrary::OnHttpRequestComplete,
+        Callback,
+        RequestId,
+        CallSiteId,
+        Options
+    );
 
-        if (OnResponseReceived.IsBound())
+    // Hash the body and compute the signature on a worker thread, then start the request from there
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [Request, SigningConfig, Callback, Options, &Settings, RequestId, CallSiteId, Method, URL, RequestBody]()
         {
-            AsyncTask(ENamedThreads::GameThread, [OnResponseReceived]()
+            FHttpResponseData FailedResponse;
+            if (!FHttpRequestSigner::SignRequest(Request, SigningConfig, FailedResponse.ErrorMessage))
+            {
+                // Never sent, so it is not counted anywhere; the completion delegate will not run
+                UE_LOG(LogHttpBlueprintAPI, Error, TEXT("%s"), *FailedResponse.ErrorMessage);
+                FailedResponse.SetError(EHttpErrorKind::InvalidRequest);
+
+                if (Callback.IsBound())
                 {
-                    OnResponseReceived.ExecuteIfBound(
-                        false, 0, TEXT(""), TEXT("Failed to start HTTP request")
-                    );
-                });
+                    DeliverResponse(FailedResponse, Callback, Options);
+                }
+                return;
+            }
+
+            // Recorded once signed; the caller was already captured on the game thread
+            FHttpRequestLogger::Get().LogRequestStarted(Settings, RequestId, Method, URL, RequestBody, CallSiteId);
+            FHttpTrafficMonitor::Get().RecordStarted(RequestId, Method, URL, RequestBody.Len(), EHttpTrafficSource::Network, CallSiteId);
+            BindTrafficMonitor(Request, RequestId);
+            FHttpCallSites::RecordRequest(CallSiteId, RequestBody.Len());
+            if (FHttpFixtureStore::IsRecording(Settings))
+            {
+                FHttpFixtureStore::Get().BeginExchange(RequestId, Method, URL, RequestBody);
+            }
+
+            if (!ProcessTrackedRequest(Request))
+            {
+                UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Failed to start HTTP request"));
+            }
+        });
+}
+
+// =============================================================================
+// PREFETCH AND CACHE
+// =============================================================================
+
+int32 UHttpBlueprintFunctionLibrary::PrefetchHttpUrls(const TArray<FString>& URLs)
+{
+    TArray<FString> ValidURLs;
+    ValidURLs.Reserve(URLs.Num());
+    for (const FString& URL : URLs)
+    {
+        if (IsValidURL(URL))
+        {
+            ValidURLs.Add(URL);
+        }
+        else
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Not prefetching invalid URL: %s"), *URL);
         }
     }
+
+    return FHttpPrefetcher::Get().Enqueue(ValidURLs);
+}
+
+int32 UHttpBlueprintFunctionLibrary::PrefetchHttpRoute(const FString& RouteTemplate, const FString& Parameter, const TArray<FString>& Values)
+{
+    const FString Placeholder = FString::Printf(TEXT("{%s}"), *Parameter);
+    if (!RouteTemplate.Contains(Placeholder))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Route %s has no %s placeholder"), *RouteTemplate, *Placeholder);
+        return 0;
+    }
+
+    TArray<FString> URLs;
+    URLs.Reserve(Values.Num());
+    for (const FString& Value : Values)
+    {
+        URLs.Add(RouteTemplate.Replace(*Placeholder, *FGenericPlatformHttp::UrlEncode(Value), ESearchCase::CaseSensitive));
+    }
+
+    return PrefetchHttpUrls(URLs);
+}
+
+void UHttpBlueprintFunctionLibrary::CancelHttpPrefetches()
+{
+    FHttpPrefetcher::Get().CancelAll();
+}
+
+void UHttpBlueprintFunctionLibrary::ClearHttpResponseCache()
+{
+    FHttpResponseCache::Get().Clear();
 }
 
 // =============================================================================
@@ -149,43 +446,67 @@ bool UHttpBlueprintFunctionLibrary::IsHttpResponseSuccessful(int32 ResponseCode)
 
 FString UHttpBlueprintFunctionLibrary::GetHttpResponseCodeDescription(int32 ResponseCode)
 {
-    // Return human-readable descriptions for common HTTP status codes
-    switch (ResponseCode)
+    // Registered codes come from the static IANA table; only unknown codes need formatting
+    const FStringView Reason = FHttpStatusCodes::GetReasonPhrase(ResponseCode);
+    if (Reason.IsEmpty())
     {
-        // 2xx Success
-    case 200: return TEXT("OK");
-    case 201: return TEXT("Created");
-    case 202: return TEXT("Accepted");
-    case 204: return TEXT("No Content");
+        return FString::Printf(TEXT("HTTP %d"), ResponseCode);
+    }
+    return FString(Reason);
+}
 
-        // 3xx Redirection
-    case 301: return TEXT("Moved Permanently");
-    case 302: return TEXT("Found");
-    case 304: return TEXT("Not Modified");
+FText UHttpBlueprintFunctionLibrary::GetHttpResponseCodeText(int32 ResponseCode)
+{
+    return FHttpStatusCodes::GetDescription(ResponseCode);
+}
 
-        // 4xx Client Error
-    case 400: return TEXT("Bad Request");
-    case 401: return TEXT("Unauthorized");
-    case 403: return TEXT("Forbidden");
-    case 404: return TEXT("Not Found");
-    case 405: return TEXT("Method Not Allowed");
-    case 408: return TEXT("Request Timeout");
-    case 409: return TEXT("Conflict");
-    case 422: return TEXT("Unprocessable Entity");
-    case 429: return TEXT("Too Many Requests");
+FName UHttpBlueprintFunctionLibrary::GetHttpResponseCodeName(int32 ResponseCode)
+{
+    return FHttpStatusCodes::GetReasonName(ResponseCode);
+}
 
-        // 5xx Server Error
-    case 500: return TEXT("Internal Server Error");
-    case 501: return TEXT("Not Implemented");
-    case 502: return TEXT("Bad Gateway");
-    case 503: return TEXT("Service Unavailable");
-    case 504: return TEXT("Gateway Timeout");
+EHttpErrorKind UHttpBlueprintFunctionLibrary::GetHttpErrorKindForStatus(int32 ResponseCode)
+{
+    if (IsHttpResponseSuccessful(ResponseCode))
+    {
+        return EHttpErrorKind::None;
+    }
+    if (ResponseCode >= 400 && ResponseCode < 500)
+    {
+        return EHttpErrorKind::HttpClientError;
+    }
+    if (ResponseCode >= 500 && ResponseCode < 600)
+    {
+        return EHttpErrorKind::HttpServerError;
+    }
+    return EHttpErrorKind::HttpUnexpectedStatus;
+}
+
+bool UHttpBlueprintFunctionLibrary::IsHttpErrorRetryable(const FHttpResponseData& Response)
+{
+    switch (Response.ErrorKind)
+    {
+    case EHttpErrorKind::ConnectionFailed:
+    case EHttpErrorKind::Timeout:
+    case EHttpErrorKind::NetworkError:
+        return true;
 
-        // Default case
-    default: return FString::Printf(TEXT("HTTP %d"), ResponseCode);
+    case EHttpErrorKind::HttpClientError:
+        return Response.ResponseCode == 408 || Response.ResponseCode == 429;
+
+    case EHttpErrorKind::HttpServerError:
+        return Response.ResponseCode != 501 && Response.ResponseCode != 505;
+
+    default:
+        return false;
     }
 }
 
+FString UHttpBlueprintFunctionLibrary::GetHttpErrorMessage(const FHttpResponseData& Response)
+{
+    return Response.GetErrorMessage();
+}
+
 FString UHttpBlueprintFunctionLibrary::GetDomainFromURL(const FString& URL)
 {
     FString Domain = URL;
@@ -259,47 +580,676 @@ bool UHttpBlueprintFunctionLibrary::IsValidURL(const FString& URL)
     return true;
 }
 
+bool UHttpBlueprintFunctionLibrary::ExtractJsonFields(const FString& Json, const TArray<FString>& Paths, TMap<FString, FString>& OutValues)
+{
+    OutValues.Reset();
+
+    const FHttpJsonFieldExtractor Extractor(Paths);
+    if (!Extractor.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("%s"), *Extractor.GetError());
+        return false;
+    }
+
+    FTCHARToUTF8 Utf8Json(*Json);
+    return Extractor.Extract(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8Json.Get()), Utf8Json.Length()), OutValues);
+}
+
 // =============================================================================
 // PRIVATE HELPER FUNCTIONS
 // =============================================================================
 
+void UHttpBlueprintFunctionLibrary::BindTrafficMonitor(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+    uint32 RequestId)
+{
+    // Only requests sent while the inspector is open pay for the extra delegate
+    if (FHttpTrafficMonitor::Get().IsEnabled())
+    {
+        Request->OnStatusCodeReceived().BindLambda([RequestId](FHttpRequestPtr, int32)
+            {
+                FHttpTrafficMonitor::Get().Record(RequestId, EHttpTrafficEventType::ResponseStarted);
+            });
+    }
+}
+
+FHttpRequestPtr UHttpBlueprintFunctionLibrary::StartHttpRequest(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FHttpResponseCallback& Callback,
+    const UObject* WorldContextObject)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+    SCOPE_CYCLE_COUNTER(STAT_HttpStartRequest);
+    FHttpOverheadScope OverheadScope(EHttpOverheadPhase::Start);
+
+    // Validate input parameters
+    FHttpResponseData ErrorResponse;
+    if (!ValidateHttpRequest(URL, Method, ErrorResponse.ErrorMessage))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("HTTP Request validation failed: %s"), *ErrorResponse.ErrorMessage);
+        ErrorResponse.SetError(EHttpErrorKind::InvalidRequest);
+
+        // Call delegate immediately with error
+        if (Callback.IsBound())
+        {
+            DeliverResponse(ErrorResponse, Callback, Options);
+        }
+        return nullptr;
+    }
+
+    // Check if HTTP module is available
+    FHttpModule* Http = &FHttpModule::Get();
+    if (!Http)
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("HTTP module not available"));
+
+        if (Callback.IsBound())
+        {
+            ErrorResponse.ErrorMessage = TEXT("HTTP module not available");
+            ErrorResponse.SetError(EHttpErrorKind::NetworkError);
+            DeliverResponse(ErrorResponse, Callback, Options);
+        }
+        return nullptr;
+    }
+
+    // One snapshot for the whole request; published snapshots outlive any request that holds one
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+
+    // Answer from recorded traffic instead of the network when a replay is active
+    const uint32 RequestId = FHttpRequestLogger::NextRequestId();
+
+    // Attribute the request to the calling Blueprint (interned; the id travels with the request)
+    const uint32 CallSiteId = FHttpCallSites::Capture(WorldContextObject);
+
+    if (TryServeRecordedResponse(URL, Method, RequestBody, Callback, Options, Settings, RequestId, CallSiteId))
+    {
+        return nullptr;
+    }
+
+    // Answer opted-in GETs from the response cache (prefetched, or stale under a stale-while-revalidate policy)
+    if (TryServeCachedResponse(URL, Method, Headers, Callback, Options, Settings, RequestId, CallSiteId))
+    {
+        return nullptr;
+    }
+
+    // Fail the request locally when fault injection decides to drop it or return a synthetic error
+    if (TryInjectRequestFault(URL, Method, RequestBody, Headers, Callback, Options, Settings, RequestId, CallSiteId))
+    {
+        return nullptr;
+    }
+
+    // Create and configure the HTTP request
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest(URL, Method, RequestBody, Headers, Settings, Options.PayloadFormat, Options.RequestSchema);
+
+    // Hand the body to the JSON reader chunk by chunk instead of buffering it in the response
+    if (Options.JsonStream.IsValid())
+    {
+        Request->SetResponseBodyReceiveStream(FHttpJsonStreamReader::CreateReceiveArchive(Options.JsonStream.ToSharedRef()));
+    }
+
+    // Native consumers that do not need the game thread get the whole completion path off it
+    if (!Callback.RequiresGameThread() && Options.CompletionThread != EHttpCompletionThread::GameThread)
+    {
+        Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+    }
+
+    // Set up the completion callback
+    // This is the key part - when the request completes, our internal callback will be called,
+    // which will then call the user's delegate
+    Request->OnProcessRequestComplete().BindStatic(
+        &UHttpBlueprintFunctionLibrary::OnHttpRequestComplete,
+        Callback,
+        RequestId,
+        CallSiteId,
+        Options
+    );
+
+    // Log the request details (sampled, formatted on the logging thread)
+    FHttpRequestLogger::Get().LogRequestStarted(Settings, RequestId, Method, URL, RequestBody, CallSiteId);
+    FHttpTrafficMonitor::Get().RecordStarted(RequestId, Method, URL, Request->GetContent().Num(), EHttpTrafficSource::Network, CallSiteId);
+    BindTrafficMonitor(Request, RequestId);
+    FHttpCallSites::RecordRequest(CallSiteId, Request->GetContent().Num());
+
+    // Key a recorded fixture by the caller's body, as replay does, not by the encoded bytes sent
+    if (FHttpFixtureStore::IsRecording(Settings))
+    {
+        FHttpFixtureStore::Get().BeginExchange(RequestId, Method, URL, RequestBody);
+    }
+
+    // Start the HTTP request; a failed start is delivered by OnHttpRequestComplete
+    if (!ProcessTrackedRequest(Request))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Failed to start HTTP request"));
+    }
+    return Request;
+}
+
+bool UHttpBlueprintFunctionLibrary::ProcessTrackedRequest(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+{
+    // Counted until OnHttpRequestComplete, which also runs for requests that fail to start
+    FHttpMemoryTracker::AddRequestsInFlight(1);
+    FHttpMemoryTracker::AddBodyBytes(Request->GetContent().Num());
+
+    return Request->ProcessRequest();
+}
+
 void UHttpBlueprintFunctionLibrary::OnHttpRequestComplete(
     FHttpRequestPtr Request,
     FHttpResponsePtr Response,
     bool bWasSuccessful,
-    FOnHttpResponseReceived UserCallback)
+    FHttpResponseCallback Callback,
+    uint32 RequestId,
+    uint32 CallSiteId,
+    FHttpRequestOptions Options)
 {
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+    SCOPE_CYCLE_COUNTER(STAT_HttpCompleteRequest);
+    FHttpOverheadScope OverheadScope(EHttpOverheadPhase::Completion);
+
+    FHttpMemoryTracker::AddRequestsInFlight(-1);
+    FHttpMemoryTracker::AddBodyBytes(Request.IsValid() ? -(int64)Request->GetContent().Num() : 0);
+
     // Process the HTTP response into our Blueprint-friendly format
     FHttpResponseData ResponseData = ProcessHttpResponse(Request, Response, bWasSuccessful);
 
-    // Log the response details
-    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HTTP request completed. Success: %s, Code: %d"),
-        ResponseData.bWasSuccessful ? TEXT("true") : TEXT("false"),
-        ResponseData.ResponseCode);
+    // The processed copy and the raw body stay charged until they are handed to the callback
+    FHttpResponseMemoryCharge MemoryCharge(ResponseData, Response.IsValid() ? Response->GetContent().Num() : 0);
+
+    // MessagePack/CBOR/Protobuf bodies are turned into JSON text on a worker below, unless a pipeline decodes them
+    const EHttpPayloadFormat BodyFormat = FHttpPayloadCodec::GetResponseFormat(ResponseData);
+    const bool bTranscodeBody = BodyFormat != EHttpPayloadFormat::Json && !Options.Pipeline.IsValid() && Response.IsValid();
+
+    // Flush the last streamed batch before the completion callback is queued behind it
+    if (Options.JsonStream.IsValid())
+    {
+        Options.JsonStream->Finish();
+        if (ResponseData.bWasSuccessful && Options.JsonStream->HasError())
+        {
+            ResponseData.SetError(EHttpErrorKind::DecodeError);
+            ResponseData.ErrorMessage = Options.JsonStream->GetError();
+        }
+    }
+
+    // Log the response details (sampled, formatted on the logging thread)
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+    FHttpRequestLogger::Get().LogRequestCompleted(
+        Settings,
+        RequestId,
+        Request.IsValid() ? Request->GetURL() : FString(),
+        ResponseData,
+        Response.IsValid() ? Response->GetContent().Num() : 0
+    );
+
+    // Export the client span of sampled traced requests
+    FHttpRequestTracer::Get().RecordSpan(Request, ResponseData);
 
-    if (!ResponseData.bWasSuccessful)
+    // Count the request for Prometheus/StatsD export
+    FHttpMetrics::RecordRequest(ResponseData, Response.IsValid() ? Response->GetContent().Num() : 0);
+    FHttpTrafficMonitor::Get().RecordCompleted(RequestId, ResponseData, Response.IsValid() ? Response->GetContent().Num() : 0);
+    FHttpCallSites::RecordResponse(CallSiteId, Response.IsValid() ? Response->GetContent().Num() : 0, !ResponseData.bWasSuccessful);
+
+    // Record the exchange when HAR capture is running
+    if (FHttpTrafficArchive::Get().IsCapturing())
     {
-        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HTTP request failed: %s"), *ResponseData.ErrorMessage);
+        FHttpTrafficArchive::Get().CaptureExchange(Settings, Request, Response, ResponseData.ResponseTimeSeconds);
     }
 
-    // CRITICAL: Execute the Blueprint delegate on the Game Thread
-    // HTTP callbacks happen on background threads, but Blueprint code must run on the main thread
-    AsyncTask(ENamedThreads::GameThread, [UserCallback, ResponseData]()
+    // Save the response as a test fixture if it was sent while recording
+    FHttpFixtureStore::Get().RecordExchange(Settings, RequestId, Request, Response, ResponseData);
+
+    // Keep the response as received for later stale hits, before injected faults degrade this delivery
+    // (streamed bodies are not kept, and binary ones are only JSON after transcoding)
+    const bool bUseCache = Options.CachePolicy != EHttpCachePolicy::Default && Request.IsValid() && !Options.JsonStream.IsValid() && !bTranscodeBody;
+    // A response its owner gave up on (e.g., a cancelled prefetch) must not refill the cache
+    const bool bCancelled = Options.CancelFlag.IsValid() && Options.CancelFlag->Load();
+    if (bUseCache && ResponseData.bWasSuccessful && !bCancelled)
+    {
+        FHttpResponseCache::Get().Store(Request->GetVerb(), Request->GetURL(),
+            [&Request](const FString& Name) { return Request->GetHeader(Name); }, ResponseData);
+    }
+
+    // Degrade the response (latency, bandwidth, truncation) when fault injection is enabled; everything
+    // below reads the degraded body, which is only copied when a fault may apply
+    float FaultDelaySeconds = 0.0f;
+    TArray<uint8> FaultedBody;
+    TConstArrayView<uint8> RawBody = Response.IsValid() ? TConstArrayView<uint8>(Response->GetContent()) : TConstArrayView<uint8>();
+    if (FHttpFaultInjector::Get().IsEnabled() && Request.IsValid())
+    {
+        FaultedBody.Append(RawBody.GetData(), RawBody.Num());
+        FaultDelaySeconds = FHttpFaultInjector::Get().ApplyResponseFaults(Request->GetURL(), ResponseData, FaultedBody);
+        RawBody = FaultedBody;
+    }
+
+    // Stand in the cached response for a failed request
+    if (bUseCache && !ResponseData.bWasSuccessful &&
+        TryServeStaleOnError(*Request, ResponseData, Callback, Options, FaultDelaySeconds, RequestId))
+    {
+        return;
+    }
+
+    // Pull requested fields straight out of the raw UTF-8 body
+    if (Options.ExtractFields.Num() > 0 && Response.IsValid() && !bTranscodeBody)
+    {
+        ExtractResponseFields(ResponseData, RawBody, Options);
+    }
+
+    // Post-process on workers (decompress, parse, ...) before anything reaches the game thread
+    if (Options.Pipeline.IsValid())
+    {
+        Options.Pipeline->Run(ResponseData, TArray<uint8>(RawBody),
+            [Callback, Options, FaultDelaySeconds, RequestId, MemoryCharge = MoveTemp(MemoryCharge)](const FHttpResponseData& ProcessedData)
+            {
+                DeliverResponseAfter(ProcessedData, Callback, Options, FaultDelaySeconds, RequestId);
+            });
+        return;
+    }
+
+    if (bTranscodeBody)
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION,
+            [ResponseData, RawBody = TArray<uint8>(RawBody), BodyFormat, Callback, Options, FaultDelaySeconds, RequestId, MemoryCharge = MoveTemp(MemoryCharge)]() mutable
+            {
+                LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+                FString DecodeError;
+                if (!FHttpPayloadCodec::TranscodeToJson(BodyFormat, RawBody, ResponseData.ResponseBody, DecodeError, Options.ResponseSchema))
+                {
+                    ResponseData.SetError(EHttpErrorKind::DecodeError);
+                    ResponseData.ErrorMessage = FString::Printf(TEXT("Cannot decode %s response: %s"),
+                        FHttpPayloadCodec::GetContentType(BodyFormat), *DecodeError);
+                }
+                else if (Options.ExtractFields.Num() > 0)
+                {
+                    FTCHARToUTF8 Utf8Body(*ResponseData.ResponseBody);
+                    ExtractResponseFields(ResponseData, TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8Body.Get()), Utf8Body.Length()), Options);
+                }
+                DeliverResponseAfter(ResponseData, Callback, Options, FaultDelaySeconds, RequestId);
+            });
+        return;
+    }
+
+    DeliverResponseAfter(ResponseData, Callback, Options, FaultDelaySeconds, RequestId);
+}
+
+void UHttpBlueprintFunctionLibrary::DeliverResponseAfter(
+    const FHttpResponseData& ResponseData,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    float DelaySeconds,
+    uint32 RequestId)
+{
+    if (DelaySeconds <= 0.0f)
+    {
+        DeliverResponse(ResponseData, Callback, Options, RequestId);
+        return;
+    }
+
+    // Wait on the core ticker rather than blocking any thread
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [ResponseData, Callback, Options, RequestId](float DeltaTime)
+        {
+            DeliverResponse(ResponseData, Callback, Options, RequestId);
+            return false;
+        }), DelaySeconds);
+}
+
+void UHttpBlueprintFunctionLibrary::DeliverResponse(
+    const FHttpResponseData& ResponseData,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    uint32 RequestId)
+{
+    SCOPE_CYCLE_COUNTER(STAT_HttpDeliverResponse);
+    FHttpOverheadScope OverheadScope(EHttpOverheadPhase::Delivery);
+
+    FHttpTrafficMonitor& Monitor = FHttpTrafficMonitor::Get();
+    Monitor.Record(RequestId, EHttpTrafficEventType::Dispatched);
+
+    // CRITICAL: Execute Blueprint delegates on the Game Thread
+    // HTTP callbacks happen on background threads, but Blueprint code must run on the main thread.
+    // The dispatcher spreads bursts of callbacks over several frames (HttpBlueprint.Dispatch.BudgetMs)
+    FHttpCallbackDispatcher::Get().Dispatch(Options, Callback.RequiresGameThread(),
+        [Callback, ResponseData, RequestId, &Monitor, MemoryCharge = FHttpResponseMemoryCharge(ResponseData)]()
         {
-            if (UserCallback.IsBound())
+            Monitor.Record(RequestId, EHttpTrafficEventType::CallbackStarted);
+            Callback.Execute(ResponseData);
+            Monitor.Record(RequestId, EHttpTrafficEventType::CallbackFinished);
+        });
+}
+
+void UHttpBlueprintFunctionLibrary::ExtractResponseFields(
+    FHttpResponseData& ResponseData,
+    TArrayView<const uint8> Body,
+    const FHttpRequestOptions& Options)
+{
+    const FHttpJsonFieldExtractor Extractor(Options.ExtractFields);
+    if (!Extractor.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("%s"), *Extractor.GetError());
+        return;
+    }
+
+    Extractor.Extract(Body, ResponseData.ExtractedFields);
+}
+
+bool UHttpBlueprintFunctionLibrary::TryServeRecordedResponse(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    const FHttpBlueprintRuntimeSettings& Settings,
+    uint32 RequestId,
+    uint32 CallSiteId)
+{
+    FHttpResponseData ResponseData;
+    TArray<uint8> RawBody;
+    float LatencySeconds = 0.0f;
+
+    FHttpFixtureStore& Fixtures = FHttpFixtureStore::Get();
+    if (FHttpFixtureStore::IsReplaying(Settings))
+    {
+        // Fixture replay never falls through to the network: a missing fixture fails the request
+        if (!Fixtures.LoadFixture(Method, URL, RequestBody, ResponseData, RawBody, LatencySeconds))
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("%s"), *ResponseData.ErrorMessage);
+        }
+    }
+    else if (!FHttpTrafficArchive::Get().FindReplayResponse(Method, URL, ResponseData, LatencySeconds))
+    {
+        return false;
+    }
+
+    // Binary fixture bodies are counted as received, like live ones
+    const int32 BodyBytes = RawBody.Num() > 0 ? RawBody.Num() : ResponseData.ResponseBody.Len();
+
+    FHttpRequestLogger::Get().LogRequestStarted(Settings, RequestId, Method, URL, RequestBody, CallSiteId);
+    FHttpRequestLogger::Get().LogRequestCompleted(
+        Settings,
+        RequestId,
+        URL,
+        ResponseData,
+        BodyBytes
+    );
+    FHttpMetrics::RecordRequest(ResponseData, BodyBytes);
+    FHttpTrafficMonitor::Get().RecordStarted(RequestId, Method, URL, RequestBody.Len(), EHttpTrafficSource::Recorded, CallSiteId);
+    FHttpTrafficMonitor::Get().RecordCompleted(RequestId, ResponseData, BodyBytes);
+    FHttpCallSites::RecordRequest(CallSiteId, RequestBody.Len());
+    FHttpCallSites::RecordResponse(CallSiteId, BodyBytes, !ResponseData.bWasSuccessful);
+
+    DeliverStoredResponse(MoveTemp(ResponseData), Callback, Options, LatencySeconds, RequestId, MoveTemp(RawBody));
+    return true;
+}
+
+bool UHttpBlueprintFunctionLibrary::TryServeCachedResponse(
+    const FString& URL,
+    const FString& Method,
+    const TMap<FString, FString>& Headers,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    const FHttpBlueprintRuntimeSettings& Settings,
+    uint32 RequestId,
+    uint32 CallSiteId)
+{
+    if (Options.CachePolicy == EHttpCachePolicy::Default || !FHttpResponseCache::IsCacheableMethod(Method))
+    {
+        return false;
+    }
+
+    const bool bServeStale = Options.CachePolicy == EHttpCachePolicy::StaleWhileRevalidate ||
+        Options.CachePolicy == EHttpCachePolicy::StaleWhileRevalidateAndNotify;
+
+    FHttpResponseData ResponseData;
+    const FHttpResponseCache::ELookupResult Result = FHttpResponseCache::Get().Find(Method, URL,
+        [&Headers, &Options](const FString& Name) { return GetSentRequestHeader(Headers, Options, Name); }, ResponseData,
+        bServeStale ? FHttpResponseCache::EStaleWindow::WhileRevalidate : FHttpResponseCache::EStaleWindow::None);
+    if (Result == FHttpResponseCache::ELookupResult::Miss)
+    {
+        return false;
+    }
+    ResponseData.ResponseTimeSeconds = 0.0f;
+
+    FHttpRequestLogger::Get().LogRequestStarted(Settings, RequestId, Method, URL, FString(), CallSiteId);
+    FHttpRequestLogger::Get().LogRequestCompleted(Settings, RequestId, URL, ResponseData, ResponseData.ResponseBody.Len());
+    FHttpMetrics::RecordRequest(ResponseData, ResponseData.ResponseBody.Len());
+    FHttpTrafficMonitor::Get().RecordStarted(RequestId, Method, URL, 0, EHttpTrafficSource::Cache, CallSiteId);
+    FHttpTrafficMonitor::Get().RecordCompleted(RequestId, ResponseData, ResponseData.ResponseBody.Len());
+    FHttpCallSites::RecordRequest(CallSiteId, 0);
+    FHttpCallSites::RecordResponse(CallSiteId, ResponseData.ResponseBody.Len(), false);
+
+    // The stale response goes out now; the refresh only updates the cache (or calls back again)
+    if (Result == FHttpResponseCache::ELookupResult::Stale)
+    {
+        RevalidateCachedResponse(URL, Headers, ResponseData, Callback, Options);
+    }
+
+    DeliverStoredResponse(MoveTemp(ResponseData), Callback, Options, 0.0f, RequestId);
+    return true;
+}
+
+void UHttpBlueprintFunctionLibrary::RevalidateCachedResponse(
+    const FString& URL,
+    const TMap<FString, FString>& RequestHeaders,
+    const FHttpResponseData& CachedResponse,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options)
+{
+    if (!FHttpResponseCache::Get().BeginRevalidation(TEXT("GET"), URL))
+    {
+        return;
+    }
+
+    // Same request as the caller's (credentials, Accept, ...), but the server may answer 304 without
+    // a body if the cached response is still current
+    TMap<FString, FString> Headers = RequestHeaders;
+    if (const FString* ETag = CachedResponse.ResponseHeaders.Find(TEXT("ETag")))
+    {
+        Headers.Add(TEXT("If-None-Match"), *ETag);
+    }
+    if (const FString* LastModified = CachedResponse.ResponseHeaders.Find(TEXT("Last-Modified")))
+    {
+        Headers.Add(TEXT("If-Modified-Since"), *LastModified);
+    }
+
+    FHttpRequestOptions RevalidateOptions;
+    RevalidateOptions.CallbackPriority = EHttpCallbackPriority::Low;
+    RevalidateOptions.PayloadFormat = Options.PayloadFormat;
+    RevalidateOptions.ResponseSchema = Options.ResponseSchema;
+
+    // A stream reader has already been fed the stale body and cannot take a second one
+    const bool bNotify = Options.CachePolicy == EHttpCachePolicy::StaleWhileRevalidateAndNotify && !Options.JsonStream.IsValid();
+
+    StartHttpRequest(URL, TEXT("GET"), FString(), Headers, RevalidateOptions, FHttpResponseCallback(FOnHttpResponseNative::CreateLambda(
+        [URL, Headers, Callback, Options, RevalidateOptions, bNotify](const FHttpResponseData& Response)
+        {
+            FHttpResponseCache& Cache = FHttpResponseCache::Get();
+            Cache.EndRevalidation(TEXT("GET"), URL);
+
+            if (Response.ResponseCode == 304)
             {
-                UserCallback.ExecuteIfBound(
-                    ResponseData.bWasSuccessful,
-                    ResponseData.ResponseCode,
-                    ResponseData.ResponseBody,
-                    ResponseData.ErrorMessage
-                );
+                Cache.MarkRevalidated(TEXT("GET"), URL, Response);
+                return;
             }
-            else
+
+            // A failed refresh leaves the stale entry in place for stale-if-error
+            if (!Response.bWasSuccessful)
             {
-                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HTTP response received but no callback delegate was bound"));
+                return;
             }
-        });
+
+            Cache.Store(TEXT("GET"), URL,
+                [&Headers, &RevalidateOptions](const FString& Name) { return GetSentRequestHeader(Headers, RevalidateOptions, Name); }, Response);
+            if (bNotify && Callback.IsBound())
+            {
+                DeliverStoredResponse(Response, Callback, Options, 0.0f, 0);
+            }
+        })));
+}
+
+bool UHttpBlueprintFunctionLibrary::TryServeStaleOnError(
+    const IHttpRequest& Request,
+    const FHttpResponseData& FailedResponse,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    float DelaySeconds,
+    uint32 RequestId)
+{
+    return ServeStaleOnError(Request.GetURL(), Request.GetVerb(), [&Request](const FString& Name) { return Request.GetHeader(Name); },
+        FailedResponse, Callback, Options, DelaySeconds, RequestId);
+}
+
+bool UHttpBlueprintFunctionLibrary::TryServeStaleOnError(
+    const FString& URL,
+    const FString& Method,
+    const TMap<FString, FString>& Headers,
+    const FHttpResponseData& FailedResponse,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    float DelaySeconds,
+    uint32 RequestId)
+{
+    return ServeStaleOnError(URL, Method, [&Headers, &Options](const FString& Name) { return GetSentRequestHeader(Headers, Options, Name); },
+        FailedResponse, Callback, Options, DelaySeconds, RequestId);
+}
+
+bool UHttpBlueprintFunctionLibrary::ServeStaleOnError(
+    const FString& URL,
+    const FString& Method,
+    TFunctionRef<FString(const FString&)> GetRequestHeader,
+    const FHttpResponseData& FailedResponse,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    float DelaySeconds,
+    uint32 RequestId)
+{
+    // Only failures that another attempt might not hit (network errors, timeouts, 5xx, 429) fall back
+    if (Options.CachePolicy == EHttpCachePolicy::Default || Options.CachePolicy == EHttpCachePolicy::FreshOnly ||
+        Options.JsonStream.IsValid() || !FHttpResponseCache::IsCacheableMethod(Method) || !IsHttpErrorRetryable(FailedResponse))
+    {
+        return false;
+    }
+
+    FHttpResponseData StaleResponse;
+    if (FHttpResponseCache::Get().Find(Method, URL, GetRequestHeader, StaleResponse,
+        FHttpResponseCache::EStaleWindow::IfError) == FHttpResponseCache::ELookupResult::Miss)
+    {
+        return false;
+    }
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Serving cached response for %s after: %s"), *URL, *FailedResponse.GetErrorMessage());
+    StaleResponse.ResponseTimeSeconds = FailedResponse.ResponseTimeSeconds;
+
+    DeliverStoredResponse(MoveTemp(StaleResponse), Callback, Options, DelaySeconds, RequestId);
+    return true;
+}
+
+void UHttpBlueprintFunctionLibrary::DeliverStoredResponse(
+    FHttpResponseData ResponseData,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    float DelaySeconds,
+    uint32 RequestId,
+    TArray<uint8> RawBody)
+{
+    // MessagePack/CBOR/Protobuf bodies are turned into JSON text on a worker, as in OnHttpRequestComplete
+    const EHttpPayloadFormat BodyFormat = FHttpPayloadCodec::GetResponseFormat(ResponseData);
+    if (RawBody.Num() > 0 && BodyFormat != EHttpPayloadFormat::Json && !Options.Pipeline.IsValid())
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION,
+            [ResponseData = MoveTemp(ResponseData), RawBody = MoveTemp(RawBody), BodyFormat, Callback, Options, DelaySeconds, RequestId]() mutable
+            {
+                LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+                FString DecodeError;
+                if (!FHttpPayloadCodec::TranscodeToJson(BodyFormat, RawBody, ResponseData.ResponseBody, DecodeError, Options.ResponseSchema))
+                {
+                    ResponseData.SetError(EHttpErrorKind::DecodeError);
+                    ResponseData.ErrorMessage = FString::Printf(TEXT("Cannot decode %s response: %s"),
+                        FHttpPayloadCodec::GetContentType(BodyFormat), *DecodeError);
+                }
+                DeliverStoredResponse(MoveTemp(ResponseData), Callback, Options, DelaySeconds, RequestId);
+            });
+        return;
+    }
+
+    if (Options.ExtractFields.Num() > 0)
+    {
+        FTCHARToUTF8 Utf8Body(*ResponseData.ResponseBody);
+        ExtractResponseFields(ResponseData, TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8Body.Get()), Utf8Body.Length()), Options);
+    }
+
+    // Stored bodies are streamed in one piece so the consumer sees the same batches
+    if (Options.JsonStream.IsValid())
+    {
+        FTCHARToUTF8 Utf8Body(*ResponseData.ResponseBody);
+        Options.JsonStream->Feed(reinterpret_cast<const uint8*>(Utf8Body.Get()), Utf8Body.Length());
+        Options.JsonStream->Finish();
+        if (ResponseData.bWasSuccessful && Options.JsonStream->HasError())
+        {
+            ResponseData.SetError(EHttpErrorKind::DecodeError);
+            ResponseData.ErrorMessage = Options.JsonStream->GetError();
+        }
+        ResponseData.ResponseBody.Empty();
+    }
+
+    // Stored responses go through the same post-processing as live ones
+    if (Options.Pipeline.IsValid())
+    {
+        Options.Pipeline->Run(ResponseData, MoveTemp(RawBody),
+            [Callback, Options, DelaySeconds, RequestId](const FHttpResponseData& ProcessedData)
+            {
+                DeliverResponseAfter(ProcessedData, Callback, Options, DelaySeconds, RequestId);
+            });
+        return;
+    }
+
+    DeliverResponseAfter(ResponseData, Callback, Options, DelaySeconds, RequestId);
+}
+
+bool UHttpBlueprintFunctionLibrary::TryInjectRequestFault(
+    const FString& URL,
+    const FString& Method,
+    const FString& RequestBody,
+    const TMap<FString, FString>& Headers,
+    const FHttpResponseCallback& Callback,
+    const FHttpRequestOptions& Options,
+    const FHttpBlueprintRuntimeSettings& Settings,
+    uint32 RequestId,
+    uint32 CallSiteId)
+{
+    FHttpFaultInjector& Faults = FHttpFaultInjector::Get();
+    if (!Faults.IsEnabled())
+    {
+        return false;
+    }
+
+    FHttpResponseData ResponseData;
+    float DelaySeconds = 0.0f;
+    if (!Faults.TryInjectRequestFault(URL, ResponseData, DelaySeconds))
+    {
+        return false;
+    }
+
+    FHttpRequestLogger::Get().LogRequestStarted(Settings, RequestId, Method, URL, RequestBody, CallSiteId);
+    FHttpRequestLogger::Get().LogRequestCompleted(Settings, RequestId, URL, ResponseData, 0);
+    FHttpMetrics::RecordRequest(ResponseData, 0);
+    FHttpTrafficMonitor::Get().RecordStarted(RequestId, Method, URL, RequestBody.Len(), EHttpTrafficSource::FaultInjected, CallSiteId);
+    FHttpTrafficMonitor::Get().RecordCompleted(RequestId, ResponseData, 0);
+    FHttpCallSites::RecordRequest(CallSiteId, RequestBody.Len());
+    FHttpCallSites::RecordResponse(CallSiteId, 0, true);
+
+    if (TryServeStaleOnError(URL, Method, Headers, ResponseData, Callback, Options, DelaySeconds, RequestId))
+    {
+        return true;
+    }
+
+    DeliverResponseAfter(ResponseData, Callback, Options, DelaySeconds, RequestId);
+    return true;
 }
 
 FHttpResponseData UHttpBlueprintFunctionLibrary::ProcessHttpResponse(
@@ -333,40 +1283,73 @@ FHttpResponseData UHttpBlueprintFunctionLibrary::ProcessHttpResponse(
         }
 
         // Determine if this is considered a successful response
+        // Status failures are described from ResponseCode when someone reads GetErrorMessage()
         ResponseData.bWasSuccessful = IsHttpResponseSuccessful(ResponseData.ResponseCode);
-
-        if (!ResponseData.bWasSuccessful)
-        {
-            ResponseData.ErrorMessage = FString::Printf(
-                TEXT("HTTP Error %d: %s"),
-                ResponseData.ResponseCode,
-                *GetHttpResponseCodeDescription(ResponseData.ResponseCode)
-            );
-        }
+        ResponseData.ErrorKind = GetHttpErrorKindForStatus(ResponseData.ResponseCode);
     }
     else
     {
-        // Request failed at the network level
-        ResponseData.bWasSuccessful = false;
+        // Request failed at the network level; the request knows which way
         ResponseData.ResponseCode = 0;
-        ResponseData.ErrorMessage = TEXT("Network error: Request failed to complete");
+        ResponseData.SetError(EHttpErrorKind::NetworkError);
 
-        // Try to get more specific error info if available
         if (Request.IsValid())
         {
-            FString URL = Request->GetURL();
-            ResponseData.ErrorMessage += FString::Printf(TEXT(" (URL: %s)"), *URL);
+            switch (Request->GetFailureReason())
+            {
+            case EHttpFailureReason::ConnectionError:
+                ResponseData.ErrorKind = EHttpErrorKind::ConnectionFailed;
+                break;
+
+            case EHttpFailureReason::Cancelled:
+                ResponseData.ErrorKind = EHttpErrorKind::Cancelled;
+                break;
+
+            case EHttpFailureReason::TimedOut:
+                ResponseData.SetError(EHttpErrorKind::Timeout,
+                    FMath::RoundToInt64(Request->GetElapsedTime() * 1000.0),
+                    FMath::RoundToInt64(FHttpBlueprintRuntimeSettings::Get().RequestTimeoutSeconds * 1000.0));
+                break;
+
+            default:
+                break;
+            }
         }
     }
 
     return ResponseData;
 }
 
+FString UHttpBlueprintFunctionLibrary::GetSentRequestHeader(
+    const TMap<FString, FString>& Headers,
+    const FHttpRequestOptions& Options,
+    const FString& Name)
+{
+    if (const FString* Value = Headers.Find(Name))
+    {
+        return *Value;
+    }
+
+    // Defaults set by CreateHttpRequest (trace context changes per request, so nothing varies on it)
+    if (Name.Equals(TEXT("User-Agent"), ESearchCase::IgnoreCase))
+    {
+        return FHttpBlueprintRuntimeSettings::Get().UserAgent;
+    }
+    if (Name.Equals(TEXT("Accept"), ESearchCase::IgnoreCase) && Options.PayloadFormat != EHttpPayloadFormat::Json)
+    {
+        return FHttpPayloadCodec::GetAcceptHeader(Options.PayloadFormat);
+    }
+    return FString();
+}
+
 TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UHttpBlueprintFunctionLibrary::CreateHttpRequest(
     const FString& URL,
     const FString& Method,
     const FString& RequestBody,
-    const TMap<FString, FString>& Headers)
+    const TMap<FString, FString>& Headers,
+    const FHttpBlueprintRuntimeSettings& Settings,
+    EHttpPayloadFormat PayloadFormat,
+    const UScriptStruct* RequestSchema)
 {
     // Get the HTTP module and create a new request
     FHttpModule* Http = &FHttpModule::Get();
@@ -391,11 +1374,43 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UHttpBlueprintFunctionLibrary::Cre
     // Set some default headers if they weren't provided
     if (!Headers.Contains(TEXT("User-Agent")))
     {
-        Request->SetHeader(TEXT("User-Agent"), TEXT("UnrealEngine/5.0 HttpBlueprintAPI/1.0"));
+        Request->SetHeader(TEXT("User-Agent"), Settings.UserAgent);
     }
 
-    // Set timeout (30 seconds default)
-    Request->SetTimeout(30.0f);
+    // Propagate W3C trace context (before signing, so the headers are covered by the signature)
+    FHttpRequestTracer::Get().InjectHeaders(*Request, Settings);
+
+    // Negotiate a binary body format: ask for it, and send a JSON body in it
+    if (PayloadFormat != EHttpPayloadFormat::Json)
+    {
+        if (!Headers.Contains(TEXT("Accept")))
+        {
+            Request->SetHeader(TEXT("Accept"), FHttpPayloadCodec::GetAcceptHeader(PayloadFormat));
+        }
+
+        if (!RequestBody.IsEmpty())
+        {
+            TArray<uint8> EncodedBody;
+            FString EncodeError;
+            if (FHttpPayloadCodec::TranscodeFromJson(PayloadFormat, RequestBody, EncodedBody, EncodeError, RequestSchema))
+            {
+                Request->SetContent(MoveTemp(EncodedBody));
+                Request->SetHeader(TEXT("Content-Type"), FHttpPayloadCodec::GetContentType(PayloadFormat));
+            }
+            else
+            {
+                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Request body sent as text, it cannot be encoded as %s: %s"),
+                    FHttpPayloadCodec::GetContentType(PayloadFormat), *EncodeError);
+            }
+        }
+    }
+
+    // Timeouts come from Project Settings / HttpBlueprint.Request.* (30 seconds default)
+    Request->SetTimeout(Settings.RequestTimeoutSeconds);
+    if (Settings.ActivityTimeoutSeconds > 0.0f)
+    {
+        Request->SetActivityTimeout(Settings.ActivityTimeoutSeconds);
+    }
 
     return Request;
 }
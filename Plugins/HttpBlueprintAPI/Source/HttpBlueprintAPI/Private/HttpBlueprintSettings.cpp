@@ -0,0 +1,388 @@
+#include "HttpBlueprintSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+// =============================================================================
+// CONSOLE VARIABLES
+// =============================================================================
+
+namespace HttpBlueprintSettingsCVars
+{
+    static TAutoConsoleVariable<float> RequestTimeoutSeconds(
+        TEXT("HttpBlueprint.Request.TimeoutSeconds"),
+        30.0f,
+        TEXT("Total time (seconds) an HTTP request may take before it fails."));
+
+    static TAutoConsoleVariable<float> ActivityTimeoutSeconds(
+        TEXT("HttpBlueprint.Request.ActivityTimeoutSeconds"),
+        0.0f,
+        TEXT("Time (seconds) without data received before an HTTP request fails (0 = engine default)."));
+
+    static TAutoConsoleVariable<FString> UserAgent(
+        TEXT("HttpBlueprint.Request.UserAgent"),
+        TEXT("UnrealEngine/5.0 HttpBlueprintAPI/1.0"),
+        TEXT("User-Agent sent when the caller does not provide one."));
+
+    static TAutoConsoleVariable<FString> DefaultContentType(
+        TEXT("HttpBlueprint.Request.DefaultContentType"),
+        TEXT("application/json"),
+        TEXT("Content-Type used by Make HTTP GET/POST Request when none is given."));
+
+    static TAutoConsoleVariable<float> LogSampleRate(
+        TEXT("HttpBlueprint.Log.SampleRate"),
+        1.0f,
+        TEXT("Fraction (0-1) of successful HTTP requests whose start/completion is logged."));
+
+    static TAutoConsoleVariable<float> LogFailureSampleRate(
+        TEXT("HttpBlueprint.Log.FailureSampleRate"),
+        1.0f,
+        TEXT("Fraction (0-1) of failed HTTP requests that are logged as warnings."));
+
+    static TAutoConsoleVariable<int32> LogMaxBodyBytes(
+        TEXT("HttpBlueprint.Log.MaxBodyBytes"),
+        1024,
+        TEXT("Maximum number of request body characters captured for Verbose logging (0 disables body logging)."));
+
+    static TAutoConsoleVariable<int32> HarMaxQueuedBytes(
+        TEXT("HttpBlueprint.Har.MaxQueuedBytes"),
+        32 * 1024 * 1024,
+        TEXT("Maximum bytes of captured traffic waiting to be written. Entries beyond this are dropped."));
+
+    static TAutoConsoleVariable<int32> HarMaxBodyBytes(
+        TEXT("HttpBlueprint.Har.MaxBodyBytes"),
+        1024 * 1024,
+        TEXT("Maximum response body bytes stored per captured entry. Larger bodies are truncated."));
+
+    static TAutoConsoleVariable<float> HarReplayLatencyScale(
+        TEXT("HttpBlueprint.Har.ReplayLatencyScale"),
+        1.0f,
+        TEXT("Multiplier applied to recorded latencies when replaying (0 = respond immediately)."));
+
+    static TAutoConsoleVariable<bool> HarIncludeCredentials(
+        TEXT("HttpBlueprint.Har.IncludeCredentials"),
+        false,
+        TEXT("Write credential headers (Authorization, Cookie, API keys) to HAR captures in clear text instead of redacting them."));
+
+    static TAutoConsoleVariable<int32> FixtureMode(
+        TEXT("HttpBlueprint.Fixture.Mode"),
+        0,
+        TEXT("HTTP fixture mode: 0 = off, 1 = record responses to fixtures, 2 = answer requests from fixtures only."));
+
+    static TAutoConsoleVariable<FString> FixtureDirectory(
+        TEXT("HttpBlueprint.Fixture.Dir"),
+        TEXT(""),
+        TEXT("Directory holding HTTP fixtures (defaults to <Project>/Saved/HttpFixtures)."));
+
+    static TAutoConsoleVariable<bool> FixtureSimulateTiming(
+        TEXT("HttpBlueprint.Fixture.SimulateTiming"),
+        false,
+        TEXT("When replaying fixtures, delay each response by its recorded latency."));
+
+    static TAutoConsoleVariable<float> DispatchBudgetMs(
+        TEXT("HttpBlueprint.Dispatch.BudgetMs"),
+        4.0f,
+        TEXT("Game-thread time (ms) spent running HTTP response callbacks per frame. Remaining callbacks run next frame (0 = unlimited)."));
+
+    static TAutoConsoleVariable<int32> PipelineMaxInFlight(
+        TEXT("HttpBlueprint.Pipeline.MaxInFlight"),
+        8,
+        TEXT("Number of responses post-processed by response pipelines at once. Further responses wait for a free slot."));
+
+    static TAutoConsoleVariable<int32> StreamBatchSize(
+        TEXT("HttpBlueprint.Stream.BatchSize"),
+        256,
+        TEXT("Array elements handed to the consumer at once by streaming JSON requests that do not set a batch size."));
+
+    static TAutoConsoleVariable<bool> TraceEnabled(
+        TEXT("HttpBlueprint.Trace.Enabled"),
+        false,
+        TEXT("Send W3C traceparent/tracestate headers with HTTP requests."));
+
+    static TAutoConsoleVariable<float> TraceSampleRate(
+        TEXT("HttpBlueprint.Trace.SampleRate"),
+        0.01f,
+        TEXT("Fraction (0-1) of traced HTTP requests marked as sampled when no route rule matches."));
+
+    static TAutoConsoleVariable<FString> TraceRouteSampleRates(
+        TEXT("HttpBlueprint.Trace.RouteSampleRates"),
+        TEXT(""),
+        TEXT("Per-route trace sample rates, e.g. \"*api.example.com/store*=1;*telemetry*=0\". URL wildcards are tried in order; the first match wins."));
+
+    static TAutoConsoleVariable<FString> TraceState(
+        TEXT("HttpBlueprint.Trace.State"),
+        TEXT(""),
+        TEXT("tracestate header value sent with traced HTTP requests (empty = none)."));
+
+    static TAutoConsoleVariable<float> MetricsIntervalSeconds(
+        TEXT("HttpBlueprint.Metrics.IntervalSeconds"),
+        10.0f,
+        TEXT("Seconds between HTTP metric exports (0 disables exporting)."));
+
+    static TAutoConsoleVariable<FString> MetricsPrometheusFile(
+        TEXT("HttpBlueprint.Metrics.PrometheusFile"),
+        TEXT(""),
+        TEXT("File rewritten with Prometheus exposition text on every HTTP metric export (empty = off)."));
+
+    static TAutoConsoleVariable<int32> MetricsPrometheusPort(
+        TEXT("HttpBlueprint.Metrics.PrometheusPort"),
+        0,
+        TEXT("Loopback port serving HTTP metrics as Prometheus exposition text at /metrics (0 = off)."));
+
+    static TAutoConsoleVariable<FString> MetricsStatsDAddress(
+        TEXT("HttpBlueprint.Metrics.StatsDAddress"),
+        TEXT(""),
+        TEXT("StatsD Ip:Port receiving HTTP metrics as UDP packets, e.g. 127.0.0.1:8125 (empty = off)."));
+
+    static TAutoConsoleVariable<int32> CacheMaxBytes(
+        TEXT("HttpBlueprint.Cache.MaxBytes"),
+        16 * 1024 * 1024,
+        TEXT("Memory budget of the HTTP response cache. Least recently used entries are evicted beyond it (0 disables caching)."));
+
+    static TAutoConsoleVariable<float> CacheDefaultTtlSeconds(
+        TEXT("HttpBlueprint.Cache.DefaultTtlSeconds"),
+        300.0f,
+        TEXT("Lifetime (seconds) of cached HTTP responses that do not send Cache-Control max-age."));
+
+    static TAutoConsoleVariable<float> CacheStaleWhileRevalidateSeconds(
+        TEXT("HttpBlueprint.Cache.StaleWhileRevalidateSeconds"),
+        3600.0f,
+        TEXT("Seconds past its lifetime a cached HTTP response is still served, then refreshed in the background, by requests with a stale-while-revalidate cache policy (without Cache-Control stale-while-revalidate)."));
+
+    static TAutoConsoleVariable<float> CacheStaleIfErrorSeconds(
+        TEXT("HttpBlueprint.Cache.StaleIfErrorSeconds"),
+        86400.0f,
+        TEXT("Seconds past its lifetime a cached HTTP response is served in place of a failed request with a stale cache policy (without Cache-Control stale-if-error)."));
+
+    static TAutoConsoleVariable<int32> PrefetchMaxInteractiveInFlight(
+        TEXT("HttpBlueprint.Prefetch.MaxInteractiveInFlight"),
+        2,
+        TEXT("HTTP prefetches only start while fewer other requests than this are in flight."));
+
+    static TAutoConsoleVariable<int32> PrefetchMaxConcurrent(
+        TEXT("HttpBlueprint.Prefetch.MaxConcurrent"),
+        2,
+        TEXT("Number of HTTP prefetches in flight at once."));
+
+    /** Republish the snapshot once per frame after any console variable changed */
+    static FAutoConsoleVariableSink SettingsSink(
+        FConsoleCommandDelegate::CreateStatic(&FHttpBlueprintRuntimeSettings::Refresh));
+}
+
+// =============================================================================
+// RUNTIME SNAPSHOT
+// =============================================================================
+
+namespace HttpBlueprintSettingsDetail
+{
+    /** Used until the first Refresh() so Get() never returns null */
+    static const FHttpBlueprintRuntimeSettings DefaultSnapshot;
+
+    static TAtomic<const FHttpBlueprintRuntimeSettings*> CurrentSnapshot { &DefaultSnapshot };
+
+    /** Every snapshot ever published, so a reference handed out by Get() never dangles. Game thread only */
+    static TArray<TUniquePtr<FHttpBlueprintRuntimeSettings>> PublishedSnapshots;
+
+    /** Parse "Wildcard=Rate;Wildcard=Rate", skipping malformed pairs */
+    static TArray<TPair<FString, float>> ParseRouteRules(const FString& Rules)
+    {
+        TArray<FString> Pairs;
+        Rules.ParseIntoArray(Pairs, TEXT(";"));
+
+        TArray<TPair<FString, float>> Parsed;
+        for (const FString& Pair : Pairs)
+        {
+            FString Wildcard, Rate;
+            if (Pair.Split(TEXT("="), &Wildcard, &Rate, ESearchCase::CaseSensitive, ESearchDir::FromEnd) && Rate.TrimStartAndEnd().IsNumeric())
+            {
+                Parsed.Emplace(Wildcard.TrimStartAndEnd(), FMath::Clamp(FCString::Atof(*Rate.TrimStartAndEnd()), 0.0f, 1.0f));
+            }
+        }
+        return Parsed;
+    }
+}
+
+const FHttpBlueprintRuntimeSettings& FHttpBlueprintRuntimeSettings::Get()
+{
+    return *HttpBlueprintSettingsDetail::CurrentSnapshot.Load();
+}
+
+void FHttpBlueprintRuntimeSettings::Initialize()
+{
+    check(IsInGameThread());
+
+    GetDefault<UHttpBlueprintSettings>()->ApplyToConsoleVariables();
+
+    namespace CVars = HttpBlueprintSettingsCVars;
+
+    // Let CI enable fixtures without touching ini files
+    FString FixtureModeName;
+    if (FParse::Value(FCommandLine::Get(), TEXT("HttpFixtureMode="), FixtureModeName))
+    {
+        const int32 Mode = FixtureModeName == TEXT("record") ? 1 : FixtureModeName == TEXT("replay") ? 2 : 0;
+        CVars::FixtureMode->Set(Mode, ECVF_SetByCommandline);
+    }
+
+    FString FixtureDir;
+    if (FParse::Value(FCommandLine::Get(), TEXT("HttpFixtureDir="), FixtureDir))
+    {
+        CVars::FixtureDirectory->Set(*FixtureDir, ECVF_SetByCommandline);
+    }
+
+    Refresh();
+}
+
+void FHttpBlueprintRuntimeSettings::Refresh()
+{
+    namespace CVars = HttpBlueprintSettingsCVars;
+
+    // Console variables, strings above all, are only safe to read here; other threads see the copies
+    check(IsInGameThread());
+
+    TUniquePtr<FHttpBlueprintRuntimeSettings> Snapshot = MakeUnique<FHttpBlueprintRuntimeSettings>();
+    Snapshot->RequestTimeoutSeconds = CVars::RequestTimeoutSeconds.GetValueOnGameThread();
+    Snapshot->ActivityTimeoutSeconds = CVars::ActivityTimeoutSeconds.GetValueOnGameThread();
+    Snapshot->UserAgent = CVars::UserAgent.GetValueOnGameThread();
+    Snapshot->DefaultContentType = CVars::DefaultContentType.GetValueOnGameThread();
+    Snapshot->LogSampleRate = CVars::LogSampleRate.GetValueOnGameThread();
+    Snapshot->LogFailureSampleRate = CVars::LogFailureSampleRate.GetValueOnGameThread();
+    Snapshot->LogMaxBodyBytes = CVars::LogMaxBodyBytes.GetValueOnGameThread();
+    Snapshot->HarMaxQueuedBytes = CVars::HarMaxQueuedBytes.GetValueOnGameThread();
+    Snapshot->HarMaxBodyBytes = CVars::HarMaxBodyBytes.GetValueOnGameThread();
+    Snapshot->HarReplayLatencyScale = CVars::HarReplayLatencyScale.GetValueOnGameThread();
+    Snapshot->bHarIncludeCredentials = CVars::HarIncludeCredentials.GetValueOnGameThread();
+    Snapshot->FixtureMode = CVars::FixtureMode.GetValueOnGameThread();
+    Snapshot->FixtureDirectory = CVars::FixtureDirectory.GetValueOnGameThread();
+    Snapshot->bFixtureSimulateTiming = CVars::FixtureSimulateTiming.GetValueOnGameThread();
+    Snapshot->DispatchBudgetMs = CVars::DispatchBudgetMs.GetValueOnGameThread();
+    Snapshot->PipelineMaxInFlight = CVars::PipelineMaxInFlight.GetValueOnGameThread();
+    Snapshot->StreamBatchSize = CVars::StreamBatchSize.GetValueOnGameThread();
+    Snapshot->bTraceEnabled = CVars::TraceEnabled.GetValueOnGameThread();
+    Snapshot->TraceSampleRate = CVars::TraceSampleRate.GetValueOnGameThread();
+    Snapshot->TraceRouteSampleRates = CVars::TraceRouteSampleRates.GetValueOnGameThread();
+    Snapshot->TraceState = CVars::TraceState.GetValueOnGameThread();
+    Snapshot->TraceRouteRules = HttpBlueprintSettingsDetail::ParseRouteRules(Snapshot->TraceRouteSampleRates);
+    Snapshot->MetricsIntervalSeconds = CVars::MetricsIntervalSeconds.GetValueOnGameThread();
+    Snapshot->MetricsPrometheusFile = CVars::MetricsPrometheusFile.GetValueOnGameThread();
+    Snapshot->MetricsPrometheusPort = CVars::MetricsPrometheusPort.GetValueOnGameThread();
+    Snapshot->MetricsStatsDAddress = CVars::MetricsStatsDAddress.GetValueOnGameThread();
+    Snapshot->CacheMaxBytes = CVars::CacheMaxBytes.GetValueOnGameThread();
+    Snapshot->CacheDefaultTtlSeconds = CVars::CacheDefaultTtlSeconds.GetValueOnGameThread();
+    Snapshot->CacheStaleWhileRevalidateSeconds = CVars::CacheStaleWhileRevalidateSeconds.GetValueOnGameThread();
+    Snapshot->CacheStaleIfErrorSeconds = CVars::CacheStaleIfErrorSeconds.GetValueOnGameThread();
+    Snapshot->PrefetchMaxInteractiveInFlight = CVars::PrefetchMaxInteractiveInFlight.GetValueOnGameThread();
+    Snapshot->PrefetchMaxConcurrent = CVars::PrefetchMaxConcurrent.GetValueOnGameThread();
+
+    // The sink fires for every console variable in the engine; only publish real changes
+    if (*Snapshot == Get())
+    {
+        return;
+    }
+
+    HttpBlueprintSettingsDetail::CurrentSnapshot.Store(Snapshot.Get(), EMemoryOrder::SequentiallyConsistent);
+    HttpBlueprintSettingsDetail::PublishedSnapshots.Add(MoveTemp(Snapshot));
+}
+
+void FHttpBlueprintRuntimeSettings::Shutdown()
+{
+    HttpBlueprintSettingsDetail::CurrentSnapshot = &HttpBlueprintSettingsDetail::DefaultSnapshot;
+    HttpBlueprintSettingsDetail::PublishedSnapshots.Empty();
+}
+
+bool FHttpBlueprintRuntimeSettings::operator==(const FHttpBlueprintRuntimeSettings& Other) const
+{
+    return RequestTimeoutSeconds == Other.RequestTimeoutSeconds &&
+        ActivityTimeoutSeconds == Other.ActivityTimeoutSeconds &&
+        UserAgent == Other.UserAgent &&
+        DefaultContentType == Other.DefaultContentType &&
+        LogSampleRate == Other.LogSampleRate &&
+        LogFailureSampleRate == Other.LogFailureSampleRate &&
+        LogMaxBodyBytes == Other.LogMaxBodyBytes &&
+        HarMaxQueuedBytes == Other.HarMaxQueuedBytes &&
+        HarMaxBodyBytes == Other.HarMaxBodyBytes &&
+        HarReplayLatencyScale == Other.HarReplayLatencyScale &&
+        bHarIncludeCredentials == Other.bHarIncludeCredentials &&
+        FixtureMode == Other.FixtureMode &&
+        FixtureDirectory == Other.FixtureDirectory &&
+        bFixtureSimulateTiming == Other.bFixtureSimulateTiming &&
+        DispatchBudgetMs == Other.DispatchBudgetMs &&
+        PipelineMaxInFlight == Other.PipelineMaxInFlight &&
+        StreamBatchSize == Other.StreamBatchSize &&
+        bTraceEnabled == Other.bTraceEnabled &&
+        TraceSampleRate == Other.TraceSampleRate &&
+        TraceRouteSampleRates == Other.TraceRouteSampleRates &&
+        TraceState == Other.TraceState &&
+        MetricsIntervalSeconds == Other.MetricsIntervalSeconds &&
+        MetricsPrometheusFile == Other.MetricsPrometheusFile &&
+        MetricsPrometheusPort == Other.MetricsPrometheusPort &&
+        MetricsStatsDAddress == Other.MetricsStatsDAddress &&
+        CacheMaxBytes == Other.CacheMaxBytes &&
+        CacheDefaultTtlSeconds == Other.CacheDefaultTtlSeconds &&
+        CacheStaleWhileRevalidateSeconds == Other.CacheStaleWhileRevalidateSeconds &&
+        CacheStaleIfErrorSeconds == Other.CacheStaleIfErrorSeconds &&
+        PrefetchMaxInteractiveInFlight == Other.PrefetchMaxInteractiveInFlight &&
+        PrefetchMaxConcurrent == Other.PrefetchMaxConcurrent;
+}
+
+// =============================================================================
+// DEVELOPER SETTINGS
+// =============================================================================
+
+UHttpBlueprintSettings::UHttpBlueprintSettings()
+{
+}
+
+FName UHttpBlueprintSettings::GetCategoryName() const
+{
+    return TEXT("Plugins");
+}
+
+void UHttpBlueprintSettings::ApplyToConsoleVariables() const
+{
+    namespace CVars = HttpBlueprintSettingsCVars;
+
+    // Project-setting priority: console, device profiles and command line still win
+    const EConsoleVariableFlags Priority = ECVF_SetByProjectSetting;
+
+    CVars::RequestTimeoutSeconds->Set(RequestTimeoutSeconds, Priority);
+    CVars::ActivityTimeoutSeconds->Set(ActivityTimeoutSeconds, Priority);
+    CVars::UserAgent->Set(*UserAgent, Priority);
+    CVars::DefaultContentType->Set(*DefaultContentType, Priority);
+    CVars::LogSampleRate->Set(LogSampleRate, Priority);
+    CVars::LogFailureSampleRate->Set(LogFailureSampleRate, Priority);
+    CVars::LogMaxBodyBytes->Set(LogMaxBodyBytes, Priority);
+    CVars::HarMaxQueuedBytes->Set(HarMaxQueuedBytes, Priority);
+    CVars::HarMaxBodyBytes->Set(HarMaxBodyBytes, Priority);
+    CVars::HarReplayLatencyScale->Set(HarReplayLatencyScale, Priority);
+    CVars::HarIncludeCredentials->Set(bHarIncludeCredentials, Priority);
+    CVars::FixtureMode->Set(FixtureMode, Priority);
+    CVars::FixtureDirectory->Set(*FixtureDirectory, Priority);
+    CVars::FixtureSimulateTiming->Set(bFixtureSimulateTiming, Priority);
+    CVars::DispatchBudgetMs->Set(DispatchBudgetMs, Priority);
+    CVars::PipelineMaxInFlight->Set(PipelineMaxInFlight, Priority);
+    CVars::StreamBatchSize->Set(StreamBatchSize, Priority);
+    CVars::TraceEnabled->Set(bTraceEnabled, Priority);
+    CVars::TraceSampleRate->Set(TraceSampleRate, Priority);
+    CVars::TraceRouteSampleRates->Set(*TraceRouteSampleRates, Priority);
+    CVars::TraceState->Set(*TraceState, Priority);
+    CVars::MetricsIntervalSeconds->Set(MetricsIntervalSeconds, Priority);
+    CVars::MetricsPrometheusFile->Set(*MetricsPrometheusFile, Priority);
+    CVars::MetricsPrometheusPort->Set(MetricsPrometheusPort, Priority);
+    CVars::MetricsStatsDAddress->Set(*MetricsStatsDAddress, Priority);
+    CVars::CacheMaxBytes->Set(CacheMaxBytes, Priority);
+    CVars::CacheDefaultTtlSeconds->Set(CacheDefaultTtlSeconds, Priority);
+    CVars::CacheStaleWhileRevalidateSeconds->Set(CacheStaleWhileRevalidateSeconds, Priority);
+    CVars::CacheStaleIfErrorSeconds->Set(CacheStaleIfErrorSeconds, Priority);
+    CVars::PrefetchMaxInteractiveInFlight->Set(PrefetchMaxInteractiveInFlight, Priority);
+    CVars::PrefetchMaxConcurrent->Set(PrefetchMaxConcurrent, Priority);
+}
+
+#if WITH_EDITOR
+void UHttpBlueprintSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    ApplyToConsoleVariables();
+    FHttpBlueprintRuntimeSettings::Refresh();
+}
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// "stat HttpBlueprintAPI" in the console shows these counters
+
+DECLARE_STATS_GROUP(TEXT("HTTP Blueprint API"), STATGROUP_HttpBlueprintAPI, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch Callbacks"), STAT_HttpDispatchCallbacks, STATGROUP_HttpBlueprintAPI, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Start Request"), STAT_HttpStartRequest, STATGROUP_HttpBlueprintAPI, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Complete Request"), STAT_HttpCompleteRequest, STATGROUP_HttpBlueprintAPI, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deliver Response"), STAT_HttpDeliverResponse, STATGROUP_HttpBlueprintAPI, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Callbacks Dispatched"), STAT_HttpCallbacksDispatched, STATGROUP_HttpBlueprintAPI, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Callbacks Deferred"), STAT_HttpCallbacksDeferred, STATGROUP_HttpBlueprintAPI, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Callbacks Pending"), STAT_HttpCallbacksPending, STATGROUP_HttpBlueprintAPI, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Max Callback Queue Latency (ms)"), STAT_HttpCallbackMaxQueueLatency, STATGROUP_HttpBlueprintAPI, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pipelines In Flight"), STAT_HttpPipelinesInFlight, STATGROUP_HttpBlueprintAPI, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pipelines Waiting"), STAT_HttpPipelinesWaiting, STATGROUP_HttpBlueprintAPI, );
+
+// "stat HttpBlueprintAPIMemory" shows memory the plugin is holding (see FHttpMemoryTracker)
+
+DECLARE_STATS_GROUP(TEXT("HTTP Blueprint API Memory"), STATGROUP_HttpBlueprintAPIMemory, STATCAT_Advanced);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live Body Bytes"), STAT_HttpLiveBodyBytes, STATGROUP_HttpBlueprintAPIMemory, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live Header Bytes"), STAT_HttpLiveHeaderBytes, STATGROUP_HttpBlueprintAPIMemory, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cache Bytes"), STAT_HttpCacheBytes, STATGROUP_HttpBlueprintAPIMemory, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests In Flight"), STAT_HttpRequestsInFlight, STATGROUP_HttpBlueprintAPIMemory, );
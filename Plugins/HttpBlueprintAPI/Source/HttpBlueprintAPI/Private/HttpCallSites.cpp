@@ -0,0 +1,203 @@
+#include "HttpCallSites.h"
+#include "HttpBlueprintAPI.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Class.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
+
+// =============================================================================
+// CALL SITE TABLE
+// =============================================================================
+
+namespace HttpCallSitesDetail
+{
+    struct FCounters
+    {
+        TAtomic<uint64> Requests { 0 };
+        TAtomic<uint64> Failures { 0 };
+        TAtomic<uint64> RequestBytes { 0 };
+        TAtomic<uint64> ResponseBytes { 0 };
+    };
+
+    /** Calling function and the class of the object it ran on; FObjectKey is safe against reuse after GC */
+    using FCallSiteKey = TPair<FObjectKey, FObjectKey>;
+
+    /** Indexed by call site id; ids are never moved, so counting needs no lock */
+    static FCounters Counters[FHttpCallSites::MaxCallSites];
+
+    /** Guards Ids and Names; lookups of known call sites only take the read lock */
+    static FRWLock Lock;
+    static TMap<FCallSiteKey, uint32> Ids;
+    static TArray<FString> Names;
+
+    static FString MakeName(const UFunction* Function, const UClass* ContextClass)
+    {
+        if (!Function)
+        {
+            return GetNameSafe(ContextClass);
+        }
+
+        const UClass* OwnerClass = Function->GetOwnerClass();
+        FString Name = FString::Printf(TEXT("%s.%s"), *GetNameSafe(OwnerClass), *Function->GetName());
+
+        // Function libraries and parent classes: also name the Blueprint that called them
+        if (ContextClass && ContextClass != OwnerClass)
+        {
+            Name += FString::Printf(TEXT(" (%s)"), *ContextClass->GetName());
+        }
+        return Name;
+    }
+
+    static void Report(const TArray<FString>& Args, FOutputDevice& Ar)
+    {
+        const int32 MaxLines = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+        const TArray<FHttpCallSites::FCallSiteStats> Stats = FHttpCallSites::GetStats();
+
+        Ar.Logf(TEXT("HTTP requests by call site (%d call sites):"), Stats.Num());
+        Ar.Logf(TEXT("  %10s %8s %12s %12s  %s"), TEXT("Requests"), TEXT("Failed"), TEXT("Sent"), TEXT("Received"), TEXT("Call site"));
+        for (int32 Index = 0; Index < Stats.Num() && Index < MaxLines; ++Index)
+        {
+            const FHttpCallSites::FCallSiteStats& Site = Stats[Index];
+            Ar.Logf(TEXT("  %10llu %8llu %12llu %12llu  %s"), Site.Requests, Site.Failures, Site.RequestBytes, Site.ResponseBytes, *Site.Name);
+        }
+    }
+
+    static FAutoConsoleCommand ReportCommand(
+        TEXT("HttpBlueprint.CallSites.Report"),
+        TEXT("Print request counts and bytes per calling Blueprint, busiest first. Usage: HttpBlueprint.CallSites.Report [MaxLines]"),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&Report));
+
+    static FAutoConsoleCommand ResetCommand(
+        TEXT("HttpBlueprint.CallSites.Reset"),
+        TEXT("Forget every call site and its request totals."),
+        FConsoleCommandDelegate::CreateStatic(&FHttpCallSites::Reset));
+}
+
+// =============================================================================
+// CALL SITES
+// =============================================================================
+
+uint32 FHttpCallSites::Capture(const UObject* WorldContextObject)
+{
+    using namespace HttpCallSitesDetail;
+
+    const UFunction* Function = nullptr;
+    const UObject* Caller = WorldContextObject;
+
+#if DO_BLUEPRINT_GUARD
+    // Native library functions do not push a frame, so the innermost script frame is the caller
+    const TArrayView<const FFrame* const> ScriptStack = FBlueprintContextTracker::Get().GetCurrentScriptStack();
+    if (ScriptStack.Num() > 0)
+    {
+        const FFrame* Frame = ScriptStack.Last();
+        Function = Frame->Node;
+        if (!Caller)
+        {
+            Caller = Frame->Object;
+        }
+    }
+#endif
+
+    const UClass* ContextClass = Caller ? Caller->GetClass() : nullptr;
+    if (!Function && !ContextClass)
+    {
+        return UnknownId;
+    }
+
+    const FCallSiteKey Key(FObjectKey(Function), FObjectKey(ContextClass));
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const uint32* Id = Ids.Find(Key))
+        {
+            return *Id;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    if (const uint32* Id = Ids.Find(Key))
+    {
+        return *Id;
+    }
+
+    if (Names.Num() == 0)
+    {
+        Names.Add(TEXT("<native>"));
+    }
+    if ((uint32)Names.Num() >= MaxCallSites)
+    {
+        return UnknownId;
+    }
+
+    const uint32 Id = Names.Add(MakeName(Function, ContextClass));
+    Ids.Add(Key, Id);
+    return Id;
+}
+
+void FHttpCallSites::RecordRequest(uint32 CallSiteId, int64 RequestBytes)
+{
+    HttpCallSitesDetail::FCounters& Site = HttpCallSitesDetail::Counters[FMath::Min(CallSiteId, MaxCallSites - 1)];
+    Site.Requests.IncrementExchange();
+    Site.RequestBytes.AddExchange((uint64)FMath::Max<int64>(0, RequestBytes));
+}
+
+void FHttpCallSites::RecordResponse(uint32 CallSiteId, int64 ResponseBytes, bool bFailed)
+{
+    HttpCallSitesDetail::FCounters& Site = HttpCallSitesDetail::Counters[FMath::Min(CallSiteId, MaxCallSites - 1)];
+    Site.ResponseBytes.AddExchange((uint64)FMath::Max<int64>(0, ResponseBytes));
+    if (bFailed)
+    {
+        Site.Failures.IncrementExchange();
+    }
+}
+
+FString FHttpCallSites::GetName(uint32 CallSiteId)
+{
+    FReadScopeLock ReadLock(HttpCallSitesDetail::Lock);
+    return HttpCallSitesDetail::Names.IsValidIndex(CallSiteId) ? HttpCallSitesDetail::Names[CallSiteId] : FString(TEXT("<native>"));
+}
+
+TArray<FHttpCallSites::FCallSiteStats> FHttpCallSites::GetStats()
+{
+    using namespace HttpCallSitesDetail;
+
+    TArray<FCallSiteStats> Stats;
+    {
+        FReadScopeLock ReadLock(Lock);
+        const uint32 NumIds = FMath::Max<uint32>(Names.Num(), 1);
+        for (uint32 Id = 0; Id < NumIds; ++Id)
+        {
+            const FCounters& Site = Counters[Id];
+            FCallSiteStats& Entry = Stats.AddDefaulted_GetRef();
+            Entry.Id = Id;
+            Entry.Name = Names.IsValidIndex(Id) ? Names[Id] : FString(TEXT("<native>"));
+            Entry.Requests = Site.Requests.Load(EMemoryOrder::Relaxed);
+            Entry.Failures = Site.Failures.Load(EMemoryOrder::Relaxed);
+            Entry.RequestBytes = Site.RequestBytes.Load(EMemoryOrder::Relaxed);
+            Entry.ResponseBytes = Site.ResponseBytes.Load(EMemoryOrder::Relaxed);
+        }
+    }
+
+    Stats.RemoveAll([](const FCallSiteStats& Entry) { return Entry.Requests == 0; });
+    Stats.Sort([](const FCallSiteStats& A, const FCallSiteStats& B) { return A.Requests > B.Requests; });
+    return Stats;
+}
+
+void FHttpCallSites::Reset()
+{
+    using namespace HttpCallSitesDetail;
+
+    FWriteScopeLock WriteLock(Lock);
+    Ids.Reset();
+    Names.Reset();
+
+    // Requests still in flight may add their responses to a reused id; totals restart from here anyway
+    for (FCounters& Site : Counters)
+    {
+        Site.Requests = 0;
+        Site.Failures = 0;
+        Site.RequestBytes = 0;
+        Site.ResponseBytes = 0;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Attribution of requests to the Blueprint (or object) that made them
+ *
+ * Each request start resolves its call site once, from the innermost Kismet script frame
+ * (the calling Blueprint function and its self object) or, for native callers, from the
+ * WorldContextObject. Call sites are interned to a compact id that travels with the
+ * request; request counts and bytes are aggregated per id with relaxed atomics.
+ * HttpBlueprint.CallSites.Report lists the busiest call sites.
+ */
+class FHttpCallSites
+{
+public:
+
+    /** Requests from C++ without a world context, and everything past MaxCallSites */
+    static constexpr uint32 UnknownId = 0;
+
+    /** Distinct call sites tracked until the next reset */
+    static constexpr uint32 MaxCallSites = 4096;
+
+    struct FCallSiteStats
+    {
+        uint32 Id = UnknownId;
+        FString Name;
+        uint64 Requests = 0;
+        uint64 Failures = 0;
+        uint64 RequestBytes = 0;
+        uint64 ResponseBytes = 0;
+    };
+
+    /**
+     * Intern the call site of a request being started on this thread
+     *
+     * @param WorldContextObject - Object that made the call, when the script stack does not say (may be null)
+     */
+    static uint32 Capture(const UObject* WorldContextObject);
+
+    /** Count a request started from a call site */
+    static void RecordRequest(uint32 CallSiteId, int64 RequestBytes);
+
+    /** Count the response of a request started from a call site */
+    static void RecordResponse(uint32 CallSiteId, int64 ResponseBytes, bool bFailed);
+
+    /** Readable call site, e.g. "BP_Shop_C.ExecuteUbergraph_BP_Shop" or "BP_Shop_C.Refresh (BP_ShopKeeper_C)" */
+    static FString GetName(uint32 CallSiteId);
+
+    /** Call sites with at least one request, busiest first */
+    static TArray<FCallSiteStats> GetStats();
+
+    /** Forget every call site and its totals */
+    static void Reset();
+};
@@ -0,0 +1,203 @@
+#include "HttpCallbackDispatcher.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpBlueprintStats.h"
+#include "HttpMemoryTracker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
+
+DEFINE_STAT(STAT_HttpDispatchCallbacks);
+DEFINE_STAT(STAT_HttpCallbacksDispatched);
+DEFINE_STAT(STAT_HttpCallbacksDeferred);
+DEFINE_STAT(STAT_HttpCallbacksPending);
+DEFINE_STAT(STAT_HttpCallbackMaxQueueLatency);
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpCallbackDispatcherCommands
+{
+    static FAutoConsoleCommand StatsCommand(
+        TEXT("HttpBlueprint.Dispatch.Stats"),
+        TEXT("Print callback dispatch totals: callbacks run, callbacks deferred by the frame budget and queue latency."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                const FHttpCallbackDispatcher::FDispatchStats Stats = FHttpCallbackDispatcher::Get().GetStats();
+                UE_LOG(LogHttpBlueprintAPI, Display, TEXT("HTTP callbacks: %llu dispatched, %llu deferred, %d pending, queue latency avg %.2f ms / max %.2f ms"),
+                    Stats.Dispatched,
+                    Stats.Deferred,
+                    FHttpCallbackDispatcher::Get().GetNumPending(),
+                    Stats.Dispatched > 0 ? Stats.TotalQueueLatencyMs / Stats.Dispatched : 0.0,
+                    Stats.MaxQueueLatencyMs);
+            }));
+}
+
+// =============================================================================
+// CALLBACK DISPATCHER
+// =============================================================================
+
+FHttpCallbackDispatcher& FHttpCallbackDispatcher::Get()
+{
+    static FHttpCallbackDispatcher Instance;
+    return Instance;
+}
+
+FHttpCallbackDispatcher::FHttpCallbackDispatcher()
+{
+    // A zero interval ticks once per frame on the game thread
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FHttpCallbackDispatcher::Tick), 0.0f);
+}
+
+void FHttpCallbackDispatcher::Enqueue(EHttpCallbackPriority Priority, TUniqueFunction<void()>&& Callback)
+{
+    FPendingCallback Pending;
+    Pending.Callback = MoveTemp(Callback);
+    Pending.QueuedCycles = FPlatformTime::Cycles64();
+    Pending.QueuedTick = TickCounter.Load(EMemoryOrder::Relaxed);
+
+    const int32 PriorityIndex = FMath::Clamp((int32)Priority, 0, NumPriorities - 1);
+    Queues[PriorityIndex].Enqueue(MoveTemp(Pending));
+    ++NumPending;
+}
+
+void FHttpCallbackDispatcher::EnqueueOnWorker(TUniqueFunction<void()>&& Callback)
+{
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Callback));
+}
+
+void FHttpCallbackDispatcher::EnqueueOnPipe(FName PipeName, TUniqueFunction<void()>&& Callback)
+{
+    FScopeLock Lock(&PipesLock);
+
+    TUniquePtr<FNamedPipe>& NamedPipe = Pipes.FindOrAdd(PipeName);
+    if (!NamedPipe.IsValid())
+    {
+        NamedPipe = MakeUnique<FNamedPipe>(PipeName);
+    }
+
+    NamedPipe->Pipe.Launch(UE_SOURCE_LOCATION, MoveTemp(Callback));
+}
+
+void FHttpCallbackDispatcher::Dispatch(const FHttpRequestOptions& Options, bool bRequiresGameThread, TUniqueFunction<void()>&& Callback)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+    if (bRequiresGameThread || Options.CompletionThread == EHttpCompletionThread::GameThread)
+    {
+        Enqueue(Options.CallbackPriority, MoveTemp(Callback));
+    }
+    else if (Options.CompletionThread == EHttpCompletionThread::NamedPipe)
+    {
+        EnqueueOnPipe(Options.CompletionPipe, MoveTemp(Callback));
+    }
+    else
+    {
+        EnqueueOnWorker(MoveTemp(Callback));
+    }
+}
+
+bool FHttpCallbackDispatcher::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_HttpDispatchCallbacks);
+
+    const uint64 CurrentTick = ++TickCounter;
+    if (NumPending.Load(EMemoryOrder::Relaxed) == 0)
+    {
+        return true;
+    }
+
+    const float BudgetMs = FHttpBlueprintRuntimeSettings::Get().DispatchBudgetMs;
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    const uint64 BudgetCycles = BudgetMs > 0.0f ? (uint64)(BudgetMs / 1000.0 / FPlatformTime::GetSecondsPerCycle64()) : MAX_uint64;
+
+    uint32 NumRun = 0;
+    uint32 NumDeferred = 0;
+    double TotalLatencyMs = 0.0;
+    double MaxLatencyMs = 0.0;
+
+    // Always run at least one callback so a single expensive callback cannot stall the queue
+    do
+    {
+        FPendingCallback Pending;
+        bool bFound = false;
+        for (TQueue<FPendingCallback, EQueueMode::Mpsc>& Queue : Queues)
+        {
+            if (Queue.Dequeue(Pending))
+            {
+                bFound = true;
+                break;
+            }
+        }
+
+        if (!bFound)
+        {
+            break;
+        }
+        --NumPending;
+
+        // Callbacks queued before the previous tick started were held back by the budget
+        if (Pending.QueuedTick + 1 < CurrentTick)
+        {
+            ++NumDeferred;
+        }
+
+        const double LatencyMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Pending.QueuedCycles);
+        TotalLatencyMs += LatencyMs;
+        MaxLatencyMs = FMath::Max(MaxLatencyMs, LatencyMs);
+
+        Pending.Callback();
+        ++NumRun;
+    }
+    while (FPlatformTime::Cycles64() - StartCycles < BudgetCycles);
+
+    {
+        FScopeLock Lock(&StatsLock);
+        Stats.Dispatched += NumRun;
+        Stats.Deferred += NumDeferred;
+        Stats.TotalQueueLatencyMs += TotalLatencyMs;
+        Stats.MaxQueueLatencyMs = FMath::Max(Stats.MaxQueueLatencyMs, MaxLatencyMs);
+    }
+
+    INC_DWORD_STAT_BY(STAT_HttpCallbacksDispatched, NumRun);
+    INC_DWORD_STAT_BY(STAT_HttpCallbacksDeferred, NumDeferred);
+    SET_DWORD_STAT(STAT_HttpCallbacksPending, NumPending.Load(EMemoryOrder::Relaxed));
+    SET_FLOAT_STAT(STAT_HttpCallbackMaxQueueLatency, MaxLatencyMs);
+
+    return true;
+}
+
+FHttpCallbackDispatcher::FDispatchStats FHttpCallbackDispatcher::GetStats() const
+{
+    FScopeLock Lock(&StatsLock);
+    return Stats;
+}
+
+void FHttpCallbackDispatcher::Shutdown()
+{
+    if (!TickHandle.IsValid())
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+
+    // Drop remaining callbacks: their owners are being torn down with the module
+    for (TQueue<FPendingCallback, EQueueMode::Mpsc>& Queue : Queues)
+    {
+        Queue.Empty();
+    }
+    NumPending = 0;
+
+    // Let callbacks already running on pipes finish before their pipes go away
+    FScopeLock Lock(&PipesLock);
+    for (TPair<FName, TUniquePtr<FNamedPipe>>& Pair : Pipes)
+    {
+        Pair.Value->Pipe.WaitUntilEmpty();
+    }
+    Pipes.Empty();
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Pipe.h"
+#include "HttpRequestOptions.h"
+
+/**
+ * Runs completed-response callbacks on the game thread within a per-frame time budget
+ *
+ * Callbacks can be queued from any thread. Once per frame the core ticker drains the
+ * queues in priority order (High, Normal, Low) until HttpBlueprint.Dispatch.BudgetMs
+ * is spent; whatever is left carries over to the next frame. At least one callback
+ * runs every frame, so a single heavy callback cannot stall the queue.
+ *
+ * Native consumers that do not need the game thread can instead complete on any
+ * worker or on a named pipe, which runs its callbacks one at a time in order.
+ */
+class FHttpCallbackDispatcher
+{
+public:
+
+    /** Totals since startup, for the console and automation */
+    struct FDispatchStats
+    {
+        uint64 Dispatched = 0;
+
+        /** Callbacks that missed at least one frame because the budget was spent */
+        uint64 Deferred = 0;
+
+        /** Time from queueing to execution, across all dispatched callbacks */
+        double TotalQueueLatencyMs = 0.0;
+        double MaxQueueLatencyMs = 0.0;
+    };
+
+    static FHttpCallbackDispatcher& Get();
+
+    /** Queue a callback to run on the game thread. Safe on any thread */
+    void Enqueue(EHttpCallbackPriority Priority, TUniqueFunction<void()>&& Callback);
+
+    /** Run a callback on any task graph worker. Safe on any thread */
+    void EnqueueOnWorker(TUniqueFunction<void()>&& Callback);
+
+    /** Run a callback on the worker pipe with this name, after earlier callbacks on the same pipe */
+    void EnqueueOnPipe(FName PipeName, TUniqueFunction<void()>&& Callback);
+
+    /**
+     * Run a callback wherever the request options ask for it to complete
+     *
+     * @param Options - Completion thread, pipe and priority of the request
+     * @param bRequiresGameThread - Force the game thread (Blueprint delegates)
+     * @param Callback - Work to run
+     */
+    void Dispatch(const FHttpRequestOptions& Options, bool bRequiresGameThread, TUniqueFunction<void()>&& Callback);
+
+    /** Number of callbacks waiting to run on the game thread */
+    int32 GetNumPending() const { return NumPending.Load(EMemoryOrder::Relaxed); }
+
+    FDispatchStats GetStats() const;
+
+    /** Stop ticking and drop anything still queued (module shutdown) */
+    void Shutdown();
+
+private:
+
+    struct FPendingCallback
+    {
+        TUniqueFunction<void()> Callback;
+        uint64 QueuedCycles = 0;
+        uint64 QueuedTick = 0;
+    };
+
+    /** FPipe keeps a pointer to its debug name, so the name lives next to it */
+    struct FNamedPipe
+    {
+        FString DebugName;
+        UE::Tasks::FPipe Pipe;
+
+        explicit FNamedPipe(FName Name)
+            : DebugName(TEXT("HttpBlueprintCompletion_") + Name.ToString())
+            , Pipe(*DebugName)
+        {
+        }
+    };
+
+    FHttpCallbackDispatcher();
+
+    bool Tick(float DeltaTime);
+
+    static constexpr int32 NumPriorities = 3;
+
+    TQueue<FPendingCallback, EQueueMode::Mpsc> Queues[NumPriorities];
+    TAtomic<int32> NumPending { 0 };
+
+    /** Incremented once per dispatcher tick; read on any thread when queueing */
+    TAtomic<uint64> TickCounter { 0 };
+
+    FTSTicker::FDelegateHandle TickHandle;
+
+    FCriticalSection PipesLock;
+    TMap<FName, TUniquePtr<FNamedPipe>> Pipes;
+
+    /** Written once per tick on the game thread; read from any thread */
+    FDispatchStats Stats;
+    mutable FCriticalSection StatsLock;
+};
@@ -0,0 +1,337 @@
+#include "HttpFaultInjection.h"
+#include "HttpBlueprintAPI.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+// =============================================================================
+// CONSOLE VARIABLES
+// =============================================================================
+
+namespace HttpFaultCVars
+{
+    /** Republish the settings snapshot; console variables change on the game thread */
+    static void OnChanged(IConsoleVariable* Variable)
+    {
+        FHttpFaultInjector::RefreshSettings();
+    }
+
+    static bool bEnable = false;
+    static FAutoConsoleVariableRef CVarEnable(
+        TEXT("HttpBlueprint.Fault.Enable"),
+        bEnable,
+        TEXT("Enable HTTP fault and latency injection."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static FString UrlFilter;
+    static FAutoConsoleVariableRef CVarUrlFilter(
+        TEXT("HttpBlueprint.Fault.UrlFilter"),
+        UrlFilter,
+        TEXT("Only inject faults into requests whose URL contains this substring (empty = all requests)."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static int32 Seed = 0;
+    static FAutoConsoleVariableRef CVarSeed(
+        TEXT("HttpBlueprint.Fault.Seed"),
+        Seed,
+        TEXT("Random seed for fault injection (0 = seed from time). Use a fixed seed for reproducible benchmarks."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float LatencyMs = 0.0f;
+    static FAutoConsoleVariableRef CVarLatencyMs(
+        TEXT("HttpBlueprint.Fault.LatencyMs"),
+        LatencyMs,
+        TEXT("Mean latency (ms) added to every response."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float JitterMs = 0.0f;
+    static FAutoConsoleVariableRef CVarJitterMs(
+        TEXT("HttpBlueprint.Fault.JitterMs"),
+        JitterMs,
+        TEXT("Latency spread (ms): half-range for uniform, standard deviation for normal."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static int32 LatencyDistribution = 0;
+    static FAutoConsoleVariableRef CVarLatencyDistribution(
+        TEXT("HttpBlueprint.Fault.LatencyDistribution"),
+        LatencyDistribution,
+        TEXT("Latency distribution: 0 = fixed, 1 = uniform, 2 = normal, 3 = exponential."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float DropPercent = 0.0f;
+    static FAutoConsoleVariableRef CVarDropPercent(
+        TEXT("HttpBlueprint.Fault.DropPercent"),
+        DropPercent,
+        TEXT("Percentage of requests that fail with a network error without being sent."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float ErrorPercent = 0.0f;
+    static FAutoConsoleVariableRef CVarErrorPercent(
+        TEXT("HttpBlueprint.Fault.ErrorPercent"),
+        ErrorPercent,
+        TEXT("Percentage of requests answered with a synthetic error status without being sent."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static FString ErrorCodes = TEXT("500,502,503,429");
+    static FAutoConsoleVariableRef CVarErrorCodes(
+        TEXT("HttpBlueprint.Fault.ErrorCodes"),
+        ErrorCodes,
+        TEXT("Comma separated status codes used for synthetic errors."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float BandwidthKBps = 0.0f;
+    static FAutoConsoleVariableRef CVarBandwidthKBps(
+        TEXT("HttpBlueprint.Fault.BandwidthKBps"),
+        BandwidthKBps,
+        TEXT("Simulated download bandwidth in KB/s (0 = unlimited)."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+
+    static float TruncatePercent = 0.0f;
+    static FAutoConsoleVariableRef CVarTruncatePercent(
+        TEXT("HttpBlueprint.Fault.TruncatePercent"),
+        TruncatePercent,
+        TEXT("Percentage of responses whose body is cut off at a random point."),
+        FConsoleVariableDelegate::CreateStatic(&OnChanged),
+        ECVF_Cheat);
+}
+
+// =============================================================================
+// SETTINGS
+// =============================================================================
+
+namespace HttpFaultInjectionDetail
+{
+    /** Parse "500,502,503" once per change instead of once per injected fault */
+    static TArray<int32> ParseErrorCodes(const FString& Codes)
+    {
+        TArray<FString> CodeStrings;
+        Codes.ParseIntoArray(CodeStrings, TEXT(","), true);
+
+        TArray<int32> Parsed;
+        for (const FString& CodeString : CodeStrings)
+        {
+            const int32 Code = FCString::Atoi(*CodeString.TrimStartAndEnd());
+            Parsed.Add(Code > 0 ? Code : 503);
+        }
+        if (Parsed.Num() == 0)
+        {
+            Parsed.Add(503);
+        }
+        return Parsed;
+    }
+}
+
+/** Used until a console variable changes, so GetSettings() never returns null */
+const FHttpFaultInjector::FSettings FHttpFaultInjector::DefaultSettings = []()
+    {
+        FSettings Defaults;
+        Defaults.ErrorCodes = HttpFaultInjectionDetail::ParseErrorCodes(HttpFaultCVars::ErrorCodes);
+        return Defaults;
+    }();
+
+TAtomic<const FHttpFaultInjector::FSettings*> FHttpFaultInjector::CurrentSettings { &FHttpFaultInjector::DefaultSettings };
+
+TArray<TUniquePtr<const FHttpFaultInjector::FSettings>> FHttpFaultInjector::PublishedSettings;
+
+const FHttpFaultInjector::FSettings& FHttpFaultInjector::GetSettings()
+{
+    return *CurrentSettings.Load();
+}
+
+void FHttpFaultInjector::RefreshSettings()
+{
+    // Console variables, strings above all, are only safe to read here; other threads see the copies
+    check(IsInGameThread());
+
+    TUniquePtr<FSettings> Settings = MakeUnique<FSettings>();
+    Settings->bEnable = HttpFaultCVars::bEnable;
+    Settings->UrlFilter = HttpFaultCVars::UrlFilter;
+    Settings->Seed = HttpFaultCVars::Seed;
+    Settings->LatencyMs = FMath::Max(0.0f, HttpFaultCVars::LatencyMs);
+    Settings->JitterMs = FMath::Max(0.0f, HttpFaultCVars::JitterMs);
+    Settings->LatencyDistribution = (EHttpFaultLatencyDistribution)HttpFaultCVars::LatencyDistribution;
+    Settings->DropPercent = HttpFaultCVars::DropPercent;
+    Settings->ErrorPercent = HttpFaultCVars::ErrorPercent;
+    Settings->ErrorCodes = HttpFaultInjectionDetail::ParseErrorCodes(HttpFaultCVars::ErrorCodes);
+    Settings->BandwidthKBps = HttpFaultCVars::BandwidthKBps;
+    Settings->TruncatePercent = HttpFaultCVars::TruncatePercent;
+
+    // Retired snapshots stay alive: a request on another thread may still be reading one
+    CurrentSettings.Store(Settings.Get(), EMemoryOrder::SequentiallyConsistent);
+    PublishedSettings.Add(MoveTemp(Settings));
+}
+
+// =============================================================================
+// FAULT INJECTOR
+// =============================================================================
+
+FHttpFaultInjector& FHttpFaultInjector::Get()
+{
+    static FHttpFaultInjector Instance;
+    return Instance;
+}
+
+bool FHttpFaultInjector::IsEnabled() const
+{
+    return GetSettings().bEnable;
+}
+
+bool FHttpFaultInjector::MatchesFilter(const FSettings& Settings, const FString& URL)
+{
+    return Settings.UrlFilter.IsEmpty() || URL.Contains(Settings.UrlFilter);
+}
+
+bool FHttpFaultInjector::RollPercent(const FSettings& Settings, float Percent)
+{
+    if (Percent <= 0.0f)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&RandomLock);
+    UpdateSeed(Settings);
+    return Random.FRand() * 100.0f < Percent;
+}
+
+void FHttpFaultInjector::UpdateSeed(const FSettings& Settings)
+{
+    // Re-seed whenever the seed cvar changes so a benchmark run can be repeated exactly
+    if (AppliedSeed != Settings.Seed)
+    {
+        AppliedSeed = Settings.Seed;
+        Random.Initialize(AppliedSeed != 0 ? AppliedSeed : (int32)FPlatformTime::Cycles());
+    }
+}
+
+float FHttpFaultInjector::SampleLatencySeconds(const FSettings& Settings)
+{
+    const float Mean = Settings.LatencyMs;
+    const float Jitter = Settings.JitterMs;
+    if (Mean <= 0.0f && Jitter <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    FScopeLock Lock(&RandomLock);
+    UpdateSeed(Settings);
+
+    float SampleMs = Mean;
+    switch (Settings.LatencyDistribution)
+    {
+    case EHttpFaultLatencyDistribution::Uniform:
+        SampleMs = Random.FRandRange(Mean - Jitter, Mean + Jitter);
+        break;
+
+    case EHttpFaultLatencyDistribution::Normal:
+    {
+        // Box-Muller transform
+        const float U1 = FMath::Max(Random.FRand(), KINDA_SMALL_NUMBER);
+        const float U2 = Random.FRand();
+        SampleMs = Mean + Jitter * FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(2.0f * PI * U2);
+        break;
+    }
+
+    case EHttpFaultLatencyDistribution::Exponential:
+        SampleMs = -Mean * FMath::Loge(FMath::Max(1.0f - Random.FRand(), KINDA_SMALL_NUMBER));
+        break;
+
+    default:
+        break;
+    }
+
+    return FMath::Max(0.0f, SampleMs) / 1000.0f;
+}
+
+int32 FHttpFaultInjector::PickErrorCode(const FSettings& Settings)
+{
+    FScopeLock Lock(&RandomLock);
+    UpdateSeed(Settings);
+    return Settings.ErrorCodes[Random.RandHelper(Settings.ErrorCodes.Num())];
+}
+
+bool FHttpFaultInjector::TryInjectRequestFault(const FString& URL, FHttpResponseData& OutResponse, float& OutDelaySeconds)
+{
+    const FSettings& Settings = GetSettings();
+    if (!Settings.bEnable || !MatchesFilter(Settings, URL))
+    {
+        return false;
+    }
+
+    if (RollPercent(Settings, Settings.DropPercent))
+    {
+        OutResponse = FHttpResponseData();
+        OutResponse.SetError(EHttpErrorKind::NetworkError);
+        OutResponse.ErrorMessage = FString::Printf(TEXT("Network error: Request failed to complete (URL: %s) [fault injected]"), *URL);
+    }
+    else if (RollPercent(Settings, Settings.ErrorPercent))
+    {
+        OutResponse = FHttpResponseData();
+        OutResponse.ResponseCode = PickErrorCode(Settings);
+        OutResponse.SetError(UHttpBlueprintFunctionLibrary::GetHttpErrorKindForStatus(OutResponse.ResponseCode));
+        OutResponse.ErrorMessage = FString::Printf(TEXT("HTTP Error %d: %s [fault injected]"),
+            OutResponse.ResponseCode,
+            *UHttpBlueprintFunctionLibrary::GetHttpResponseCodeDescription(OutResponse.ResponseCode));
+
+        if (OutResponse.ResponseCode == 429 || OutResponse.ResponseCode == 503)
+        {
+            OutResponse.ResponseHeaders.Add(TEXT("Retry-After"), TEXT("1"));
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    OutDelaySeconds = SampleLatencySeconds(Settings);
+    OutResponse.ResponseTimeSeconds = OutDelaySeconds;
+
+    UE_LOG(LogHttpBlueprintAPI, Verbose, TEXT("Injected HTTP fault for %s: %s"), *URL, *OutResponse.ErrorMessage);
+    return true;
+}
+
+float FHttpFaultInjector::ApplyResponseFaults(const FString& URL, FHttpResponseData& InOutResponse, TArray<uint8>& InOutRawBody)
+{
+    const FSettings& Settings = GetSettings();
+    if (!Settings.bEnable || !MatchesFilter(Settings, URL))
+    {
+        return 0.0f;
+    }
+
+    float DelaySeconds = SampleLatencySeconds(Settings);
+
+    if (InOutRawBody.Num() > 0)
+    {
+        // Cut the transfer short, as a dropped connection would
+        if (RollPercent(Settings, Settings.TruncatePercent))
+        {
+            int32 KeepBytes = 0;
+            {
+                FScopeLock Lock(&RandomLock);
+                KeepBytes = Random.RandHelper(InOutRawBody.Num());
+            }
+            InOutRawBody.SetNum(KeepBytes);
+
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(InOutRawBody.GetData()), InOutRawBody.Num());
+            InOutResponse.ResponseBody = FString(Converted.Length(), Converted.Get());
+        }
+
+        // Approximate the transfer time of the (possibly truncated) body at the capped bandwidth
+        if (Settings.BandwidthKBps > 0.0f)
+        {
+            const float BodyKB = InOutRawBody.Num() / 1024.0f;
+            DelaySeconds += BodyKB / Settings.BandwidthKBps;
+        }
+    }
+
+    InOutResponse.ResponseTimeSeconds += DelaySeconds;
+    return DelaySeconds;
+}
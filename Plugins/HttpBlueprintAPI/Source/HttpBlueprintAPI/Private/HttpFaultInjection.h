@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+/**
+ * Latency distribution used by HttpBlueprint.Fault.LatencyDistribution
+ */
+enum class EHttpFaultLatencyDistribution : int32
+{
+    /** Always LatencyMs */
+    Fixed = 0,
+
+    /** Uniform in [LatencyMs - JitterMs, LatencyMs + JitterMs] */
+    Uniform = 1,
+
+    /** Normal with mean LatencyMs and standard deviation JitterMs */
+    Normal = 2,
+
+    /** Exponential with mean LatencyMs (long tail, mimics a congested backend) */
+    Exponential = 3
+};
+
+/**
+ * Fault and latency injection for resilience benchmarking
+ *
+ * Configured entirely through HttpBlueprint.Fault.* console variables. Before a request
+ * is sent it may be dropped (network failure) or answered with a synthetic status such
+ * as 503 or 429 without reaching the server. Real responses may be delayed by a latency
+ * distribution, throttled to a bandwidth cap and have their bodies truncated.
+ * HttpBlueprint.Fault.UrlFilter limits injection to matching URLs and
+ * HttpBlueprint.Fault.Seed makes runs reproducible.
+ *
+ * The console variables are only read on the game thread, when one changes: an immutable
+ * snapshot (with the status code list already parsed) is published with an atomic pointer
+ * swap, and request and completion paths on any thread read that snapshot.
+ */
+class FHttpFaultInjector
+{
+public:
+
+    static FHttpFaultInjector& Get();
+
+    /** True when HttpBlueprint.Fault.Enable is set */
+    bool IsEnabled() const;
+
+    /**
+     * Decide whether a request should fail before it is sent
+     *
+     * @param URL - Request URL, checked against the URL filter
+     * @param OutResponse - Synthetic failure response when a fault is injected
+     * @param OutDelaySeconds - Delay before the synthetic response should be delivered
+     * @return True if the request must not be sent
+     */
+    bool TryInjectRequestFault(const FString& URL, FHttpResponseData& OutResponse, float& OutDelaySeconds);
+
+    /**
+     * Apply latency, bandwidth throttling and truncation to a real response
+     * Truncation cuts the raw body and rebuilds ResponseBody from it, so everything read from either agrees.
+     *
+     * @param URL - Request URL, checked against the URL filter
+     * @param InOutResponse - Response to degrade
+     * @param InOutRawBody - Bytes of the response body, truncated with it
+     * @return Extra delay (seconds) to wait before delivering the response
+     */
+    float ApplyResponseFaults(const FString& URL, FHttpResponseData& InOutResponse, TArray<uint8>& InOutRawBody);
+
+    /** Rebuild the settings snapshot from the console variables and publish it (game thread) */
+    static void RefreshSettings();
+
+private:
+
+    /** Immutable copy of the HttpBlueprint.Fault.* console variables */
+    struct FSettings
+    {
+        bool bEnable = false;
+        FString UrlFilter;
+        int32 Seed = 0;
+        float LatencyMs = 0.0f;
+        float JitterMs = 0.0f;
+        EHttpFaultLatencyDistribution LatencyDistribution = EHttpFaultLatencyDistribution::Fixed;
+        float DropPercent = 0.0f;
+        float ErrorPercent = 0.0f;
+
+        /** HttpBlueprint.Fault.ErrorCodes, parsed; never empty */
+        TArray<int32> ErrorCodes;
+
+        float BandwidthKBps = 0.0f;
+        float TruncatePercent = 0.0f;
+    };
+
+    FHttpFaultInjector() = default;
+
+    /** Current snapshot. Lock-free; safe on any thread */
+    static const FSettings& GetSettings();
+
+    static bool MatchesFilter(const FSettings& Settings, const FString& URL);
+
+    /** Apply the snapshot's seed if it changed. Caller must hold RandomLock */
+    void UpdateSeed(const FSettings& Settings);
+
+    /** Roll a percentage (0-100) */
+    bool RollPercent(const FSettings& Settings, float Percent);
+
+    /** Sample the configured latency distribution, in seconds */
+    float SampleLatencySeconds(const FSettings& Settings);
+
+    /** Pick one of the configured synthetic status codes */
+    int32 PickErrorCode(const FSettings& Settings);
+
+    static const FSettings DefaultSettings;
+    static TAtomic<const FSettings*> CurrentSettings;
+
+    /** Every snapshot ever published, so a reference from GetSettings() never dangles. Game thread only */
+    static TArray<TUniquePtr<const FSettings>> PublishedSettings;
+
+    FCriticalSection RandomLock;
+    FRandomStream Random;
+    int32 AppliedSeed = INDEX_NONE;
+};
@@ -0,0 +1,285 @@
+#include "HttpFixtureStore.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpRequestSigning.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpMemoryTracker.h"
+#include "HttpPayloadCodec.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Tasks/Task.h"
+
+// =============================================================================
+// FIXTURE STORE
+// =============================================================================
+
+FHttpFixtureStore& FHttpFixtureStore::Get()
+{
+    static FHttpFixtureStore Instance;
+    return Instance;
+}
+
+EHttpFixtureMode FHttpFixtureStore::GetMode(const FHttpBlueprintRuntimeSettings& Settings)
+{
+    return (EHttpFixtureMode)Settings.FixtureMode;
+}
+
+FString FHttpFixtureStore::GetFixtureDirectory() const
+{
+    const FString& Directory = FHttpBlueprintRuntimeSettings::Get().FixtureDirectory;
+    return Directory.IsEmpty()
+        ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HttpFixtures"))
+        : Directory;
+}
+
+FString FHttpFixtureStore::GetFixturePath(const FString& Key) const
+{
+    return FPaths::Combine(GetFixtureDirectory(), Key + TEXT(".json"));
+}
+
+FString FHttpFixtureStore::MakeFixtureKey(const FString& Method, const FString& URL, const FString& Body)
+{
+    // Split off the fragment and query, lowercase scheme://host, and sort the query parameters
+    FString Normalized;
+    URL.Split(TEXT("#"), &Normalized, nullptr);
+    if (Normalized.IsEmpty())
+    {
+        Normalized = URL;
+    }
+
+    FString Base, Query;
+    if (!Normalized.Split(TEXT("?"), &Base, &Query))
+    {
+        Base = Normalized;
+    }
+
+    const int32 HostStart = Base.Find(TEXT("://"));
+    const int32 PathStart = HostStart >= 0 ? Base.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart + 3) : INDEX_NONE;
+    if (PathStart >= 0)
+    {
+        Base = Base.Left(PathStart).ToLower() + Base.RightChop(PathStart);
+    }
+    else
+    {
+        Base = Base.ToLower() + TEXT("/");
+    }
+
+    TArray<FString> Params;
+    Query.ParseIntoArray(Params, TEXT("&"), true);
+    Params.Sort([](const FString& A, const FString& B)
+        {
+            return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+        });
+
+    FHttpSha256 Hasher;
+    Hasher.UpdateString(Method.ToUpper());
+    Hasher.UpdateString(TEXT("\n"));
+    Hasher.UpdateString(Base);
+    Hasher.UpdateString(TEXT("?"));
+    Hasher.UpdateString(FString::Join(Params, TEXT("&")));
+    Hasher.UpdateString(TEXT("\n"));
+    Hasher.UpdateString(Body);
+
+    uint8 Digest[FHttpSha256::DigestSize];
+    Hasher.Final(Digest);
+
+    // 128 bits is plenty to keep fixture names unique
+    return FHttpSha256::ToHex(Digest, 16);
+}
+
+void FHttpFixtureStore::BeginExchange(uint32 RequestId, const FString& Method, const FString& URL, const FString& RequestBody)
+{
+    FString Key = MakeFixtureKey(Method, URL, RequestBody);
+
+    FScopeLock Lock(&PendingLock);
+    PendingKeys.Add(RequestId, MoveTemp(Key));
+    NumPending = PendingKeys.Num();
+}
+
+void FHttpFixtureStore::RecordExchange(const FHttpBlueprintRuntimeSettings& Settings, uint32 RequestId, const FHttpRequestPtr& Request,
+    const FHttpResponsePtr& Response, const FHttpResponseData& ResponseData)
+{
+    if (NumPending.Load(EMemoryOrder::Relaxed) == 0)
+    {
+        return;
+    }
+
+    FString Key;
+    {
+        FScopeLock Lock(&PendingLock);
+        if (!PendingKeys.RemoveAndCopyValue(RequestId, Key))
+        {
+            // Sent before recording started
+            return;
+        }
+        NumPending = PendingKeys.Num();
+    }
+
+    // Recording stopped while it was in flight
+    if (!IsRecording(Settings) || !Request.IsValid())
+    {
+        return;
+    }
+
+    const FString Method = Request->GetVerb();
+    const FString URL = Request->GetURL();
+    const FString FixturePath = GetFixturePath(Key);
+
+    // ResponseBody is the bytes read as UTF-8, which corrupts binary payloads; keep those as received
+    const bool bBinaryBody = FHttpPayloadCodec::GetResponseFormat(ResponseData) != EHttpPayloadFormat::Json;
+    TArray<uint8> RawBody;
+    if (bBinaryBody && Response.IsValid())
+    {
+        RawBody = Response->GetContent();
+    }
+
+    // Serialize and write off the completion thread
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [Method, URL, ResponseData, RawBody = MoveTemp(RawBody), bBinaryBody, FixturePath]()
+        {
+            TSharedRef<FJsonObject> Fixture = MakeShared<FJsonObject>();
+            Fixture->SetStringField(TEXT("method"), Method);
+            Fixture->SetStringField(TEXT("url"), URL);
+            Fixture->SetNumberField(TEXT("status"), ResponseData.ResponseCode);
+            Fixture->SetNumberField(TEXT("latencyMs"), ResponseData.ResponseTimeSeconds * 1000.0);
+            Fixture->SetStringField(TEXT("contentType"), ResponseData.ResponseHeaders.FindRef(TEXT("Content-Type")));
+            if (bBinaryBody)
+            {
+                Fixture->SetStringField(TEXT("body"), FBase64::Encode(RawBody));
+                Fixture->SetStringField(TEXT("encoding"), TEXT("base64"));
+            }
+            else
+            {
+                Fixture->SetStringField(TEXT("body"), ResponseData.ResponseBody);
+            }
+
+            TSharedRef<FJsonObject> Headers = MakeShared<FJsonObject>();
+            for (const auto& HeaderPair : ResponseData.ResponseHeaders)
+            {
+                Headers->SetStringField(HeaderPair.Key, HeaderPair.Value);
+            }
+            Fixture->SetObjectField(TEXT("headers"), Headers);
+
+            FString FixtureText;
+            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&FixtureText);
+            FJsonSerializer::Serialize(Fixture, Writer);
+
+            if (!FFileHelper::SaveStringToFile(FixtureText, *FixturePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+            {
+                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Could not write HTTP fixture: %s"), *FixturePath);
+            }
+        });
+}
+
+bool FHttpFixtureStore::LoadFixture(const FString& Method, const FString& URL, const FString& RequestBody,
+    FHttpResponseData& OutResponse, TArray<uint8>& OutRawBody, float& OutLatencySeconds)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+    const FString Key = MakeFixtureKey(Method, URL, RequestBody);
+
+    bool bFound = false;
+    {
+        FScopeLock Lock(&CacheLock);
+        if (const FLoadedFixture* Cached = LoadedFixtures.Find(Key))
+        {
+            OutResponse = Cached->Response;
+            OutRawBody = Cached->RawBody;
+            bFound = true;
+        }
+    }
+
+    if (!bFound)
+    {
+        FString FixtureText;
+        TSharedPtr<FJsonObject> Fixture;
+        const FString FixturePath = GetFixturePath(Key);
+
+        if (FFileHelper::LoadFileToString(FixtureText, *FixturePath) &&
+            FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FixtureText), Fixture) && Fixture.IsValid())
+        {
+            FLoadedFixture LoadedFixture;
+            FHttpResponseData& Loaded = LoadedFixture.Response;
+            Loaded.ResponseCode = (int32)Fixture->GetNumberField(TEXT("status"));
+            Loaded.ResponseTimeSeconds = (float)(Fixture->GetNumberField(TEXT("latencyMs")) / 1000.0);
+
+            // Binary bodies stay bytes until transcoded, as a live response's would
+            FString Encoding;
+            if (Fixture->TryGetStringField(TEXT("encoding"), Encoding) && Encoding == TEXT("base64"))
+            {
+                FBase64::Decode(Fixture->GetStringField(TEXT("body")), LoadedFixture.RawBody);
+            }
+            else
+            {
+                Loaded.ResponseBody = Fixture->GetStringField(TEXT("body"));
+            }
+
+            const TSharedPtr<FJsonObject>* Headers = nullptr;
+            if (Fixture->TryGetObjectField(TEXT("headers"), Headers))
+            {
+                for (const auto& HeaderPair : (*Headers)->Values)
+                {
+                    Loaded.ResponseHeaders.Add(HeaderPair.Key, HeaderPair.Value->AsString());
+                }
+            }
+
+            // The recorded Content-Type decides how the body is decoded, even if the headers lost it
+            FString ContentType;
+            if (Fixture->TryGetStringField(TEXT("contentType"), ContentType) && !ContentType.IsEmpty() &&
+                FHttpPayloadCodec::GetResponseFormat(Loaded) == EHttpPayloadFormat::Json)
+            {
+                Loaded.ResponseHeaders.Add(TEXT("Content-Type"), ContentType);
+            }
+
+            // Mirror ProcessHttpResponse so fixture responses look exactly like live ones
+            Loaded.bWasSuccessful = UHttpBlueprintFunctionLibrary::IsHttpResponseSuccessful(Loaded.ResponseCode);
+            Loaded.ErrorKind = Loaded.ResponseCode == 0
+                ? EHttpErrorKind::NetworkError
+                : UHttpBlueprintFunctionLibrary::GetHttpErrorKindForStatus(Loaded.ResponseCode);
+
+            const int64 LoadedBytes = FHttpMemoryTracker::GetBodyBytes(Loaded) + FHttpMemoryTracker::GetHeaderBytes(Loaded) +
+                LoadedFixture.RawBody.GetAllocatedSize();
+
+            FScopeLock Lock(&CacheLock);
+            int64 DeltaBytes = LoadedBytes;
+            if (const FLoadedFixture* Existing = LoadedFixtures.Find(Key))
+            {
+                // Loaded concurrently by another thread
+                DeltaBytes -= FHttpMemoryTracker::GetBodyBytes(Existing->Response) + FHttpMemoryTracker::GetHeaderBytes(Existing->Response) +
+                    Existing->RawBody.GetAllocatedSize();
+            }
+            const FLoadedFixture& Added = LoadedFixtures.Add(Key, MoveTemp(LoadedFixture));
+            OutResponse = Added.Response;
+            OutRawBody = Added.RawBody;
+            CachedBytes += DeltaBytes;
+            FHttpMemoryTracker::AddCacheBytes(DeltaBytes);
+            bFound = true;
+        }
+    }
+
+    if (!bFound)
+    {
+        OutResponse = FHttpResponseData();
+        OutRawBody.Reset();
+        OutResponse.SetError(EHttpErrorKind::FixtureMissing);
+        OutResponse.ErrorMessage = FString::Printf(TEXT("No HTTP fixture recorded for %s %s (expected %s)"),
+            *Method.ToUpper(), *URL, *GetFixturePath(Key));
+        OutLatencySeconds = 0.0f;
+        return false;
+    }
+
+    OutLatencySeconds = FHttpBlueprintRuntimeSettings::Get().bFixtureSimulateTiming ? OutResponse.ResponseTimeSeconds : 0.0f;
+    return true;
+}
+
+void FHttpFixtureStore::ClearCache()
+{
+    FScopeLock Lock(&CacheLock);
+    LoadedFixtures.Empty();
+    FHttpMemoryTracker::AddCacheBytes(-CachedBytes);
+    CachedBytes = 0;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+/**
+ * Fixture store operating mode (HttpBlueprint.Fixture.Mode)
+ */
+enum class EHttpFixtureMode : int32
+{
+    /** Requests go to the network as usual */
+    Off = 0,
+
+    /** Requests go to the network and every response is saved as a fixture */
+    Record = 1,
+
+    /** Requests are answered from fixtures only; nothing is sent */
+    Replay = 2
+};
+
+/**
+ * Record/replay fixtures for automation and performance tests
+ *
+ * Each fixture is a small JSON file named after a hash of the normalized request
+ * (method, URL with sorted query parameters, body). In replay mode requests never
+ * reach a socket: they are answered from the fixture directory, optionally after the
+ * recorded latency (HttpBlueprint.Fixture.SimulateTiming), or fail with an error
+ * naming the missing fixture.
+ *
+ * Mode and directory come from UHttpBlueprintSettings / HttpBlueprint.Fixture.*, or from
+ * the command line with -HttpFixtureMode=record|replay and -HttpFixtureDir=<Path>.
+ */
+class FHttpFixtureStore
+{
+public:
+
+    static FHttpFixtureStore& Get();
+
+    /** Mode in a settings snapshot; request paths pass the snapshot they already loaded */
+    static EHttpFixtureMode GetMode(const FHttpBlueprintRuntimeSettings& Settings);
+
+    static bool IsRecording(const FHttpBlueprintRuntimeSettings& Settings) { return GetMode(Settings) == EHttpFixtureMode::Record; }
+    static bool IsReplaying(const FHttpBlueprintRuntimeSettings& Settings) { return GetMode(Settings) == EHttpFixtureMode::Replay; }
+
+    /** Directory fixtures are read from and written to */
+    FString GetFixtureDirectory() const;
+
+    /**
+     * Build the normalized key identifying a request
+     * Scheme and host are lowercased, query parameters sorted and fragments dropped. Body is the
+     * caller's request body, before any payload encoding, so recording and replay agree.
+     */
+    static FString MakeFixtureKey(const FString& Method, const FString& URL, const FString& Body);
+
+    /**
+     * Remember the key of a request about to be sent while recording
+     * Built from the caller's body, which replay sees too; the bytes sent may be re-encoded or streamed from file.
+     */
+    void BeginExchange(uint32 RequestId, const FString& Method, const FString& URL, const FString& RequestBody);
+
+    /**
+     * Save a completed exchange begun with BeginExchange as a fixture (written on a worker thread)
+     * Called for every completion, so keys of requests still in flight when recording stops are released.
+     * Binary bodies (MessagePack, CBOR, Protobuf) are saved as the raw bytes received, base64 encoded.
+     */
+    void RecordExchange(const FHttpBlueprintRuntimeSettings& Settings, uint32 RequestId, const FHttpRequestPtr& Request,
+        const FHttpResponsePtr& Response, const FHttpResponseData& ResponseData);
+
+    /**
+     * Load the fixture for a request
+     * Safe to call from any thread; loaded fixtures are kept in memory for the session
+     *
+     * @param OutResponse - Recorded response, or an error response if no fixture exists
+     * @param OutRawBody - Recorded bytes of a binary body, to be transcoded like a live one (empty for text bodies)
+     * @param OutLatencySeconds - Recorded latency when timing simulation is enabled, otherwise 0
+     * @return True if a fixture was found
+     */
+    bool LoadFixture(const FString& Method, const FString& URL, const FString& RequestBody,
+        FHttpResponseData& OutResponse, TArray<uint8>& OutRawBody, float& OutLatencySeconds);
+
+    /** Forget fixtures cached in memory (e.g., after re-recording) */
+    void ClearCache();
+
+private:
+
+    FHttpFixtureStore() = default;
+
+    FString GetFixturePath(const FString& Key) const;
+
+    struct FLoadedFixture
+    {
+        FHttpResponseData Response;
+
+        /** Binary bodies only */
+        TArray<uint8> RawBody;
+    };
+
+    FCriticalSection CacheLock;
+    TMap<FString, FLoadedFixture> LoadedFixtures;
+
+    /** Bytes of LoadedFixtures charged to FHttpMemoryTracker's cache counter */
+    int64 CachedBytes = 0;
+
+    /** Fixture keys of requests in flight while recording, by request id */
+    FCriticalSection PendingLock;
+    TMap<uint32, FString> PendingKeys;
+
+    /** PendingKeys.Num(), read without the lock so completions skip it when nothing is being recorded */
+    TAtomic<int32> NumPending { 0 };
+};
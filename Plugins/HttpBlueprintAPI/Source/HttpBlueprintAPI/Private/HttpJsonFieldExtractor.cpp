@@ -0,0 +1,707 @@
+#include "HttpJsonFieldExtractor.h"
+
+// =============================================================================
+// WORD-AT-A-TIME SEARCH
+// =============================================================================
+
+namespace HttpJsonFieldExtractorDetail
+{
+    constexpr uint64 Ones = 0x0101010101010101ull;
+    constexpr uint64 Highs = 0x8080808080808080ull;
+
+    /**
+     * Sets the high bit of every byte of Word equal to Byte
+     * Bits above the first match may be false positives, so only the lowest set bit is used;
+     * that stays true for an OR of several masks.
+     */
+    FORCEINLINE uint64 MatchByte(uint64 Word, uint8 Byte)
+    {
+        const uint64 X = Word ^ (Ones * Byte);
+        return (X - Ones) & ~X & Highs;
+    }
+
+    FORCEINLINE uint64 LoadWord(const uint8* Ptr)
+    {
+        uint64 Word;
+        FMemory::Memcpy(&Word, Ptr, sizeof(Word));
+        return Word;
+    }
+
+    FORCEINLINE bool IsWhitespace(uint8 Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+    }
+
+    /** First '"' or '\' at or after Ptr, or End */
+    static const uint8* FindQuoteOrEscape(const uint8* Ptr, const uint8* End)
+    {
+#if PLATFORM_LITTLE_ENDIAN
+        while (End - Ptr >= 8)
+        {
+            const uint64 Word = LoadWord(Ptr);
+            const uint64 Mask = MatchByte(Word, '"') | MatchByte(Word, '\\');
+            if (Mask != 0)
+            {
+                return Ptr + (FMath::CountTrailingZeros64(Mask) >> 3);
+            }
+            Ptr += 8;
+        }
+#endif
+        while (Ptr < End && *Ptr != '"' && *Ptr != '\\')
+        {
+            ++Ptr;
+        }
+        return Ptr;
+    }
+
+    /** First '"', '{', '}', '[' or ']' at or after Ptr, or End */
+    static const uint8* FindStructural(const uint8* Ptr, const uint8* End)
+    {
+#if PLATFORM_LITTLE_ENDIAN
+        while (End - Ptr >= 8)
+        {
+            // Setting bit 5 folds '[' onto '{' and ']' onto '}', and nothing else onto either
+            const uint64 Word = LoadWord(Ptr);
+            const uint64 Folded = Word | (Ones * 0x20);
+            const uint64 Mask = MatchByte(Word, '"') | MatchByte(Folded, '{') | MatchByte(Folded, '}');
+            if (Mask != 0)
+            {
+                return Ptr + (FMath::CountTrailingZeros64(Mask) >> 3);
+            }
+            Ptr += 8;
+        }
+#endif
+        while (Ptr < End && *Ptr != '"' && (*Ptr | 0x20) != '{' && (*Ptr | 0x20) != '}')
+        {
+            ++Ptr;
+        }
+        return Ptr;
+    }
+
+    static bool ParseHex4(const uint8* Text, const uint8* TextEnd, uint32& OutValue)
+    {
+        if (TextEnd - Text < 4)
+        {
+            return false;
+        }
+
+        OutValue = 0;
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            const uint8 Char = Text[Index];
+            const uint32 Digit =
+                Char >= '0' && Char <= '9' ? Char - '0' :
+                Char >= 'a' && Char <= 'f' ? Char - 'a' + 10 :
+                Char >= 'A' && Char <= 'F' ? Char - 'A' + 10 : 16;
+            if (Digit > 15)
+            {
+                return false;
+            }
+            OutValue = (OutValue << 4) | Digit;
+        }
+        return true;
+    }
+
+    static void AppendUtf8(TArray<uint8>& Out, uint32 CodePoint)
+    {
+        if (CodePoint < 0x80)
+        {
+            Out.Add((uint8)CodePoint);
+        }
+        else if (CodePoint < 0x800)
+        {
+            Out.Add((uint8)(0xC0 | (CodePoint >> 6)));
+            Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            Out.Add((uint8)(0xE0 | (CodePoint >> 12)));
+            Out.Add((uint8)(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+        }
+        else
+        {
+            Out.Add((uint8)(0xF0 | (CodePoint >> 18)));
+            Out.Add((uint8)(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Out.Add((uint8)(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+
+    /** Decode the escapes of a JSON string body (without quotes) into UTF-8 */
+    static bool Unescape(const uint8* Text, const uint8* TextEnd, TArray<uint8>& Out)
+    {
+        Out.Reset(TextEnd - Text);
+        while (Text < TextEnd)
+        {
+            if (*Text != '\\')
+            {
+                Out.Add(*Text++);
+                continue;
+            }
+
+            if (++Text >= TextEnd)
+            {
+                return false;
+            }
+
+            switch (*Text++)
+            {
+            case '"':  Out.Add('"'); break;
+            case '\\': Out.Add('\\'); break;
+            case '/':  Out.Add('/'); break;
+            case 'b':  Out.Add('\b'); break;
+            case 'f':  Out.Add('\f'); break;
+            case 'n':  Out.Add('\n'); break;
+            case 'r':  Out.Add('\r'); break;
+            case 't':  Out.Add('\t'); break;
+            case 'u':
+            {
+                uint32 CodePoint = 0;
+                if (!ParseHex4(Text, TextEnd, CodePoint))
+                {
+                    return false;
+                }
+                Text += 4;
+
+                // Surrogate pair
+                uint32 Low = 0;
+                if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && TextEnd - Text >= 6 &&
+                    Text[0] == '\\' && Text[1] == 'u' && ParseHex4(Text + 2, TextEnd, Low) && Low >= 0xDC00 && Low <= 0xDFFF)
+                {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                    Text += 6;
+                }
+                AppendUtf8(Out, CodePoint);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static FString ToFString(const uint8* Text, int32 Length)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text), Length);
+        return FString(Converted.Length(), Converted.Get());
+    }
+}
+
+// =============================================================================
+// SCANNER
+// =============================================================================
+
+struct FHttpJsonFieldExtractor::FScanner
+{
+    const FHttpJsonFieldExtractor& Extractor;
+    const uint8* Begin;
+    const uint8* Cur;
+    const uint8* End;
+    TArray<FHttpJsonFieldValue>& Values;
+
+    /** Path nodes still to be found; the scan stops at zero */
+    int32 Remaining;
+
+    FString Error;
+
+    FScanner(const FHttpJsonFieldExtractor& InExtractor, TArrayView<const uint8> Json, TArray<FHttpJsonFieldValue>& OutValues)
+        : Extractor(InExtractor)
+        , Begin(Json.GetData())
+        , Cur(Json.GetData())
+        , End(Json.GetData() + Json.Num())
+        , Values(OutValues)
+        , Remaining(InExtractor.NumTerminalNodes)
+    {
+    }
+
+    bool Fail(const TCHAR* Message)
+    {
+        if (Error.IsEmpty())
+        {
+            Error = FString::Printf(TEXT("%s at offset %d"), Message, (int32)(FMath::Min(Cur, End) - Begin));
+        }
+        return false;
+    }
+
+    void SkipWhitespace()
+    {
+        while (Cur < End && HttpJsonFieldExtractorDetail::IsWhitespace(*Cur))
+        {
+            ++Cur;
+        }
+    }
+
+    /** Cur is on the opening quote; leaves Cur after the closing quote */
+    bool SkipString(bool* bOutHasEscape = nullptr)
+    {
+        ++Cur;
+        for (;;)
+        {
+            Cur = HttpJsonFieldExtractorDetail::FindQuoteOrEscape(Cur, End);
+            if (Cur >= End)
+            {
+                return Fail(TEXT("Unterminated string"));
+            }
+            if (*Cur == '"')
+            {
+                ++Cur;
+                return true;
+            }
+
+            // Step over the backslash and the character it escapes
+            if (bOutHasEscape)
+            {
+                *bOutHasEscape = true;
+            }
+            Cur += 2;
+        }
+    }
+
+    /** Skip a value that is not on any requested path; its contents are not validated */
+    bool SkipValue()
+    {
+        SkipWhitespace();
+        if (Cur >= End)
+        {
+            return Fail(TEXT("Unexpected end of JSON"));
+        }
+
+        const uint8 First = *Cur;
+        if (First == '"')
+        {
+            return SkipString();
+        }
+
+        if (First == '{' || First == '[')
+        {
+            int32 Depth = 0;
+            for (;;)
+            {
+                Cur = HttpJsonFieldExtractorDetail::FindStructural(Cur, End);
+                if (Cur >= End)
+                {
+                    return Fail(TEXT("Unterminated object or array"));
+                }
+
+                const uint8 Char = *Cur;
+                if (Char == '"')
+                {
+                    if (!SkipString())
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                ++Cur;
+                if (Char == '{' || Char == '[')
+                {
+                    ++Depth;
+                }
+                else if (--Depth == 0)
+                {
+                    return true;
+                }
+            }
+        }
+
+        // Number or literal
+        const uint8* ValueBegin = Cur;
+        while (Cur < End && *Cur != ',' && *Cur != '}' && *Cur != ']' && !HttpJsonFieldExtractorDetail::IsWhitespace(*Cur))
+        {
+            ++Cur;
+        }
+        return Cur > ValueBegin || Fail(TEXT("Expected a value"));
+    }
+
+    bool ReadValue(int32 NodeIndex)
+    {
+        SkipWhitespace();
+        if (Cur >= End)
+        {
+            return Fail(TEXT("Unexpected end of JSON"));
+        }
+
+        const FNode& Node = Extractor.Nodes[NodeIndex];
+        const uint8* ValueBegin = Cur;
+
+        bool bRead;
+        if (Node.Children.Num() > 0 && *Cur == '{')
+        {
+            bRead = ReadObject(NodeIndex);
+        }
+        else if (Node.Children.Num() > 0 && *Cur == '[')
+        {
+            bRead = ReadArray(NodeIndex);
+        }
+        else
+        {
+            bRead = SkipValue();
+        }
+
+        if (bRead && Node.PathIndices.Num() > 0)
+        {
+            Store(Node, ValueBegin, Cur);
+        }
+        return bRead;
+    }
+
+    bool ReadObject(int32 NodeIndex)
+    {
+        ++Cur;
+        SkipWhitespace();
+        if (Cur < End && *Cur == '}')
+        {
+            ++Cur;
+            return true;
+        }
+
+        for (;;)
+        {
+            SkipWhitespace();
+            if (Cur >= End || *Cur != '"')
+            {
+                return Fail(TEXT("Expected an object key"));
+            }
+
+            const uint8* KeyBegin = Cur + 1;
+            bool bHasEscape = false;
+            if (!SkipString(&bHasEscape))
+            {
+                return false;
+            }
+            const int32 Child = FindKeyChild(NodeIndex, KeyBegin, Cur - 1, bHasEscape);
+
+            SkipWhitespace();
+            if (Cur >= End || *Cur != ':')
+            {
+                return Fail(TEXT("Expected ':'"));
+            }
+            ++Cur;
+
+            if (!(Child != INDEX_NONE ? ReadValue(Child) : SkipValue()))
+            {
+                return false;
+            }
+            if (Remaining == 0)
+            {
+                return true;
+            }
+
+            SkipWhitespace();
+            if (Cur < End && *Cur == ',')
+            {
+                ++Cur;
+                continue;
+            }
+            if (Cur < End && *Cur == '}')
+            {
+                ++Cur;
+                return true;
+            }
+            return Fail(TEXT("Expected ',' or '}'"));
+        }
+    }
+
+    bool ReadArray(int32 NodeIndex)
+    {
+        ++Cur;
+        SkipWhitespace();
+        if (Cur < End && *Cur == ']')
+        {
+            ++Cur;
+            return true;
+        }
+
+        for (int32 ElementIndex = 0;; ++ElementIndex)
+        {
+            const int32 Child = FindIndexChild(NodeIndex, ElementIndex);
+            if (!(Child != INDEX_NONE ? ReadValue(Child) : SkipValue()))
+            {
+                return false;
+            }
+            if (Remaining == 0)
+            {
+                return true;
+            }
+
+            SkipWhitespace();
+            if (Cur < End && *Cur == ',')
+            {
+                ++Cur;
+                continue;
+            }
+            if (Cur < End && *Cur == ']')
+            {
+                ++Cur;
+                return true;
+            }
+            return Fail(TEXT("Expected ',' or ']'"));
+        }
+    }
+
+    int32 FindKeyChild(int32 NodeIndex, const uint8* KeyBegin, const uint8* KeyEnd, bool bHasEscape) const
+    {
+        TArray<uint8> Unescaped;
+        if (bHasEscape)
+        {
+            if (!HttpJsonFieldExtractorDetail::Unescape(KeyBegin, KeyEnd, Unescaped))
+            {
+                return INDEX_NONE;
+            }
+            KeyBegin = Unescaped.GetData();
+            KeyEnd = KeyBegin + Unescaped.Num();
+        }
+
+        const int32 KeyLength = (int32)(KeyEnd - KeyBegin);
+        for (const int32 Child : Extractor.Nodes[NodeIndex].Children)
+        {
+            const TArray<uint8>& Key = Extractor.Nodes[Child].Key;
+            if (Extractor.Nodes[Child].Index == INDEX_NONE && Key.Num() == KeyLength &&
+                FMemory::Memcmp(Key.GetData(), KeyBegin, KeyLength) == 0)
+            {
+                return Child;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    int32 FindIndexChild(int32 NodeIndex, int32 ElementIndex) const
+    {
+        for (const int32 Child : Extractor.Nodes[NodeIndex].Children)
+        {
+            if (Extractor.Nodes[Child].Index == ElementIndex)
+            {
+                return Child;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    void Store(const FNode& Node, const uint8* ValueBegin, const uint8* ValueEnd)
+    {
+        using namespace HttpJsonFieldExtractorDetail;
+
+        // Duplicate keys: the first occurrence wins
+        if (Values[Node.PathIndices[0]].IsFound())
+        {
+            return;
+        }
+
+        FHttpJsonFieldValue Value;
+        switch (*ValueBegin)
+        {
+        case '"':
+        {
+            TArray<uint8> Unescaped;
+            Value.Type = EHttpJsonValueType::String;
+            Value.Text = Unescape(ValueBegin + 1, ValueEnd - 1, Unescaped)
+                ? ToFString(Unescaped.GetData(), Unescaped.Num())
+                : ToFString(ValueBegin + 1, (int32)(ValueEnd - ValueBegin) - 2);
+            break;
+        }
+        case '{':
+            Value.Type = EHttpJsonValueType::Object;
+            Value.Text = ToFString(ValueBegin, (int32)(ValueEnd - ValueBegin));
+            break;
+        case '[':
+            Value.Type = EHttpJsonValueType::Array;
+            Value.Text = ToFString(ValueBegin, (int32)(ValueEnd - ValueBegin));
+            break;
+        case 't':
+        case 'f':
+            Value.Type = EHttpJsonValueType::Bool;
+            Value.Number = *ValueBegin == 't' ? 1.0 : 0.0;
+            Value.Text = *ValueBegin == 't' ? TEXT("true") : TEXT("false");
+            break;
+        case 'n':
+            Value.Type = EHttpJsonValueType::Null;
+            Value.Text = TEXT("null");
+            break;
+        default:
+            Value.Type = EHttpJsonValueType::Number;
+            Value.Text = ToFString(ValueBegin, (int32)(ValueEnd - ValueBegin));
+            Value.Number = FCString::Atod(*Value.Text);
+            break;
+        }
+
+        for (const int32 PathIndex : Node.PathIndices)
+        {
+            Values[PathIndex] = Value;
+        }
+        --Remaining;
+    }
+};
+
+// =============================================================================
+// FIELD EXTRACTOR
+// =============================================================================
+
+FHttpJsonFieldExtractor::FHttpJsonFieldExtractor(const TArray<FString>& InPaths)
+    : Paths(InPaths)
+{
+    Nodes.AddDefaulted();
+    for (int32 PathIndex = 0; PathIndex < Paths.Num() && IsValid(); ++PathIndex)
+    {
+        CompilePath(PathIndex);
+    }
+}
+
+bool FHttpJsonFieldExtractor::CompilePath(int32 PathIndex)
+{
+    const FString& Path = Paths[PathIndex];
+    auto Fail = [this, &Path](const TCHAR* Reason)
+        {
+            Error = FString::Printf(TEXT("Invalid JSON path '%s': %s"), *Path, Reason);
+            return false;
+        };
+
+    int32 Pos = 0;
+    const int32 Length = Path.Len();
+    if (Pos < Length && Path[Pos] == TEXT('$'))
+    {
+        ++Pos;
+    }
+
+    auto ReadName = [&Path, &Pos, Length]()
+        {
+            const int32 NameBegin = Pos;
+            while (Pos < Length && Path[Pos] != TEXT('.') && Path[Pos] != TEXT('['))
+            {
+                ++Pos;
+            }
+            return Path.Mid(NameBegin, Pos - NameBegin);
+        };
+
+    auto ToUtf8 = [](const FString& Key)
+        {
+            FTCHARToUTF8 Utf8(*Key);
+            return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        };
+
+    int32 Node = 0;
+    bool bFirstSegment = true;
+    while (Pos < Length)
+    {
+        const TCHAR Char = Path[Pos];
+        if (Char == TEXT('['))
+        {
+            ++Pos;
+            if (Pos < Length && (Path[Pos] == TEXT('\'') || Path[Pos] == TEXT('"')))
+            {
+                // ['key with.dots']
+                const TCHAR Quote = Path[Pos++];
+                const int32 KeyEnd = Path.Find(FString(1, &Quote), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+                if (KeyEnd == INDEX_NONE || KeyEnd + 1 >= Length || Path[KeyEnd + 1] != TEXT(']'))
+                {
+                    return Fail(TEXT("unterminated quoted key"));
+                }
+                Node = FindOrAddChild(Node, ToUtf8(Path.Mid(Pos, KeyEnd - Pos)), INDEX_NONE);
+                Pos = KeyEnd + 2;
+            }
+            else
+            {
+                int32 Index = 0;
+                const int32 DigitsBegin = Pos;
+                while (Pos < Length && FChar::IsDigit(Path[Pos]))
+                {
+                    Index = Index * 10 + (Path[Pos++] - TEXT('0'));
+                }
+                if (Pos == DigitsBegin || Pos >= Length || Path[Pos] != TEXT(']'))
+                {
+                    return Fail(TEXT("array index must be a number"));
+                }
+                Node = FindOrAddChild(Node, TArray<uint8>(), Index);
+                ++Pos;
+            }
+        }
+        else if (Char == TEXT('.') || bFirstSegment)
+        {
+            if (Char == TEXT('.'))
+            {
+                ++Pos;
+            }
+            const FString Name = ReadName();
+            if (Name.IsEmpty())
+            {
+                return Fail(TEXT("empty field name"));
+            }
+            Node = FindOrAddChild(Node, ToUtf8(Name), INDEX_NONE);
+        }
+        else
+        {
+            return Fail(TEXT("expected '.' or '['"));
+        }
+        bFirstSegment = false;
+    }
+
+    if (Nodes[Node].PathIndices.Num() == 0)
+    {
+        ++NumTerminalNodes;
+    }
+    Nodes[Node].PathIndices.Add(PathIndex);
+    return true;
+}
+
+int32 FHttpJsonFieldExtractor::FindOrAddChild(int32 Parent, TArray<uint8>&& Key, int32 Index)
+{
+    for (const int32 Child : Nodes[Parent].Children)
+    {
+        if (Nodes[Child].Index == Index && Nodes[Child].Key == Key)
+        {
+            return Child;
+        }
+    }
+
+    const int32 Child = Nodes.AddDefaulted();
+    Nodes[Child].Key = MoveTemp(Key);
+    Nodes[Child].Index = Index;
+    Nodes[Parent].Children.Add(Child);
+    return Child;
+}
+
+bool FHttpJsonFieldExtractor::Extract(TArrayView<const uint8> Json, TArray<FHttpJsonFieldValue>& OutValues, FString& OutError) const
+{
+    OutValues.Reset();
+    OutValues.SetNum(Paths.Num());
+
+    if (!IsValid())
+    {
+        OutError = Error;
+        return false;
+    }
+    if (NumTerminalNodes == 0)
+    {
+        return true;
+    }
+
+    FScanner Scanner(*this, Json, OutValues);
+    if (!Scanner.ReadValue(0))
+    {
+        OutError = Scanner.Error;
+        return false;
+    }
+    return true;
+}
+
+bool FHttpJsonFieldExtractor::Extract(TArrayView<const uint8> Json, TMap<FString, FString>& OutValues) const
+{
+    TArray<FHttpJsonFieldValue> Values;
+    FString ScanError;
+    bool bAllFound = Extract(Json, Values, ScanError);
+
+    for (int32 PathIndex = 0; PathIndex < Values.Num(); ++PathIndex)
+    {
+        if (Values[PathIndex].IsFound())
+        {
+            OutValues.Add(Paths[PathIndex], MoveTemp(Values[PathIndex].Text));
+        }
+        else
+        {
+            bAllFound = false;
+        }
+    }
+    return bAllFound;
+}
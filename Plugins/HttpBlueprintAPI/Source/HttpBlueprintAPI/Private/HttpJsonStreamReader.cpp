@@ -0,0 +1,316 @@
+#include "HttpJsonStreamReader.h"
+#include "HttpMemoryTracker.h"
+#include "Serialization/Archive.h"
+
+// =============================================================================
+// ELEMENT BATCH
+// =============================================================================
+
+FString FHttpJsonElementBatch::GetElementString(int32 Index) const
+{
+    const TArrayView<const uint8> Element = GetElement(Index);
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Element.GetData()), Element.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+// =============================================================================
+// RECEIVE ARCHIVE
+// =============================================================================
+
+namespace HttpJsonStreamReaderDetail
+{
+    /** Write-only archive the HTTP module streams the response body into */
+    class FReceiveArchive : public FArchive
+    {
+    public:
+
+        explicit FReceiveArchive(const TSharedRef<FHttpJsonStreamReader>& InReader)
+            : Reader(InReader)
+        {
+            SetIsSaving(true);
+            SetIsPersistent(false);
+        }
+
+        virtual void Serialize(void* Data, int64 Length) override
+        {
+            Reader->Feed(static_cast<const uint8*>(Data), Length);
+        }
+
+        virtual FString GetArchiveName() const override
+        {
+            return TEXT("HttpJsonStreamReader");
+        }
+
+    private:
+
+        TSharedRef<FHttpJsonStreamReader> Reader;
+    };
+}
+
+TSharedRef<FArchive> FHttpJsonStreamReader::CreateReceiveArchive(const TSharedRef<FHttpJsonStreamReader>& Reader)
+{
+    return MakeShared<HttpJsonStreamReaderDetail::FReceiveArchive>(Reader);
+}
+
+// =============================================================================
+// STREAM READER
+// =============================================================================
+
+FHttpJsonStreamReader::FHttpJsonStreamReader(const FString& ArrayField, int32 InBatchSize, FBatchHandler&& InOnBatch)
+    : BatchSize(FMath::Max(1, InBatchSize))
+    , OnBatch(MoveTemp(InOnBatch))
+{
+    FTCHARToUTF8 FieldUtf8(*ArrayField);
+    ArrayFieldUtf8.Append(reinterpret_cast<const uint8*>(FieldUtf8.Get()), FieldUtf8.Length());
+}
+
+bool FHttpJsonStreamReader::IsTargetArray() const
+{
+    // Called right after entering a '[' at the new depth
+    if (bArrayFound)
+    {
+        return false;
+    }
+    return ArrayFieldUtf8.Num() == 0
+        ? Depth == 1
+        : Depth == 2 && CurrentKey == ArrayFieldUtf8;
+}
+
+void FHttpJsonStreamReader::Feed(const uint8* Data, int64 Length)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+    if (HasError())
+    {
+        return;
+    }
+
+    // Element text is copied in runs rather than byte by byte
+    int64 CaptureFrom = IsCapturing() ? 0 : INDEX_NONE;
+    auto AppendCapture = [this, Data, &CaptureFrom](int64 EndIndex)
+        {
+            Batch.Data.Append(Data + CaptureFrom, (int32)(EndIndex - CaptureFrom));
+            CaptureFrom = INDEX_NONE;
+        };
+
+    for (int64 Index = 0; Index < Length; ++Index)
+    {
+        const uint8 Char = Data[Index];
+
+        if (bInString)
+        {
+            if (bEscape)
+            {
+                bEscape = false;
+            }
+            else if (Char == '\\')
+            {
+                bEscape = true;
+            }
+            else if (Char == '"')
+            {
+                bInString = false;
+                if (bReadingKey)
+                {
+                    bReadingKey = false;
+                }
+                else if (IsCapturing() && bScalarElement)
+                {
+                    AppendCapture(Index + 1);
+                    EndElement();
+                }
+                continue;
+            }
+
+            if (bReadingKey)
+            {
+                CurrentKey.Add(Char);
+            }
+            continue;
+        }
+
+        // Numbers and literals end at the first delimiter, which is then processed normally
+        if (IsCapturing() && bScalarElement &&
+            (Char == ',' || Char == ']' || Char == '}' || Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r'))
+        {
+            AppendCapture(Index);
+            EndElement();
+        }
+
+        const bool bAtElementStart = ElementDepth != INDEX_NONE && Depth == ElementDepth && !IsCapturing();
+
+        switch (Char)
+        {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+        case ':':
+            if (Char == ':' && Depth == 1)
+            {
+                bExpectKey = false;
+            }
+            break;
+
+        case ',':
+            if (Depth == 1)
+            {
+                bExpectKey = true;
+            }
+            break;
+
+        case '"':
+            bInString = true;
+            if (bAtElementStart)
+            {
+                BeginElement(true);
+                CaptureFrom = Index;
+            }
+            else if (Depth == 1 && bExpectKey && !bArrayFound)
+            {
+                bReadingKey = true;
+                CurrentKey.Reset();
+            }
+            break;
+
+        case '{':
+        case '[':
+            if (bAtElementStart)
+            {
+                BeginElement(false);
+                CaptureFrom = Index;
+            }
+
+            if (++Depth > MaxDepth)
+            {
+                SetError(TEXT("JSON nested too deeply"));
+                return;
+            }
+
+            if (Char == '{' && Depth == 1)
+            {
+                bExpectKey = true;
+            }
+            else if (Char == '[' && IsTargetArray())
+            {
+                bArrayFound = true;
+                ElementDepth = Depth;
+            }
+            break;
+
+        case '}':
+        case ']':
+            if (Char == ']' && bAtElementStart)
+            {
+                // End of the target array; everything after it is skipped
+                ElementDepth = INDEX_NONE;
+                bArrayDone = true;
+                FlushBatch();
+            }
+
+            if (--Depth < 0)
+            {
+                SetError(TEXT("Unbalanced JSON brackets"));
+                return;
+            }
+
+            if (IsCapturing() && !bScalarElement && Depth == ElementDepth)
+            {
+                AppendCapture(Index + 1);
+                EndElement();
+            }
+            break;
+
+        default:
+            if (bAtElementStart)
+            {
+                BeginElement(true);
+                CaptureFrom = Index;
+            }
+            break;
+        }
+    }
+
+    if (CaptureFrom != INDEX_NONE)
+    {
+        AppendCapture(Length);
+    }
+    PeakBufferedBytes = FMath::Max(PeakBufferedBytes, (int64)Batch.Data.Num());
+}
+
+void FHttpJsonStreamReader::Finish()
+{
+    if (!HasError())
+    {
+        // A number at the very end of the body has no delimiter after it
+        if (IsCapturing() && bScalarElement && !bInString)
+        {
+            EndElement();
+        }
+
+        if (!bArrayFound)
+        {
+            SetError(ArrayFieldUtf8.Num() == 0
+                ? FString(TEXT("Response body is not a JSON array"))
+                : FString::Printf(TEXT("Response has no array field '%s'"), UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(ArrayFieldUtf8.GetData()))));
+        }
+        else if (!bArrayDone)
+        {
+            SetError(FString::Printf(TEXT("Response ended inside the JSON array after %d elements"), NumElements));
+        }
+    }
+
+    FlushBatch();
+}
+
+void FHttpJsonStreamReader::BeginElement(bool bScalar)
+{
+    ElementStart = Batch.Data.Num();
+    bScalarElement = bScalar;
+}
+
+void FHttpJsonStreamReader::EndElement()
+{
+    Batch.Elements.Emplace(ElementStart, Batch.Data.Num() - ElementStart);
+    ElementStart = INDEX_NONE;
+    ++NumElements;
+
+    if (Batch.Elements.Num() >= BatchSize)
+    {
+        FlushBatch();
+    }
+}
+
+void FHttpJsonStreamReader::FlushBatch()
+{
+    if (Batch.Elements.Num() == 0)
+    {
+        return;
+    }
+
+    PeakBufferedBytes = FMath::Max(PeakBufferedBytes, (int64)Batch.Data.Num());
+    Batch.FirstIndex = NumElements - Batch.Elements.Num();
+
+    // Keep the partial element (if any) for the next batch
+    FHttpJsonElementBatch Full = MoveTemp(Batch);
+    Batch = FHttpJsonElementBatch();
+    if (IsCapturing())
+    {
+        Batch.Data.Append(Full.Data.GetData() + ElementStart, Full.Data.Num() - ElementStart);
+        Full.Data.SetNum(ElementStart, EAllowShrinking::No);
+        ElementStart = 0;
+    }
+
+    if (OnBatch)
+    {
+        OnBatch(MoveTemp(Full));
+    }
+}
+
+void FHttpJsonStreamReader::SetError(const FString& Message)
+{
+    if (Error.IsEmpty())
+    {
+        Error = Message;
+    }
+}
@@ -0,0 +1,60 @@
+#include "HttpLoopbackRouter.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+
+namespace HttpLoopbackRouterDetail
+{
+    static const TCHAR* ListenersSection = TEXT("HTTPServer.Listeners");
+
+    /** Bind address of a port's ListenerOverrides entry, parsed the way the HTTP server reads it */
+    static bool FindOverride(const TArray<FString>& Overrides, uint32 Port, FString& OutBindAddress)
+    {
+        for (FString Override : Overrides)
+        {
+            Override.TrimStartAndEndInline();
+            Override.RemoveFromStart(TEXT("("));
+            Override.RemoveFromEnd(TEXT(")"));
+
+            uint32 OverridePort = 0;
+            if (FParse::Value(*Override, TEXT("Port="), OverridePort) && OverridePort == Port)
+            {
+                OutBindAddress = TEXT("any");
+                FParse::Value(*Override, TEXT("BindAddress="), OutBindAddress);
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TSharedPtr<IHttpRouter> FHttpLoopbackRouter::Get(uint32 Port, FString& OutBindAddress)
+{
+    using namespace HttpLoopbackRouterDetail;
+
+    TArray<FString> Overrides;
+    GConfig->GetArray(ListenersSection, TEXT("ListenerOverrides"), Overrides, GEngineIni);
+
+    if (!FindOverride(Overrides, Port, OutBindAddress))
+    {
+        // Only read when the listener starts, so this must happen before the router is created
+        OutBindAddress = TEXT("127.0.0.1");
+        Overrides.Add(FString::Printf(TEXT("(Port=%u,BindAddress=%s)"), Port, *OutBindAddress));
+        GConfig->SetArray(ListenersSection, TEXT("ListenerOverrides"), Overrides, GEngineIni);
+    }
+    else if (!IsLoopbackAddress(OutBindAddress))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Port %u is configured to bind to %s and is reachable from other machines"), Port, *OutBindAddress);
+    }
+
+    return FHttpServerModule::Get().GetHttpRouter(Port, /*bFailOnBindFailure*/ true);
+}
+
+bool FHttpLoopbackRouter::IsLoopbackAddress(const FString& BindAddress)
+{
+    return BindAddress.Equals(TEXT("localhost"), ESearchCase::IgnoreCase) ||
+        BindAddress.StartsWith(TEXT("127.")) ||
+        BindAddress == TEXT("::1");
+}
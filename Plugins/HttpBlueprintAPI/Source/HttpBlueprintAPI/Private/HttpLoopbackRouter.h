@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IHttpRouter;
+
+/**
+ * HTTP server routers that only accept connections from this machine
+ *
+ * The engine HTTP server binds every listener to [HTTPServer.Listeners] DefaultBindAddress
+ * (all interfaces unless configured). Before a port's listener is created, a ListenerOverrides
+ * entry binding it to 127.0.0.1 is added to the in-memory engine config. A project that
+ * configures the port itself keeps its bind address, and gets a warning if it is not loopback.
+ * A port whose listener already exists (e.g., shared with another plugin) keeps its address.
+ */
+class FHttpLoopbackRouter
+{
+public:
+
+    /**
+     * Get the router of a port, binding a new listener to loopback
+     *
+     * @param Port - Port to listen on
+     * @param OutBindAddress - Address the port's listener is configured to bind to
+     * @return Router, or null if the port cannot be bound
+     */
+    static TSharedPtr<IHttpRouter> Get(uint32 Port, FString& OutBindAddress);
+
+    /** Whether a listener bind address only accepts local connections */
+    static bool IsLoopbackAddress(const FString& BindAddress);
+};
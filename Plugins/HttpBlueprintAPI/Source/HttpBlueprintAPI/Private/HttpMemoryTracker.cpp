@@ -0,0 +1,182 @@
+#include "HttpMemoryTracker.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpBlueprintStats.h"
+#include "HAL/IConsoleManager.h"
+
+LLM_DEFINE_TAG(HttpBlueprintAPI);
+
+DEFINE_STAT(STAT_HttpLiveBodyBytes);
+DEFINE_STAT(STAT_HttpLiveHeaderBytes);
+DEFINE_STAT(STAT_HttpCacheBytes);
+DEFINE_STAT(STAT_HttpRequestsInFlight);
+
+// =============================================================================
+// COUNTERS
+// =============================================================================
+
+namespace HttpMemoryTrackerDetail
+{
+    struct FCounter
+    {
+        TAtomic<int64> Current { 0 };
+        TAtomic<int64> Peak { 0 };
+
+        int64 Add(int64 Delta)
+        {
+            const int64 Value = Current.AddExchange(Delta) + Delta;
+
+            int64 PeakValue = Peak.Load(EMemoryOrder::Relaxed);
+            while (Value > PeakValue && !Peak.CompareExchange(PeakValue, Value))
+            {
+            }
+            return Value;
+        }
+    };
+
+    static FCounter BodyBytes;
+    static FCounter HeaderBytes;
+    static FCounter CacheBytes;
+    static FCounter RequestsInFlight;
+}
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpMemoryTrackerCommands
+{
+    static FAutoConsoleCommand ReportCommand(
+        TEXT("HttpBlueprint.Memory.Report"),
+        TEXT("Print memory held by HTTP Blueprint API requests, responses and caches (current and peak)."),
+        FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+            {
+                const FHttpMemoryTracker::FSnapshot Snapshot = FHttpMemoryTracker::GetSnapshot();
+                Ar.Logf(TEXT("HTTP Blueprint API memory (current / peak):"));
+                Ar.Logf(TEXT("  Live body bytes    %12lld / %12lld"), Snapshot.BodyBytes, Snapshot.PeakBodyBytes);
+                Ar.Logf(TEXT("  Live header bytes  %12lld / %12lld"), Snapshot.HeaderBytes, Snapshot.PeakHeaderBytes);
+                Ar.Logf(TEXT("  Cache bytes        %12lld / %12lld"), Snapshot.CacheBytes, Snapshot.PeakCacheBytes);
+                Ar.Logf(TEXT("  Requests in flight %12d / %12d"), Snapshot.RequestsInFlight, Snapshot.PeakRequestsInFlight);
+            }));
+
+    static FAutoConsoleCommand ResetPeaksCommand(
+        TEXT("HttpBlueprint.Memory.ResetPeaks"),
+        TEXT("Reset the peaks printed by HttpBlueprint.Memory.Report to the current values."),
+        FConsoleCommandDelegate::CreateStatic(&FHttpMemoryTracker::ResetPeaks));
+}
+
+// =============================================================================
+// MEMORY TRACKER
+// =============================================================================
+
+void FHttpMemoryTracker::AddBodyBytes(int64 Delta)
+{
+    const int64 Value = HttpMemoryTrackerDetail::BodyBytes.Add(Delta);
+    SET_MEMORY_STAT(STAT_HttpLiveBodyBytes, Value);
+}
+
+void FHttpMemoryTracker::AddHeaderBytes(int64 Delta)
+{
+    const int64 Value = HttpMemoryTrackerDetail::HeaderBytes.Add(Delta);
+    SET_MEMORY_STAT(STAT_HttpLiveHeaderBytes, Value);
+}
+
+void FHttpMemoryTracker::AddCacheBytes(int64 Delta)
+{
+    const int64 Value = HttpMemoryTrackerDetail::CacheBytes.Add(Delta);
+    SET_MEMORY_STAT(STAT_HttpCacheBytes, Value);
+}
+
+void FHttpMemoryTracker::AddRequestsInFlight(int32 Delta)
+{
+    const int64 Value = HttpMemoryTrackerDetail::RequestsInFlight.Add(Delta);
+    SET_DWORD_STAT(STAT_HttpRequestsInFlight, (uint32)FMath::Max<int64>(Value, 0));
+}
+
+FHttpMemoryTracker::FSnapshot FHttpMemoryTracker::GetSnapshot()
+{
+    using namespace HttpMemoryTrackerDetail;
+
+    FSnapshot Snapshot;
+    Snapshot.BodyBytes = BodyBytes.Current.Load(EMemoryOrder::Relaxed);
+    Snapshot.HeaderBytes = HeaderBytes.Current.Load(EMemoryOrder::Relaxed);
+    Snapshot.CacheBytes = CacheBytes.Current.Load(EMemoryOrder::Relaxed);
+    Snapshot.RequestsInFlight = (int32)RequestsInFlight.Current.Load(EMemoryOrder::Relaxed);
+    Snapshot.PeakBodyBytes = BodyBytes.Peak.Load(EMemoryOrder::Relaxed);
+    Snapshot.PeakHeaderBytes = HeaderBytes.Peak.Load(EMemoryOrder::Relaxed);
+    Snapshot.PeakCacheBytes = CacheBytes.Peak.Load(EMemoryOrder::Relaxed);
+    Snapshot.PeakRequestsInFlight = (int32)RequestsInFlight.Peak.Load(EMemoryOrder::Relaxed);
+    return Snapshot;
+}
+
+void FHttpMemoryTracker::ResetPeaks()
+{
+    using namespace HttpMemoryTrackerDetail;
+
+    for (FCounter* Counter : { &BodyBytes, &HeaderBytes, &CacheBytes, &RequestsInFlight })
+    {
+        Counter->Peak.Store(Counter->Current.Load(EMemoryOrder::Relaxed), EMemoryOrder::Relaxed);
+    }
+}
+
+int64 FHttpMemoryTracker::GetBodyBytes(const FHttpResponseData& Response)
+{
+    return Response.ResponseBody.GetAllocatedSize() + Response.ErrorMessage.GetAllocatedSize();
+}
+
+int64 FHttpMemoryTracker::GetHeaderBytes(const FHttpResponseData& Response)
+{
+    int64 Bytes = Response.ResponseHeaders.GetAllocatedSize();
+    for (const TPair<FString, FString>& Header : Response.ResponseHeaders)
+    {
+        Bytes += Header.Key.GetAllocatedSize() + Header.Value.GetAllocatedSize();
+    }
+    return Bytes;
+}
+
+// =============================================================================
+// RESPONSE MEMORY CHARGE
+// =============================================================================
+
+FHttpResponseMemoryCharge::FHttpResponseMemoryCharge(const FHttpResponseData& Response, int64 ExtraBodyBytes)
+    : BodyBytes(FHttpMemoryTracker::GetBodyBytes(Response) + ExtraBodyBytes)
+    , HeaderBytes(FHttpMemoryTracker::GetHeaderBytes(Response))
+{
+    FHttpMemoryTracker::AddBodyBytes(BodyBytes);
+    FHttpMemoryTracker::AddHeaderBytes(HeaderBytes);
+}
+
+FHttpResponseMemoryCharge::FHttpResponseMemoryCharge(FHttpResponseMemoryCharge&& Other)
+    : BodyBytes(Other.BodyBytes)
+    , HeaderBytes(Other.HeaderBytes)
+{
+    Other.BodyBytes = 0;
+    Other.HeaderBytes = 0;
+}
+
+FHttpResponseMemoryCharge& FHttpResponseMemoryCharge::operator=(FHttpResponseMemoryCharge&& Other)
+{
+    if (this != &Other)
+    {
+        Release();
+        BodyBytes = Other.BodyBytes;
+        HeaderBytes = Other.HeaderBytes;
+        Other.BodyBytes = 0;
+        Other.HeaderBytes = 0;
+    }
+    return *this;
+}
+
+void FHttpResponseMemoryCharge::Release()
+{
+    if (BodyBytes != 0)
+    {
+        FHttpMemoryTracker::AddBodyBytes(-BodyBytes);
+        BodyBytes = 0;
+    }
+    if (HeaderBytes != 0)
+    {
+        FHttpMemoryTracker::AddHeaderBytes(-HeaderBytes);
+        HeaderBytes = 0;
+    }
+}
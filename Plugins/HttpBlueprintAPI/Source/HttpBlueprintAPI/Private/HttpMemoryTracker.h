@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+struct FHttpResponseData;
+
+// Plugin allocations show up under this tag with -llm ("stat LLMFULL", memreport) and in Insights (-trace=memtag)
+LLM_DECLARE_TAG(HttpBlueprintAPI);
+
+/**
+ * Live memory held by the plugin
+ *
+ * Counters are plain atomics so they work in every build configuration; in builds with
+ * stats they are mirrored to "stat HttpBlueprintAPIMemory". HttpBlueprint.Memory.Report
+ * prints current and peak values (add it to [MemReportCommands] to include it in memreport).
+ */
+class FHttpMemoryTracker
+{
+public:
+
+    struct FSnapshot
+    {
+        int64 BodyBytes = 0;
+        int64 HeaderBytes = 0;
+        int64 CacheBytes = 0;
+        int32 RequestsInFlight = 0;
+
+        int64 PeakBodyBytes = 0;
+        int64 PeakHeaderBytes = 0;
+        int64 PeakCacheBytes = 0;
+        int32 PeakRequestsInFlight = 0;
+    };
+
+    /** Request and response bodies held between sending and the completion callback */
+    static void AddBodyBytes(int64 Delta);
+
+    /** Response header maps held between completion and the callback */
+    static void AddHeaderBytes(int64 Delta);
+
+    /** Bodies kept in plugin caches (fixtures, cached responses) */
+    static void AddCacheBytes(int64 Delta);
+
+    /** Requests sent and not yet completed */
+    static void AddRequestsInFlight(int32 Delta);
+
+    static FSnapshot GetSnapshot();
+
+    /** Reset peaks to the current values */
+    static void ResetPeaks();
+
+    /** Heap bytes of a response's body strings */
+    static int64 GetBodyBytes(const FHttpResponseData& Response);
+
+    /** Heap bytes of a response's header map */
+    static int64 GetHeaderBytes(const FHttpResponseData& Response);
+};
+
+/**
+ * Charges a response to the live body/header counters for as long as the charge is alive
+ * Move-only: capture it in the task or callback that holds the response.
+ */
+class FHttpResponseMemoryCharge
+{
+public:
+
+    FHttpResponseMemoryCharge() = default;
+
+    /** @param ExtraBodyBytes - Other copies of the body held alongside (e.g., the raw undecoded bytes) */
+    explicit FHttpResponseMemoryCharge(const FHttpResponseData& Response, int64 ExtraBodyBytes = 0);
+
+    FHttpResponseMemoryCharge(FHttpResponseMemoryCharge&& Other);
+    FHttpResponseMemoryCharge& operator=(FHttpResponseMemoryCharge&& Other);
+
+    FHttpResponseMemoryCharge(const FHttpResponseMemoryCharge&) = delete;
+    FHttpResponseMemoryCharge& operator=(const FHttpResponseMemoryCharge&) = delete;
+
+    ~FHttpResponseMemoryCharge() { Release(); }
+
+    void Release();
+
+private:
+
+    int64 BodyBytes = 0;
+    int64 HeaderBytes = 0;
+};
@@ -0,0 +1,419 @@
+#include "HttpMetricsExporter.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpLoopbackRouter.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpMetricsCommands
+{
+    static FAutoConsoleCommand ExportCommand(
+        TEXT("HttpBlueprint.Metrics.Export"),
+        TEXT("Export HTTP metrics to the configured Prometheus file/port and StatsD address now."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpMetricsExporter::Get().ExportNow();
+            }));
+}
+
+// =============================================================================
+// AGGREGATION
+// =============================================================================
+
+namespace HttpMetricsDetail
+{
+    /** Indexed by EHttpErrorKind */
+    static const TCHAR* const ErrorKindLabels[] =
+    {
+        TEXT("none"),
+        TEXT("invalid_request"),
+        TEXT("connection_failed"),
+        TEXT("timeout"),
+        TEXT("cancelled"),
+        TEXT("network_error"),
+        TEXT("http_client_error"),
+        TEXT("http_server_error"),
+        TEXT("http_unexpected_status"),
+        TEXT("body_too_large"),
+        TEXT("decode_error"),
+        TEXT("pipeline_stage_failed"),
+        TEXT("fixture_missing"),
+    };
+    static_assert(UE_ARRAY_COUNT(ErrorKindLabels) == FHttpMetrics::NumErrorKinds, "One label per EHttpErrorKind");
+    static_assert((int32)EHttpErrorKind::FixtureMissing == FHttpMetrics::NumErrorKinds - 1, "NumErrorKinds must cover every EHttpErrorKind");
+
+    static const TCHAR* const StatusClassLabels[] = { TEXT("none"), TEXT("1xx"), TEXT("2xx"), TEXT("3xx"), TEXT("4xx"), TEXT("5xx") };
+    static_assert(UE_ARRAY_COUNT(StatusClassLabels) == FHttpMetrics::NumStatusClasses, "One label per status class");
+
+    static TAtomic<uint64> Requests[FHttpMetrics::NumErrorKinds];
+    static TAtomic<uint64> StatusClasses[FHttpMetrics::NumStatusClasses];
+    static TAtomic<uint64> DurationBucketCounts[FHttpMetrics::NumDurationBuckets];
+    static TAtomic<uint64> DurationSumMicroseconds { 0 };
+    static TAtomic<uint64> ResponseBytes { 0 };
+
+    /** Largest UDP payload that is not fragmented on common networks */
+    static constexpr int32 MaxStatsDPacketBytes = 1432;
+
+    static void AppendMetricHeader(FString& Out, const TCHAR* Name, const TCHAR* Type, const TCHAR* Help)
+    {
+        Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), Name, Help, Name, Type);
+    }
+}
+
+void FHttpMetrics::RecordRequest(const FHttpResponseData& Response, int64 ResponseBytes)
+{
+    using namespace HttpMetricsDetail;
+
+    const int32 Kind = FMath::Clamp((int32)Response.ErrorKind, 0, NumErrorKinds - 1);
+    Requests[Kind].IncrementExchange();
+
+    const int32 StatusClass = Response.ResponseCode >= 100 && Response.ResponseCode < 600 ? Response.ResponseCode / 100 : 0;
+    StatusClasses[StatusClass].IncrementExchange();
+
+    int32 Bucket = 0;
+    while (Bucket < NumDurationBuckets - 1 && Response.ResponseTimeSeconds > DurationBuckets[Bucket])
+    {
+        ++Bucket;
+    }
+    DurationBucketCounts[Bucket].IncrementExchange();
+    DurationSumMicroseconds.AddExchange((uint64)FMath::Max(0.0, Response.ResponseTimeSeconds * 1000000.0));
+    HttpMetricsDetail::ResponseBytes.AddExchange((uint64)FMath::Max<int64>(0, ResponseBytes));
+}
+
+FHttpMetrics::FSnapshot FHttpMetrics::GetSnapshot()
+{
+    using namespace HttpMetricsDetail;
+
+    FSnapshot Snapshot;
+    for (int32 Index = 0; Index < NumErrorKinds; ++Index)
+    {
+        Snapshot.Requests[Index] = Requests[Index].Load(EMemoryOrder::Relaxed);
+    }
+    for (int32 Index = 0; Index < NumStatusClasses; ++Index)
+    {
+        Snapshot.StatusClasses[Index] = StatusClasses[Index].Load(EMemoryOrder::Relaxed);
+    }
+    for (int32 Index = 0; Index < NumDurationBuckets; ++Index)
+    {
+        Snapshot.DurationBucketCounts[Index] = DurationBucketCounts[Index].Load(EMemoryOrder::Relaxed);
+    }
+    Snapshot.DurationSumMicroseconds = DurationSumMicroseconds.Load(EMemoryOrder::Relaxed);
+    Snapshot.ResponseBytes = HttpMetricsDetail::ResponseBytes.Load(EMemoryOrder::Relaxed);
+    Snapshot.Memory = FHttpMemoryTracker::GetSnapshot();
+    return Snapshot;
+}
+
+const TCHAR* FHttpMetrics::GetErrorKindLabel(int32 ErrorKind)
+{
+    return HttpMetricsDetail::ErrorKindLabels[FMath::Clamp(ErrorKind, 0, NumErrorKinds - 1)];
+}
+
+// =============================================================================
+// EXPORTER
+// =============================================================================
+
+FHttpMetricsExporter& FHttpMetricsExporter::Get()
+{
+    static FHttpMetricsExporter Instance;
+    return Instance;
+}
+
+FHttpMetricsExporter::FHttpMetricsExporter()
+    : WriterPipe(TEXT("HttpBlueprintMetricsWriter"))
+{
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FHttpMetricsExporter::Tick), 0.0f);
+}
+
+bool FHttpMetricsExporter::Tick(float DeltaTime)
+{
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+
+    UpdatePrometheusRoute(Settings.MetricsIntervalSeconds > 0.0f ? Settings.MetricsPrometheusPort : 0);
+
+    SecondsSinceExport += DeltaTime;
+    if (Settings.MetricsIntervalSeconds > 0.0f && SecondsSinceExport >= Settings.MetricsIntervalSeconds)
+    {
+        ExportNow();
+    }
+    return true;
+}
+
+void FHttpMetricsExporter::ExportNow()
+{
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+    SecondsSinceExport = 0.0;
+
+    if (Settings.MetricsPrometheusFile.IsEmpty() && BoundPort == 0 && Settings.MetricsStatsDAddress.IsEmpty())
+    {
+        return;
+    }
+
+    // Skip this export if the previous one is still being written
+    if (WriterPipe.HasWork())
+    {
+        return;
+    }
+
+    WriterPipe.Launch(UE_SOURCE_LOCATION,
+        [this, Snapshot = FHttpMetrics::GetSnapshot(), PrometheusFile = Settings.MetricsPrometheusFile, bServePrometheus = BoundPort != 0, StatsDAddress = Settings.MetricsStatsDAddress]()
+        {
+            Export(Snapshot, PrometheusFile, bServePrometheus, StatsDAddress);
+        });
+}
+
+void FHttpMetricsExporter::UpdatePrometheusRoute(int32 Port)
+{
+    if (Port == BoundPort)
+    {
+        return;
+    }
+
+    if (Router.IsValid())
+    {
+        Router->UnbindRoute(RouteHandle);
+        Router.Reset();
+        RouteHandle.Reset();
+    }
+    BoundPort = 0;
+
+    if (Port <= 0)
+    {
+        return;
+    }
+
+    FString BindAddress;
+    Router = FHttpLoopbackRouter::Get(Port, BindAddress);
+    if (!Router.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not listen for Prometheus scrapes on port %d"), Port);
+        return;
+    }
+
+    // The handler runs on the game thread and only copies the text serialized by the last export
+    RouteHandle = Router->BindRoute(FHttpPath(TEXT("/metrics")), EHttpServerRequestVerbs::VERB_GET,
+        FHttpRequestHandler::CreateLambda([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+            {
+                FString Text;
+                {
+                    FScopeLock Lock(&PrometheusTextLock);
+                    Text = PrometheusText;
+                }
+                OnComplete(FHttpServerResponse::Create(Text, TEXT("text/plain; version=0.0.4; charset=utf-8")));
+                return true;
+            }));
+
+    FHttpServerModule::Get().StartAllListeners();
+    BoundPort = Port;
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Serving HTTP metrics at /metrics on port %d (bound to %s)"), Port, *BindAddress);
+}
+
+void FHttpMetricsExporter::Export(const FHttpMetrics::FSnapshot& Snapshot, const FString& PrometheusFile, bool bServePrometheus, const FString& StatsDAddress)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+    if (!PrometheusFile.IsEmpty() || bServePrometheus)
+    {
+        FString Text = FormatPrometheus(Snapshot);
+
+        // Write a temporary file and rename it so scrapers never read a partial file
+        if (!PrometheusFile.IsEmpty())
+        {
+            const FString TempFile = PrometheusFile + TEXT(".tmp");
+            if (!FFileHelper::SaveStringToFile(Text, *TempFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) ||
+                !IFileManager::Get().Move(*PrometheusFile, *TempFile, /*bReplace*/ true))
+            {
+                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Could not write HTTP metrics to %s"), *PrometheusFile);
+            }
+        }
+
+        FScopeLock Lock(&PrometheusTextLock);
+        PrometheusText = MoveTemp(Text);
+    }
+
+    if (!StatsDAddress.IsEmpty())
+    {
+        TArray<FString> Packets;
+        FormatStatsD(Snapshot, LastStatsDSnapshot, Packets);
+        SendStatsD(StatsDAddress, Packets);
+    }
+    LastStatsDSnapshot = Snapshot;
+}
+
+FString FHttpMetricsExporter::FormatPrometheus(const FHttpMetrics::FSnapshot& Snapshot)
+{
+    using namespace HttpMetricsDetail;
+
+    FString Out;
+    Out.Reserve(4096);
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_requests_total"), TEXT("counter"), TEXT("HTTP requests completed, by error kind (none = succeeded)."));
+    for (int32 Index = 0; Index < FHttpMetrics::NumErrorKinds; ++Index)
+    {
+        Out += FString::Printf(TEXT("httpblueprint_requests_total{error_kind=\"%s\"} %llu\n"), ErrorKindLabels[Index], Snapshot.Requests[Index]);
+    }
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_responses_total"), TEXT("counter"), TEXT("HTTP requests completed, by response status class (none = no response)."));
+    for (int32 Index = 0; Index < FHttpMetrics::NumStatusClasses; ++Index)
+    {
+        Out += FString::Printf(TEXT("httpblueprint_responses_total{code=\"%s\"} %llu\n"), StatusClassLabels[Index], Snapshot.StatusClasses[Index]);
+    }
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_request_duration_seconds"), TEXT("histogram"), TEXT("Time from sending an HTTP request to its completion."));
+    uint64 Cumulative = 0;
+    for (int32 Index = 0; Index < FHttpMetrics::NumDurationBuckets; ++Index)
+    {
+        Cumulative += Snapshot.DurationBucketCounts[Index];
+        const FString Bound = Index < FHttpMetrics::NumDurationBuckets - 1
+            ? FString::SanitizeFloat(FHttpMetrics::DurationBuckets[Index])
+            : FString(TEXT("+Inf"));
+        Out += FString::Printf(TEXT("httpblueprint_request_duration_seconds_bucket{le=\"%s\"} %llu\n"), *Bound, Cumulative);
+    }
+    Out += FString::Printf(TEXT("httpblueprint_request_duration_seconds_sum %.6f\n"), Snapshot.DurationSumMicroseconds / 1000000.0);
+    Out += FString::Printf(TEXT("httpblueprint_request_duration_seconds_count %llu\n"), Cumulative);
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_response_body_bytes_total"), TEXT("counter"), TEXT("Response body bytes received."));
+    Out += FString::Printf(TEXT("httpblueprint_response_body_bytes_total %llu\n"), Snapshot.ResponseBytes);
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_requests_in_flight"), TEXT("gauge"), TEXT("HTTP requests sent and not yet completed."));
+    Out += FString::Printf(TEXT("httpblueprint_requests_in_flight %d\n"), Snapshot.Memory.RequestsInFlight);
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_live_body_bytes"), TEXT("gauge"), TEXT("Request and response body bytes held by the plugin."));
+    Out += FString::Printf(TEXT("httpblueprint_live_body_bytes %lld\n"), Snapshot.Memory.BodyBytes);
+
+    AppendMetricHeader(Out, TEXT("httpblueprint_cache_bytes"), TEXT("gauge"), TEXT("Bytes held in plugin caches."));
+    Out += FString::Printf(TEXT("httpblueprint_cache_bytes %lld\n"), Snapshot.Memory.CacheBytes);
+
+    return Out;
+}
+
+void FHttpMetricsExporter::FormatStatsD(const FHttpMetrics::FSnapshot& Snapshot, const FHttpMetrics::FSnapshot& Previous, TArray<FString>& OutPackets)
+{
+    using namespace HttpMetricsDetail;
+
+    TArray<FString> Lines;
+
+    // Counters are sent as deltas since the last export; unchanged ones are left out
+    auto AddCounter = [&Lines](const FString& Name, uint64 Value, uint64 PreviousValue)
+        {
+            if (Value > PreviousValue)
+            {
+                Lines.Add(FString::Printf(TEXT("httpblueprint.%s:%llu|c"), *Name, Value - PreviousValue));
+            }
+        };
+
+    for (int32 Index = 0; Index < FHttpMetrics::NumErrorKinds; ++Index)
+    {
+        AddCounter(FString::Printf(TEXT("requests.%s"), ErrorKindLabels[Index]), Snapshot.Requests[Index], Previous.Requests[Index]);
+    }
+    for (int32 Index = 0; Index < FHttpMetrics::NumStatusClasses; ++Index)
+    {
+        AddCounter(FString::Printf(TEXT("responses.%s"), StatusClassLabels[Index]), Snapshot.StatusClasses[Index], Previous.StatusClasses[Index]);
+    }
+    for (int32 Index = 0; Index < FHttpMetrics::NumDurationBuckets; ++Index)
+    {
+        const FString Bucket = Index < FHttpMetrics::NumDurationBuckets - 1
+            ? FString::Printf(TEXT("le_%dms"), FMath::RoundToInt(FHttpMetrics::DurationBuckets[Index] * 1000.0))
+            : FString(TEXT("le_inf"));
+        AddCounter(TEXT("request_duration.") + Bucket, Snapshot.DurationBucketCounts[Index], Previous.DurationBucketCounts[Index]);
+    }
+    AddCounter(TEXT("request_duration_ms_sum"), Snapshot.DurationSumMicroseconds / 1000, Previous.DurationSumMicroseconds / 1000);
+    AddCounter(TEXT("response_body_bytes"), Snapshot.ResponseBytes, Previous.ResponseBytes);
+
+    Lines.Add(FString::Printf(TEXT("httpblueprint.requests_in_flight:%d|g"), Snapshot.Memory.RequestsInFlight));
+    Lines.Add(FString::Printf(TEXT("httpblueprint.live_body_bytes:%lld|g"), Snapshot.Memory.BodyBytes));
+    Lines.Add(FString::Printf(TEXT("httpblueprint.cache_bytes:%lld|g"), Snapshot.Memory.CacheBytes));
+
+    // Pack newline-separated lines into datagrams that are not fragmented
+    FString Packet;
+    for (const FString& Line : Lines)
+    {
+        if (!Packet.IsEmpty() && Packet.Len() + 1 + Line.Len() > MaxStatsDPacketBytes)
+        {
+            OutPackets.Add(MoveTemp(Packet));
+            Packet.Reset();
+        }
+        if (!Packet.IsEmpty())
+        {
+            Packet += TEXT("\n");
+        }
+        Packet += Line;
+    }
+    if (!Packet.IsEmpty())
+    {
+        OutPackets.Add(MoveTemp(Packet));
+    }
+}
+
+void FHttpMetricsExporter::SendStatsD(const FString& Address, const TArray<FString>& Packets)
+{
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!SocketSubsystem)
+    {
+        return;
+    }
+
+    if (Address != StatsDAddressString)
+    {
+        StatsDAddressString = Address;
+        StatsDAddr = SocketSubsystem->GetAddressFromString(Address);
+        if (!StatsDAddr.IsValid())
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Invalid StatsD address (expected Ip:Port): %s"), *Address);
+        }
+    }
+
+    if (!StatsDAddr.IsValid())
+    {
+        return;
+    }
+
+    if (!StatsDSocket)
+    {
+        StatsDSocket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("HttpBlueprintStatsD"), StatsDAddr->GetProtocolType());
+        if (!StatsDSocket)
+        {
+            return;
+        }
+    }
+
+    for (const FString& Packet : Packets)
+    {
+        FTCHARToUTF8 Utf8(*Packet);
+        int32 BytesSent = 0;
+        StatsDSocket->SendTo(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), BytesSent, *StatsDAddr);
+    }
+}
+
+void FHttpMetricsExporter::Shutdown()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    UpdatePrometheusRoute(0);
+
+    WriterPipe.WaitUntilEmpty();
+
+    if (StatsDSocket)
+    {
+        if (ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+        {
+            SocketSubsystem->DestroySocket(StatsDSocket);
+        }
+        StatsDSocket = nullptr;
+    }
+}
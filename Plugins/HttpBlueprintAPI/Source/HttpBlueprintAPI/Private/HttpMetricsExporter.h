@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Pipe.h"
+#include "HttpRouteHandle.h"
+#include "HttpMemoryTracker.h"
+
+struct FHttpResponseData;
+class FSocket;
+class FInternetAddr;
+class IHttpRouter;
+
+/**
+ * Request counters and latency histogram of every completed request
+ *
+ * Recording is a handful of relaxed atomic increments, so it is safe and cheap on any thread.
+ */
+class FHttpMetrics
+{
+public:
+
+    /** Upper bounds (seconds) of the request duration histogram buckets; a final +Inf bucket follows */
+    static constexpr double DurationBuckets[] = { 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+    static constexpr int32 NumDurationBuckets = UE_ARRAY_COUNT(DurationBuckets) + 1;
+
+    /** One counter per EHttpErrorKind */
+    static constexpr int32 NumErrorKinds = 13;
+
+    /** No response, then 1xx to 5xx */
+    static constexpr int32 NumStatusClasses = 6;
+
+    struct FSnapshot
+    {
+        uint64 Requests[NumErrorKinds] = {};
+        uint64 StatusClasses[NumStatusClasses] = {};
+
+        /** Not cumulative: each request is counted in the first bucket it fits */
+        uint64 DurationBucketCounts[NumDurationBuckets] = {};
+        uint64 DurationSumMicroseconds = 0;
+        uint64 ResponseBytes = 0;
+
+        FHttpMemoryTracker::FSnapshot Memory;
+    };
+
+    static void RecordRequest(const FHttpResponseData& Response, int64 ResponseBytes);
+
+    static FSnapshot GetSnapshot();
+
+    /** Label of an error kind in exported metrics (e.g., "http_server_error") */
+    static const TCHAR* GetErrorKindLabel(int32 ErrorKind);
+};
+
+/**
+ * Periodic export of FHttpMetrics to monitoring systems
+ *
+ * Every HttpBlueprint.Metrics.IntervalSeconds the game thread only launches a task; the
+ * snapshot is serialized and written on a worker pipe:
+ * - Prometheus exposition text, rewritten atomically to HttpBlueprint.Metrics.PrometheusFile
+ *   and served at http://127.0.0.1:<HttpBlueprint.Metrics.PrometheusPort>/metrics
+ * - StatsD counter deltas and gauges, sent as UDP packets to HttpBlueprint.Metrics.StatsDAddress
+ */
+class FHttpMetricsExporter
+{
+public:
+
+    static FHttpMetricsExporter& Get();
+
+    /** Export now, whatever the interval (game thread) */
+    void ExportNow();
+
+    /** Stop ticking, unbind the metrics route and close the StatsD socket (module shutdown) */
+    void Shutdown();
+
+private:
+
+    FHttpMetricsExporter();
+
+    bool Tick(float DeltaTime);
+
+    /** Bind or move the /metrics route when the port setting changes (game thread) */
+    void UpdatePrometheusRoute(int32 Port);
+
+    /** Serialize and write a snapshot (writer pipe only) */
+    void Export(const FHttpMetrics::FSnapshot& Snapshot, const FString& PrometheusFile, bool bServePrometheus, const FString& StatsDAddress);
+
+    static FString FormatPrometheus(const FHttpMetrics::FSnapshot& Snapshot);
+    static void FormatStatsD(const FHttpMetrics::FSnapshot& Snapshot, const FHttpMetrics::FSnapshot& Previous, TArray<FString>& OutPackets);
+
+    void SendStatsD(const FString& Address, const TArray<FString>& Packets);
+
+    UE::Tasks::FPipe WriterPipe;
+    FTSTicker::FDelegateHandle TickHandle;
+    double SecondsSinceExport = 0.0;
+
+    // Prometheus endpoint (game thread)
+    TSharedPtr<IHttpRouter> Router;
+    FHttpRouteHandle RouteHandle;
+    int32 BoundPort = 0;
+
+    /** Last exposition text, served by the endpoint */
+    FCriticalSection PrometheusTextLock;
+    FString PrometheusText;
+
+    // StatsD state (writer pipe only)
+    FHttpMetrics::FSnapshot LastStatsDSnapshot;
+    FSocket* StatsDSocket = nullptr;
+    TSharedPtr<FInternetAddr> StatsDAddr;
+    FString StatsDAddressString;
+};
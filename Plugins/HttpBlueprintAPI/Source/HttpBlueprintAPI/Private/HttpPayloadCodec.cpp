@@ -0,0 +1,1175 @@
+#include "HttpPayloadCodec.h"
+#include "HttpProtobufCodec.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "JsonObjectConverter.h"
+#include "UObject/StructOnScope.h"
+
+// =============================================================================
+// WRITERS
+// =============================================================================
+
+namespace HttpPayloadCodecDetail
+{
+    /** Nesting limit when decoding, so hostile bodies cannot exhaust the stack */
+    constexpr int32 MaxDepth = 512;
+
+    /** Largest integer a double holds exactly */
+    constexpr uint64 MaxExactInteger = 1ull << 53;
+
+    template<typename T>
+    static void AppendBigEndian(TArray<uint8>& Out, T Value)
+    {
+        for (int32 Shift = (sizeof(T) - 1) * 8; Shift >= 0; Shift -= 8)
+        {
+            Out.Add((uint8)(Value >> Shift));
+        }
+    }
+
+    static void AppendFloat(TArray<uint8>& Out, float Value)
+    {
+        uint32 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        AppendBigEndian(Out, Bits);
+    }
+
+    static void AppendDouble(TArray<uint8>& Out, double Value)
+    {
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        AppendBigEndian(Out, Bits);
+    }
+
+    /** Integral numbers are written with the integer encodings, which are smaller and exact */
+    static bool AsInteger(double Number, int64& OutInteger)
+    {
+        if (Number != FMath::FloorToDouble(Number) || Number < -9223372036854775808.0 || Number >= 9223372036854775808.0)
+        {
+            return false;
+        }
+        OutInteger = (int64)Number;
+        return true;
+    }
+
+    static bool IsExactFloat(double Number)
+    {
+        return (double)(float)Number == Number;
+    }
+
+    static TSharedRef<FJsonValue> MakeUnsigned(uint64 Value)
+    {
+        // Past 2^53 keep the digits rather than rounding
+        if (Value > MaxExactInteger)
+        {
+            return MakeShared<FJsonValueNumberString>(FString::Printf(TEXT("%llu"), Value));
+        }
+        return MakeShared<FJsonValueNumber>((double)Value);
+    }
+
+    static TSharedRef<FJsonValue> MakeSigned(int64 Value)
+    {
+        if (Value < -(int64)MaxExactInteger || Value > (int64)MaxExactInteger)
+        {
+            return MakeShared<FJsonValueNumberString>(FString::Printf(TEXT("%lld"), Value));
+        }
+        return MakeShared<FJsonValueNumber>((double)Value);
+    }
+
+    static TSharedRef<FJsonValue> MakeString(const uint8* Text, uint64 Length)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text), (int32)Length);
+        return MakeShared<FJsonValueString>(FString(Converted.Length(), Converted.Get()));
+    }
+
+    class FMessagePackWriter
+    {
+    public:
+
+        explicit FMessagePackWriter(TArray<uint8>& InOut) : Out(InOut) {}
+
+        void Write(const TSharedPtr<FJsonValue>& Value)
+        {
+            if (!Value.IsValid())
+            {
+                Out.Add(0xc0);
+                return;
+            }
+
+            switch (Value->Type)
+            {
+            case EJson::Boolean:
+                Out.Add(Value->AsBool() ? 0xc3 : 0xc2);
+                break;
+
+            case EJson::Number:
+                WriteNumber(Value->AsNumber());
+                break;
+
+            case EJson::String:
+                WriteString(Value->AsString());
+                break;
+
+            case EJson::Array:
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+                WriteLength(Elements.Num(), 0x90, 0xdc, 0xdd, 16);
+                for (const TSharedPtr<FJsonValue>& Element : Elements)
+                {
+                    Write(Element);
+                }
+                break;
+            }
+
+            case EJson::Object:
+                WriteObject(*Value->AsObject());
+                break;
+
+            default:
+                Out.Add(0xc0);
+                break;
+            }
+        }
+
+        void WriteObject(const FJsonObject& Object)
+        {
+            WriteLength(Object.Values.Num(), 0x80, 0xde, 0xdf, 16);
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+            {
+                WriteString(Field.Key);
+                Write(Field.Value);
+            }
+        }
+
+    private:
+
+        void WriteNumber(double Number)
+        {
+            int64 Integer = 0;
+            if (!AsInteger(Number, Integer))
+            {
+                if (IsExactFloat(Number))
+                {
+                    Out.Add(0xca);
+                    AppendFloat(Out, (float)Number);
+                }
+                else
+                {
+                    Out.Add(0xcb);
+                    AppendDouble(Out, Number);
+                }
+                return;
+            }
+
+            if (Integer >= 0)
+            {
+                if (Integer < 0x80)              { Out.Add((uint8)Integer); }
+                else if (Integer <= MAX_uint8)   { Out.Add(0xcc); AppendBigEndian(Out, (uint8)Integer); }
+                else if (Integer <= MAX_uint16)  { Out.Add(0xcd); AppendBigEndian(Out, (uint16)Integer); }
+                else if (Integer <= MAX_uint32)  { Out.Add(0xce); AppendBigEndian(Out, (uint32)Integer); }
+                else                             { Out.Add(0xcf); AppendBigEndian(Out, (uint64)Integer); }
+            }
+            else
+            {
+                if (Integer >= -32)              { Out.Add((uint8)(int8)Integer); }
+                else if (Integer >= MIN_int8)    { Out.Add(0xd0); AppendBigEndian(Out, (uint8)(int8)Integer); }
+                else if (Integer >= MIN_int16)   { Out.Add(0xd1); AppendBigEndian(Out, (uint16)(int16)Integer); }
+                else if (Integer >= MIN_int32)   { Out.Add(0xd2); AppendBigEndian(Out, (uint32)(int32)Integer); }
+                else                             { Out.Add(0xd3); AppendBigEndian(Out, (uint64)Integer); }
+            }
+        }
+
+        void WriteString(const FString& String)
+        {
+            FTCHARToUTF8 Utf8(*String);
+            const int32 Length = Utf8.Length();
+            if (Length < 32)                { Out.Add((uint8)(0xa0 | Length)); }
+            else if (Length <= MAX_uint8)   { Out.Add(0xd9); AppendBigEndian(Out, (uint8)Length); }
+            else if (Length <= MAX_uint16)  { Out.Add(0xda); AppendBigEndian(Out, (uint16)Length); }
+            else                            { Out.Add(0xdb); AppendBigEndian(Out, (uint32)Length); }
+            Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+        }
+
+        /** Array and map headers: fix form below FixLimit, then 16- and 32-bit counts */
+        void WriteLength(int32 Count, uint8 FixPrefix, uint8 Prefix16, uint8 Prefix32, int32 FixLimit)
+        {
+            if (Count < FixLimit)           { Out.Add((uint8)(FixPrefix | Count)); }
+            else if (Count <= MAX_uint16)   { Out.Add(Prefix16); AppendBigEndian(Out, (uint16)Count); }
+            else                            { Out.Add(Prefix32); AppendBigEndian(Out, (uint32)Count); }
+        }
+
+        TArray<uint8>& Out;
+    };
+
+    class FCborWriter
+    {
+    public:
+
+        explicit FCborWriter(TArray<uint8>& InOut) : Out(InOut) {}
+
+        void Write(const TSharedPtr<FJsonValue>& Value)
+        {
+            if (!Value.IsValid())
+            {
+                Out.Add(0xf6);
+                return;
+            }
+
+            switch (Value->Type)
+            {
+            case EJson::Boolean:
+                Out.Add(Value->AsBool() ? 0xf5 : 0xf4);
+                break;
+
+            case EJson::Number:
+                WriteNumber(Value->AsNumber());
+                break;
+
+            case EJson::String:
+                WriteString(Value->AsString());
+                break;
+
+            case EJson::Array:
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+                WriteHead(4, Elements.Num());
+                for (const TSharedPtr<FJsonValue>& Element : Elements)
+                {
+                    Write(Element);
+                }
+                break;
+            }
+
+            case EJson::Object:
+                WriteObject(*Value->AsObject());
+                break;
+
+            default:
+                Out.Add(0xf6);
+                break;
+            }
+        }
+
+        void WriteObject(const FJsonObject& Object)
+        {
+            WriteHead(5, Object.Values.Num());
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+            {
+                WriteString(Field.Key);
+                Write(Field.Value);
+            }
+        }
+
+    private:
+
+        /** Major type in the top 3 bits, argument inline below 24 and then in 1, 2, 4 or 8 bytes */
+        void WriteHead(uint8 MajorType, uint64 Argument)
+        {
+            const uint8 Major = (uint8)(MajorType << 5);
+            if (Argument < 24)                { Out.Add((uint8)(Major | Argument)); }
+            else if (Argument <= MAX_uint8)   { Out.Add(Major | 24); AppendBigEndian(Out, (uint8)Argument); }
+            else if (Argument <= MAX_uint16)  { Out.Add(Major | 25); AppendBigEndian(Out, (uint16)Argument); }
+            else if (Argument <= MAX_uint32)  { Out.Add(Major | 26); AppendBigEndian(Out, (uint32)Argument); }
+            else                              { Out.Add(Major | 27); AppendBigEndian(Out, Argument); }
+        }
+
+        void WriteNumber(double Number)
+        {
+            int64 Integer = 0;
+            if (AsInteger(Number, Integer))
+            {
+                if (Integer >= 0)
+                {
+                    WriteHead(0, (uint64)Integer);
+                }
+                else
+                {
+                    WriteHead(1, (uint64)(-1 - Integer));
+                }
+            }
+            else if (IsExactFloat(Number))
+            {
+                Out.Add(0xfa);
+                AppendFloat(Out, (float)Number);
+            }
+            else
+            {
+                Out.Add(0xfb);
+                AppendDouble(Out, Number);
+            }
+        }
+
+        void WriteString(const FString& String)
+        {
+            FTCHARToUTF8 Utf8(*String);
+            WriteHead(3, Utf8.Length());
+            Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        }
+
+        TArray<uint8>& Out;
+    };
+}
+
+// =============================================================================
+// READERS
+// =============================================================================
+
+namespace HttpPayloadCodecDetail
+{
+    class FByteReader
+    {
+    public:
+
+        explicit FByteReader(TArrayView<const uint8> Bytes)
+            : Begin(Bytes.GetData())
+            , Cur(Bytes.GetData())
+            , End(Bytes.GetData() + Bytes.Num())
+        {
+        }
+
+        FString Error;
+
+        bool AtEnd() const { return Cur >= End; }
+
+        bool Fail(const FString& Message)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = FString::Printf(TEXT("%s at offset %d"), *Message, (int32)(Cur - Begin));
+            }
+            return false;
+        }
+
+        bool Peek(uint8 Byte) const
+        {
+            return Cur < End && *Cur == Byte;
+        }
+
+        bool ReadByte(uint8& OutByte)
+        {
+            if (Cur >= End)
+            {
+                return Fail(TEXT("Unexpected end of body"));
+            }
+            OutByte = *Cur++;
+            return true;
+        }
+
+        template<typename T>
+        bool ReadBigEndian(T& OutValue)
+        {
+            if (End - Cur < (int64)sizeof(T))
+            {
+                return Fail(TEXT("Unexpected end of body"));
+            }
+            OutValue = 0;
+            for (int32 Index = 0; Index < (int32)sizeof(T); ++Index)
+            {
+                OutValue = (T)((OutValue << 8) | *Cur++);
+            }
+            return true;
+        }
+
+        bool ReadFloat(double& OutValue)
+        {
+            uint32 Bits = 0;
+            if (!ReadBigEndian(Bits))
+            {
+                return false;
+            }
+            float Value;
+            FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+            OutValue = Value;
+            return true;
+        }
+
+        bool ReadDouble(double& OutValue)
+        {
+            uint64 Bits = 0;
+            if (!ReadBigEndian(Bits))
+            {
+                return false;
+            }
+            FMemory::Memcpy(&OutValue, &Bits, sizeof(OutValue));
+            return true;
+        }
+
+        /** Point at the next Length bytes without copying them */
+        bool ReadSpan(uint64 Length, const uint8*& OutData)
+        {
+            if ((uint64)(End - Cur) < Length)
+            {
+                return Fail(TEXT("Length runs past the end of body"));
+            }
+            OutData = Cur;
+            Cur += Length;
+            return true;
+        }
+
+        /** Every element takes at least one byte, so larger counts are corrupt (and would over-reserve) */
+        bool CheckCount(uint64 Count)
+        {
+            return Count <= (uint64)(End - Cur) || Fail(TEXT("Element count runs past the end of body"));
+        }
+
+    private:
+
+        const uint8* Begin;
+        const uint8* Cur;
+        const uint8* End;
+    };
+
+    static bool AddField(FJsonObject& Object, const TSharedPtr<FJsonValue>& Key, const TSharedPtr<FJsonValue>& Value)
+    {
+        FString KeyString;
+        if (!Key.IsValid() || Key->Type == EJson::Array || Key->Type == EJson::Object || !Key->TryGetString(KeyString))
+        {
+            return false;
+        }
+        Object.Values.Add(MoveTemp(KeyString), Value);
+        return true;
+    }
+
+    class FMessagePackReader : public FByteReader
+    {
+    public:
+
+        using FByteReader::FByteReader;
+
+        TSharedPtr<FJsonValue> Read(int32 Depth = 0)
+        {
+            if (Depth > MaxDepth)
+            {
+                Fail(TEXT("MessagePack nested too deeply"));
+                return nullptr;
+            }
+
+            uint8 Type = 0;
+            if (!ReadByte(Type))
+            {
+                return nullptr;
+            }
+
+            if (Type <= 0x7f)
+            {
+                return MakeShared<FJsonValueNumber>(Type);
+            }
+            if (Type >= 0xe0)
+            {
+                return MakeShared<FJsonValueNumber>((int8)Type);
+            }
+            if ((Type & 0xf0) == 0x80)
+            {
+                return ReadMap(Type & 0x0f, Depth);
+            }
+            if ((Type & 0xf0) == 0x90)
+            {
+                return ReadArray(Type & 0x0f, Depth);
+            }
+            if ((Type & 0xe0) == 0xa0)
+            {
+                return ReadString(Type & 0x1f);
+            }
+
+            switch (Type)
+            {
+            case 0xc0: return MakeShared<FJsonValueNull>();
+            case 0xc2: return MakeShared<FJsonValueBoolean>(false);
+            case 0xc3: return MakeShared<FJsonValueBoolean>(true);
+
+            case 0xc4: { uint8 Length;  return ReadBigEndian(Length) ? ReadBinary(Length) : nullptr; }
+            case 0xc5: { uint16 Length; return ReadBigEndian(Length) ? ReadBinary(Length) : nullptr; }
+            case 0xc6: { uint32 Length; return ReadBigEndian(Length) ? ReadBinary(Length) : nullptr; }
+
+            case 0xca: { double Value; return ReadFloat(Value) ? MakeShared<FJsonValueNumber>(Value) : TSharedPtr<FJsonValue>(); }
+            case 0xcb: { double Value; return ReadDouble(Value) ? MakeShared<FJsonValueNumber>(Value) : TSharedPtr<FJsonValue>(); }
+
+            case 0xcc: { uint8 Value;  return ReadBigEndian(Value) ? MakeUnsigned(Value) : TSharedPtr<FJsonValue>(); }
+            case 0xcd: { uint16 Value; return ReadBigEndian(Value) ? MakeUnsigned(Value) : TSharedPtr<FJsonValue>(); }
+            case 0xce: { uint32 Value; return ReadBigEndian(Value) ? MakeUnsigned(Value) : TSharedPtr<FJsonValue>(); }
+            case 0xcf: { uint64 Value; return ReadBigEndian(Value) ? MakeUnsigned(Value) : TSharedPtr<FJsonValue>(); }
+
+            case 0xd0: { uint8 Value;  return ReadBigEndian(Value) ? MakeSigned((int8)Value) : TSharedPtr<FJsonValue>(); }
+            case 0xd1: { uint16 Value; return ReadBigEndian(Value) ? MakeSigned((int16)Value) : TSharedPtr<FJsonValue>(); }
+            case 0xd2: { uint32 Value; return ReadBigEndian(Value) ? MakeSigned((int32)Value) : TSharedPtr<FJsonValue>(); }
+            case 0xd3: { uint64 Value; return ReadBigEndian(Value) ? MakeSigned((int64)Value) : TSharedPtr<FJsonValue>(); }
+
+            case 0xd9: { uint8 Length;  return ReadBigEndian(Length) ? ReadString(Length) : nullptr; }
+            case 0xda: { uint16 Length; return ReadBigEndian(Length) ? ReadString(Length) : nullptr; }
+            case 0xdb: { uint32 Length; return ReadBigEndian(Length) ? ReadString(Length) : nullptr; }
+
+            case 0xdc: { uint16 Count; return ReadBigEndian(Count) ? ReadArray(Count, Depth) : nullptr; }
+            case 0xdd: { uint32 Count; return ReadBigEndian(Count) ? ReadArray(Count, Depth) : nullptr; }
+            case 0xde: { uint16 Count; return ReadBigEndian(Count) ? ReadMap(Count, Depth) : nullptr; }
+            case 0xdf: { uint32 Count; return ReadBigEndian(Count) ? ReadMap(Count, Depth) : nullptr; }
+
+            default:
+                Fail(FString::Printf(TEXT("Unsupported MessagePack type 0x%02x"), Type));
+                return nullptr;
+            }
+        }
+
+    private:
+
+        TSharedPtr<FJsonValue> ReadString(uint64 Length)
+        {
+            const uint8* Text = nullptr;
+            return ReadSpan(Length, Text) ? MakeString(Text, Length) : TSharedPtr<FJsonValue>();
+        }
+
+        TSharedPtr<FJsonValue> ReadBinary(uint64 Length)
+        {
+            const uint8* Data = nullptr;
+            if (!ReadSpan(Length, Data))
+            {
+                return nullptr;
+            }
+            return MakeShared<FJsonValueString>(FBase64::Encode(Data, (uint32)Length));
+        }
+
+        TSharedPtr<FJsonValue> ReadArray(uint64 Count, int32 Depth)
+        {
+            if (!CheckCount(Count))
+            {
+                return nullptr;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            Elements.Reserve((int32)Count);
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                TSharedPtr<FJsonValue> Element = Read(Depth + 1);
+                if (!Element.IsValid())
+                {
+                    return nullptr;
+                }
+                Elements.Add(MoveTemp(Element));
+            }
+            return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+        }
+
+        TSharedPtr<FJsonValue> ReadMap(uint64 Count, int32 Depth)
+        {
+            if (!CheckCount(Count))
+            {
+                return nullptr;
+            }
+
+            TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                TSharedPtr<FJsonValue> Key = Read(Depth + 1);
+                TSharedPtr<FJsonValue> Value = Key.IsValid() ? Read(Depth + 1) : nullptr;
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                if (!AddField(*Object, Key, Value))
+                {
+                    Fail(TEXT("Unsupported MessagePack map key"));
+                    return nullptr;
+                }
+            }
+            return MakeShared<FJsonValueObject>(Object);
+        }
+    };
+
+    class FCborReader : public FByteReader
+    {
+    public:
+
+        using FByteReader::FByteReader;
+
+        static constexpr uint8 Break = 0xff;
+        static constexpr uint8 Indefinite = 31;
+
+        TSharedPtr<FJsonValue> Read(int32 Depth = 0)
+        {
+            if (Depth > MaxDepth)
+            {
+                Fail(TEXT("CBOR nested too deeply"));
+                return nullptr;
+            }
+
+            uint8 Initial = 0;
+            if (!ReadByte(Initial))
+            {
+                return nullptr;
+            }
+            const uint8 Major = Initial >> 5;
+            const uint8 Info = Initial & 0x1f;
+
+            if (Major == 7)
+            {
+                return ReadSimple(Info);
+            }
+
+            if (Info == Indefinite)
+            {
+                switch (Major)
+                {
+                case 2:
+                case 3: return ReadIndefiniteString(Major);
+                case 4: return ReadArray(MAX_uint64, Depth);
+                case 5: return ReadMap(MAX_uint64, Depth);
+                default:
+                    Fail(TEXT("Invalid indefinite-length CBOR item"));
+                    return nullptr;
+                }
+            }
+
+            uint64 Argument = 0;
+            if (!ReadArgument(Info, Argument))
+            {
+                return nullptr;
+            }
+
+            switch (Major)
+            {
+            case 0:
+                return MakeUnsigned(Argument);
+
+            case 1:
+                // -1 - Argument; beyond int64 only the magnitude matters to a double
+                return Argument < (uint64)MAX_int64
+                    ? MakeSigned(-1 - (int64)Argument)
+                    : MakeShared<FJsonValueNumber>(-1.0 - (double)Argument);
+
+            case 2:
+            {
+                const uint8* Data = nullptr;
+                return ReadSpan(Argument, Data) ? MakeShared<FJsonValueString>(FBase64::Encode(Data, (uint32)Argument)) : TSharedPtr<FJsonValue>();
+            }
+
+            case 3:
+            {
+                const uint8* Text = nullptr;
+                return ReadSpan(Argument, Text) ? MakeString(Text, Argument) : TSharedPtr<FJsonValue>();
+            }
+
+            case 4:
+                return CheckCount(Argument) ? ReadArray(Argument, Depth) : nullptr;
+
+            case 5:
+                return CheckCount(Argument) ? ReadMap(Argument, Depth) : nullptr;
+
+            default:
+                // Tag: the tagged value is read as if untagged
+                return Read(Depth + 1);
+            }
+        }
+
+    private:
+
+        bool ReadArgument(uint8 Info, uint64& OutArgument)
+        {
+            switch (Info)
+            {
+            case 24: { uint8 Value;  if (!ReadBigEndian(Value)) { return false; } OutArgument = Value; return true; }
+            case 25: { uint16 Value; if (!ReadBigEndian(Value)) { return false; } OutArgument = Value; return true; }
+            case 26: { uint32 Value; if (!ReadBigEndian(Value)) { return false; } OutArgument = Value; return true; }
+            case 27: return ReadBigEndian(OutArgument);
+            default:
+                if (Info < 24)
+                {
+                    OutArgument = Info;
+                    return true;
+                }
+                return Fail(TEXT("Invalid CBOR length"));
+            }
+        }
+
+        TSharedPtr<FJsonValue> ReadSimple(uint8 Info)
+        {
+            switch (Info)
+            {
+            case 20: return MakeShared<FJsonValueBoolean>(false);
+            case 21: return MakeShared<FJsonValueBoolean>(true);
+            case 22:
+            case 23: return MakeShared<FJsonValueNull>();
+            case 25:
+            {
+                uint16 Half = 0;
+                return ReadBigEndian(Half) ? MakeShared<FJsonValueNumber>(HalfToDouble(Half)) : TSharedPtr<FJsonValue>();
+            }
+            case 26: { double Value; return ReadFloat(Value) ? MakeShared<FJsonValueNumber>(Value) : TSharedPtr<FJsonValue>(); }
+            case 27: { double Value; return ReadDouble(Value) ? MakeShared<FJsonValueNumber>(Value) : TSharedPtr<FJsonValue>(); }
+            default:
+                Fail(FString::Printf(TEXT("Unsupported CBOR simple value %d"), Info));
+                return nullptr;
+            }
+        }
+
+        static double HalfToDouble(uint16 Half)
+        {
+            const int32 Exponent = (Half >> 10) & 0x1f;
+            const int32 Mantissa = Half & 0x3ff;
+            const double Value =
+                Exponent == 0 ? Mantissa * FMath::Pow(2.0, -24.0) :
+                Exponent != 31 ? (Mantissa + 1024) * FMath::Pow(2.0, Exponent - 25.0) :
+                Mantissa == 0 ? TNumericLimits<double>::Max() : 0.0;
+            return (Half & 0x8000) ? -Value : Value;
+        }
+
+        /** Indefinite byte/text strings are a series of definite chunks of the same type */
+        TSharedPtr<FJsonValue> ReadIndefiniteString(uint8 Major)
+        {
+            TArray<uint8> Joined;
+            while (!Peek(Break))
+            {
+                uint8 Initial = 0;
+                uint64 Length = 0;
+                const uint8* Chunk = nullptr;
+                if (!ReadByte(Initial))
+                {
+                    return nullptr;
+                }
+                if ((Initial >> 5) != Major || (Initial & 0x1f) == Indefinite)
+                {
+                    Fail(TEXT("Invalid chunk in indefinite-length CBOR string"));
+                    return nullptr;
+                }
+                if (!ReadArgument(Initial & 0x1f, Length) || !ReadSpan(Length, Chunk))
+                {
+                    return nullptr;
+                }
+                Joined.Append(Chunk, (int32)Length);
+            }
+            uint8 Terminator;
+            ReadByte(Terminator);
+
+            return Major == 3
+                ? MakeString(Joined.GetData(), Joined.Num())
+                : MakeShared<FJsonValueString>(FBase64::Encode(Joined.GetData(), Joined.Num()));
+        }
+
+        /** Count is MAX_uint64 for indefinite length (ends at a break byte) */
+        TSharedPtr<FJsonValue> ReadArray(uint64 Count, int32 Depth)
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            if (Count != MAX_uint64)
+            {
+                Elements.Reserve((int32)Count);
+            }
+
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                if (Count == MAX_uint64 && Peek(Break))
+                {
+                    uint8 Terminator;
+                    ReadByte(Terminator);
+                    break;
+                }
+
+                TSharedPtr<FJsonValue> Element = Read(Depth + 1);
+                if (!Element.IsValid())
+                {
+                    return nullptr;
+                }
+                Elements.Add(MoveTemp(Element));
+            }
+            return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+        }
+
+        TSharedPtr<FJsonValue> ReadMap(uint64 Count, int32 Depth)
+        {
+            TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                if (Count == MAX_uint64 && Peek(Break))
+                {
+                    uint8 Terminator;
+                    ReadByte(Terminator);
+                    break;
+                }
+
+                TSharedPtr<FJsonValue> Key = Read(Depth + 1);
+                TSharedPtr<FJsonValue> Value = Key.IsValid() ? Read(Depth + 1) : nullptr;
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                if (!AddField(*Object, Key, Value))
+                {
+                    Fail(TEXT("Unsupported CBOR map key"));
+                    return nullptr;
+                }
+            }
+            return MakeShared<FJsonValueObject>(Object);
+        }
+    };
+
+    static FString ToCondensedJson(const TSharedRef<FJsonValue>& Value)
+    {
+        FString Json;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+        FJsonSerializer::Serialize(Value, FString(), Writer);
+        return Json;
+    }
+
+    static TSharedPtr<FJsonValue> ParseJson(const FString& Json, FString& OutError)
+    {
+        TSharedPtr<FJsonValue> Value;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+        if (!FJsonSerializer::Deserialize(Reader, Value) || !Value.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Invalid JSON: %s"), *Reader->GetErrorMessage());
+            return nullptr;
+        }
+        return Value;
+    }
+}
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpPayloadCodecCommands
+{
+    /** Size and encode/decode time of a captured JSON payload in each format */
+    static void CompareFormats(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Usage: HttpBlueprint.Codec.Compare <JsonFile> [Iterations] [ProtobufStruct]"));
+            return;
+        }
+
+        FString JsonText;
+        if (!FFileHelper::LoadFileToString(JsonText, *Args[0]))
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Could not read '%s'"), *Args[0]);
+            return;
+        }
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+
+        FString Error;
+        const TSharedPtr<FJsonValue> Value = HttpPayloadCodecDetail::ParseJson(JsonText, Error);
+        if (!Value.IsValid())
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("%s: %s"), *Args[0], *Error);
+            return;
+        }
+
+        int32 JsonBytes = 0;
+        for (const EHttpPayloadFormat Format : { EHttpPayloadFormat::Json, EHttpPayloadFormat::MessagePack, EHttpPayloadFormat::Cbor })
+        {
+            TArray<uint8> Encoded;
+            const double EncodeStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Encoded.Reset();
+                FHttpPayloadCodec::Encode(Format, Value.ToSharedRef(), Encoded);
+            }
+            const double EncodeMs = (FPlatformTime::Seconds() - EncodeStart) * 1000.0 / Iterations;
+
+            const double DecodeStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                FHttpPayloadCodec::Decode(Format, Encoded, Error);
+            }
+            const double DecodeMs = (FPlatformTime::Seconds() - DecodeStart) * 1000.0 / Iterations;
+
+            if (Format == EHttpPayloadFormat::Json)
+            {
+                JsonBytes = Encoded.Num();
+            }
+
+            UE_LOG(LogHttpBlueprintAPI, Display, TEXT("%-12s %9d bytes (%5.1f%%)  encode %8.3f ms  decode %8.3f ms"),
+                *StaticEnum<EHttpPayloadFormat>()->GetNameStringByValue((int64)Format),
+                Encoded.Num(), JsonBytes > 0 ? 100.0 * Encoded.Num() / JsonBytes : 100.0, EncodeMs, DecodeMs);
+        }
+
+        // Protobuf needs the message type the JSON describes
+        if (Args.Num() < 3)
+        {
+            return;
+        }
+
+        const UScriptStruct* Schema = FindFirstObject<UScriptStruct>(*Args[2], EFindFirstObjectOptions::NativeFirst);
+        const TSharedPtr<FJsonObject>* Object = nullptr;
+        if (!Schema || !Value->TryGetObject(Object))
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("No struct '%s' to compare Protobuf with"), *Args[2]);
+            return;
+        }
+
+        FStructOnScope Struct(Schema);
+        FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), Schema, Struct.GetStructMemory());
+
+        TArray<uint8> Encoded;
+        const double EncodeStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Encoded.Reset();
+            FHttpProtobufCodec::Encode(Schema, Struct.GetStructMemory(), Encoded);
+        }
+        const double EncodeMs = (FPlatformTime::Seconds() - EncodeStart) * 1000.0 / Iterations;
+
+        const double DecodeStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            FStructOnScope Decoded(Schema);
+            FHttpProtobufCodec::Decode(Schema, Encoded, Decoded.GetStructMemory(), Error);
+        }
+        const double DecodeMs = (FPlatformTime::Seconds() - DecodeStart) * 1000.0 / Iterations;
+
+        UE_LOG(LogHttpBlueprintAPI, Display, TEXT("%-12s %9d bytes (%5.1f%%)  encode %8.3f ms  decode %8.3f ms  (struct fields only)"),
+            TEXT("Protobuf"), Encoded.Num(), JsonBytes > 0 ? 100.0 * Encoded.Num() / JsonBytes : 100.0, EncodeMs, DecodeMs);
+    }
+
+    static FAutoConsoleCommand CompareCommand(
+        TEXT("HttpBlueprint.Codec.Compare"),
+        TEXT("Compare body size and encode/decode time of JSON, MessagePack, CBOR and (given a struct) Protobuf. Usage: HttpBlueprint.Codec.Compare <JsonFile> [Iterations] [ProtobufStruct]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CompareFormats));
+}
+
+// =============================================================================
+// PAYLOAD CODEC
+// =============================================================================
+
+const TCHAR* FHttpPayloadCodec::GetContentType(EHttpPayloadFormat Format)
+{
+    switch (Format)
+    {
+    case EHttpPayloadFormat::MessagePack: return TEXT("application/msgpack");
+    case EHttpPayloadFormat::Cbor:        return TEXT("application/cbor");
+    case EHttpPayloadFormat::Protobuf:    return TEXT("application/x-protobuf");
+    default:                              return TEXT("application/json");
+    }
+}
+
+FString FHttpPayloadCodec::GetAcceptHeader(EHttpPayloadFormat Format)
+{
+    if (Format == EHttpPayloadFormat::Json)
+    {
+        return TEXT("application/json");
+    }
+    return FString::Printf(TEXT("%s, application/json;q=0.5"), GetContentType(Format));
+}
+
+EHttpPayloadFormat FHttpPayloadCodec::FormatFromContentType(const FString& ContentType)
+{
+    FString MimeType;
+    if (!ContentType.Split(TEXT(";"), &MimeType, nullptr))
+    {
+        MimeType = ContentType;
+    }
+    MimeType.TrimStartAndEndInline();
+
+    // application/msgpack, application/x-msgpack, application/vnd.msgpack
+    if (MimeType.Contains(TEXT("msgpack")))
+    {
+        return EHttpPayloadFormat::MessagePack;
+    }
+    if (MimeType.Equals(TEXT("application/cbor"), ESearchCase::IgnoreCase) || MimeType.EndsWith(TEXT("+cbor")))
+    {
+        return EHttpPayloadFormat::Cbor;
+    }
+    // application/x-protobuf, application/protobuf, application/vnd.google.protobuf
+    if (MimeType.Contains(TEXT("protobuf")))
+    {
+        return EHttpPayloadFormat::Protobuf;
+    }
+    return EHttpPayloadFormat::Json;
+}
+
+EHttpPayloadFormat FHttpPayloadCodec::GetResponseFormat(const FHttpResponseData& Response)
+{
+    for (const TPair<FString, FString>& Header : Response.ResponseHeaders)
+    {
+        if (Header.Key.Equals(TEXT("Content-Type"), ESearchCase::IgnoreCase))
+        {
+            return FormatFromContentType(Header.Value);
+        }
+    }
+    return EHttpPayloadFormat::Json;
+}
+
+bool FHttpPayloadCodec::Encode(EHttpPayloadFormat Format, const TSharedRef<FJsonValue>& Value, TArray<uint8>& OutBytes)
+{
+    using namespace HttpPayloadCodecDetail;
+
+    switch (Format)
+    {
+    case EHttpPayloadFormat::MessagePack:
+        FMessagePackWriter(OutBytes).Write(Value);
+        return true;
+
+    case EHttpPayloadFormat::Cbor:
+        FCborWriter(OutBytes).Write(Value);
+        return true;
+
+    case EHttpPayloadFormat::Protobuf:
+        // Field numbers and types come from a struct; see EncodeStruct
+        return false;
+
+    default:
+    {
+        FTCHARToUTF8 Utf8(*ToCondensedJson(Value));
+        OutBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        return true;
+    }
+    }
+}
+
+bool FHttpPayloadCodec::Encode(EHttpPayloadFormat Format, const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes)
+{
+    return Encode(Format, MakeShared<FJsonValueObject>(Object), OutBytes);
+}
+
+bool FHttpPayloadCodec::EncodeStruct(EHttpPayloadFormat Format, const UScriptStruct* StructType, const void* StructData, TArray<uint8>& OutBytes)
+{
+    check(StructType && StructData);
+
+    if (Format == EHttpPayloadFormat::Protobuf)
+    {
+        return FHttpProtobufCodec::Encode(StructType, StructData, OutBytes);
+    }
+
+    TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    return FJsonObjectConverter::UStructToJsonObject(StructType, StructData, Object) &&
+        Encode(Format, Object, OutBytes);
+}
+
+TSharedPtr<FJsonValue> FHttpPayloadCodec::Decode(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes, FString& OutError)
+{
+    using namespace HttpPayloadCodecDetail;
+
+    auto Finish = [&OutError](FByteReader& Reader, TSharedPtr<FJsonValue>&& Value) -> TSharedPtr<FJsonValue>
+        {
+            if (Value.IsValid() && !Reader.AtEnd())
+            {
+                Reader.Fail(TEXT("Unexpected data after value"));
+                Value.Reset();
+            }
+            OutError = MoveTemp(Reader.Error);
+            return MoveTemp(Value);
+        };
+
+    switch (Format)
+    {
+    case EHttpPayloadFormat::MessagePack:
+    {
+        FMessagePackReader Reader(Bytes);
+        return Finish(Reader, Reader.Read());
+    }
+
+    case EHttpPayloadFormat::Cbor:
+    {
+        FCborReader Reader(Bytes);
+        return Finish(Reader, Reader.Read());
+    }
+
+    case EHttpPayloadFormat::Protobuf:
+        OutError = TEXT("Protobuf bodies can only be decoded with a struct type");
+        return nullptr;
+
+    default:
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        return ParseJson(FString(Converted.Length(), Converted.Get()), OutError);
+    }
+    }
+}
+
+bool FHttpPayloadCodec::DecodeStruct(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes,
+    const UScriptStruct* StructType, void* StructData, FString& OutError)
+{
+    check(StructType && StructData);
+
+    if (Format == EHttpPayloadFormat::Protobuf)
+    {
+        return FHttpProtobufCodec::Decode(StructType, Bytes, StructData, OutError);
+    }
+
+    const TSharedPtr<FJsonValue> Value = Decode(Format, Bytes, OutError);
+    if (!Value.IsValid())
+    {
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* Object = nullptr;
+    if (!Value->TryGetObject(Object) || !FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), StructType, StructData))
+    {
+        OutError = FString::Printf(TEXT("Body does not match %s"), *StructType->GetName());
+        return false;
+    }
+    return true;
+}
+
+bool FHttpPayloadCodec::TranscodeFromJson(EHttpPayloadFormat Format, const FString& Json, TArray<uint8>& OutBytes, FString& OutError,
+    const UScriptStruct* Schema)
+{
+    const TSharedPtr<FJsonValue> Value = HttpPayloadCodecDetail::ParseJson(Json, OutError);
+    if (!Value.IsValid())
+    {
+        return false;
+    }
+
+    if (Format != EHttpPayloadFormat::Protobuf)
+    {
+        return Encode(Format, Value.ToSharedRef(), OutBytes);
+    }
+
+    if (!Schema)
+    {
+        OutError = TEXT("Protobuf bodies need a RequestSchema struct");
+        return false;
+    }
+
+    FStructOnScope Struct(Schema);
+    const TSharedPtr<FJsonObject>* Object = nullptr;
+    if (!Value->TryGetObject(Object) || !FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), Schema, Struct.GetStructMemory()))
+    {
+        OutError = FString::Printf(TEXT("Body does not match %s"), *Schema->GetName());
+        return false;
+    }
+    return FHttpProtobufCodec::Encode(Schema, Struct.GetStructMemory(), OutBytes);
+}
+
+bool FHttpPayloadCodec::TranscodeToJson(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes, FString& OutJson, FString& OutError,
+    const UScriptStruct* Schema)
+{
+    if (Format == EHttpPayloadFormat::Protobuf)
+    {
+        if (!Schema)
+        {
+            OutError = TEXT("Protobuf responses need a ResponseSchema struct");
+            return false;
+        }
+
+        FStructOnScope Struct(Schema);
+        if (!FHttpProtobufCodec::Decode(Schema, Bytes, Struct.GetStructMemory(), OutError))
+        {
+            return false;
+        }
+
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        if (!FJsonObjectConverter::UStructToJsonObject(Schema, Struct.GetStructMemory(), Object))
+        {
+            OutError = FString::Printf(TEXT("Cannot convert %s to JSON"), *Schema->GetName());
+            return false;
+        }
+        OutJson = HttpPayloadCodecDetail::ToCondensedJson(MakeShared<FJsonValueObject>(Object));
+        return true;
+    }
+
+    const TSharedPtr<FJsonValue> Value = Decode(Format, Bytes, OutError);
+    if (!Value.IsValid())
+    {
+        return false;
+    }
+    OutJson = HttpPayloadCodecDetail::ToCondensedJson(Value.ToSharedRef());
+    return true;
+}
@@ -0,0 +1,163 @@
+#include "HttpPrefetcher.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpMemoryTracker.h"
+#include "HttpResponseCache.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpPrefetcherCommands
+{
+    static FAutoConsoleCommand CancelCommand(
+        TEXT("HttpBlueprint.Prefetch.Cancel"),
+        TEXT("Cancel every queued or sent prefetch."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpPrefetcher::Get().CancelAll();
+            }));
+}
+
+// =============================================================================
+// PREFETCHER
+// =============================================================================
+
+FHttpPrefetcher& FHttpPrefetcher::Get()
+{
+    static FHttpPrefetcher Instance;
+    return Instance;
+}
+
+FHttpPrefetcher::FHttpPrefetcher()
+    : CancelFlag(MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false))
+{
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FHttpPrefetcher::Tick), 0.0f);
+    MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddRaw(this, &FHttpPrefetcher::OnMemoryTrim);
+}
+
+int32 FHttpPrefetcher::Enqueue(const TArray<FString>& URLs)
+{
+    check(IsInGameThread());
+
+    int32 NumQueued = 0;
+    for (const FString& URL : URLs)
+    {
+        if (URL.IsEmpty() || InFlight.Contains(URL) || Queue.Contains(URL) || FHttpResponseCache::Get().Contains(TEXT("GET"), URL))
+        {
+            continue;
+        }
+
+        Queue.Add(URL);
+        ++NumQueued;
+    }
+    return NumQueued;
+}
+
+void FHttpPrefetcher::CancelAll()
+{
+    check(IsInGameThread());
+
+    Queue.Empty();
+
+    // The completion path checks the flag before storing, which covers responses that already arrived
+    CancelFlag->Store(true);
+    CancelFlag = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+
+    for (const TPair<FString, FHttpRequestPtr>& Prefetch : InFlight)
+    {
+        ++NumCancelling;
+        if (Prefetch.Value.IsValid())
+        {
+            Prefetch.Value->CancelRequest();
+        }
+    }
+    InFlight.Empty();
+}
+
+bool FHttpPrefetcher::Tick(float DeltaTime)
+{
+    if (Queue.Num() == 0)
+    {
+        return true;
+    }
+
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+    if (Settings.CacheMaxBytes <= 0)
+    {
+        Queue.Empty();
+        return true;
+    }
+
+    // Prefetches, cancelled ones included, are themselves counted in flight; only the other requests make the game busy
+    const int32 InteractiveInFlight = FMath::Max(0, FHttpMemoryTracker::GetSnapshot().RequestsInFlight - InFlight.Num() - NumCancelling);
+    if (InteractiveInFlight >= Settings.PrefetchMaxInteractiveInFlight || FHttpResponseCache::Get().IsFull())
+    {
+        return true;
+    }
+
+    // The cache policy has the completion path store the response
+    FHttpRequestOptions Options;
+    Options.CallbackPriority = EHttpCallbackPriority::Low;
+    Options.CachePolicy = EHttpCachePolicy::FreshOnly;
+    Options.CancelFlag = CancelFlag;
+
+    while (Queue.Num() > 0 && InFlight.Num() < Settings.PrefetchMaxConcurrent)
+    {
+        const FString URL = Queue[0];
+        Queue.RemoveAt(0);
+
+        // Fetched by an interactive request since it was queued
+        if (FHttpResponseCache::Get().Contains(TEXT("GET"), URL))
+        {
+            continue;
+        }
+
+        // Added before sending: a request answered locally calls back at once
+        InFlight.Add(URL);
+        FHttpRequestPtr SentRequest = UHttpBlueprintFunctionLibrary::StartHttpRequest(URL, TEXT("GET"), FString(), TMap<FString, FString>(), Options,
+            FHttpResponseCallback(FOnHttpResponseNative::CreateLambda([this, URL, RequestCancelFlag = CancelFlag](const FHttpResponseData& Response)
+                {
+                    if (RequestCancelFlag->Load())
+                    {
+                        NumCancelling = FMath::Max(0, NumCancelling - 1);
+                        return;
+                    }
+
+                    InFlight.Remove(URL);
+                    if (!FHttpResponseCache::Get().Contains(TEXT("GET"), URL))
+                    {
+                        UE_LOG(LogHttpBlueprintAPI, Verbose, TEXT("Prefetched response not cached: %s (%d)"), *URL, Response.ResponseCode);
+                    }
+                })));
+
+        if (FHttpRequestPtr* StillInFlight = InFlight.Find(URL))
+        {
+            *StillInFlight = MoveTemp(SentRequest);
+        }
+    }
+    return true;
+}
+
+void FHttpPrefetcher::OnMemoryTrim()
+{
+    // The trim delegate may be broadcast from any thread; the queue belongs to the game thread
+    AsyncTask(ENamedThreads::GameThread, [this]()
+        {
+            UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Memory trim: cancelling %d prefetches and clearing the response cache"), Queue.Num() + InFlight.Num());
+            CancelAll();
+            FHttpResponseCache::Get().Clear();
+        });
+}
+
+void FHttpPrefetcher::Shutdown()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+    CancelAll();
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+
+/**
+ * Speculative GET requests that warm FHttpResponseCache while the game is otherwise idle
+ *
+ * Queued URLs are sent from the game-thread ticker a few at a time, and only while fewer than
+ * HttpBlueprint.Prefetch.MaxInteractiveInFlight other requests are in flight, so prefetching
+ * never competes with requests the player is waiting on. At most
+ * HttpBlueprint.Prefetch.MaxConcurrent prefetches run at once, and nothing is sent while the
+ * cache is full. Cancelling stops the prefetches already sent, and none of their responses is
+ * cached afterwards. A memory trim (low memory warning) cancels everything and empties the cache.
+ * Game thread only.
+ */
+class FHttpPrefetcher
+{
+public:
+
+    static FHttpPrefetcher& Get();
+
+    /**
+     * Queue URLs to be fetched into the response cache
+     *
+     * @return Number of URLs queued (URLs already cached, queued or being fetched are skipped)
+     */
+    int32 Enqueue(const TArray<FString>& URLs);
+
+    /** Drop queued prefetches and cancel the ones already sent */
+    void CancelAll();
+
+    int32 GetNumQueued() const { return Queue.Num(); }
+    int32 GetNumInFlight() const { return InFlight.Num(); }
+
+    /** Stop ticking and cancel everything (module shutdown) */
+    void Shutdown();
+
+private:
+
+    FHttpPrefetcher();
+
+    bool Tick(float DeltaTime);
+
+    void OnMemoryTrim();
+
+    /** URLs waiting to be sent, oldest first */
+    TArray<FString> Queue;
+
+    /** URLs sent and not yet stored, with their requests (null when answered without one) */
+    TMap<FString, FHttpRequestPtr> InFlight;
+
+    /** Cancelled prefetches whose completion has not run yet; still counted in flight by the memory tracker */
+    int32 NumCancelling = 0;
+
+    /** Shared with the prefetches sent since the last CancelAll, which sets it and starts a new one */
+    TSharedRef<TAtomic<bool>, ESPMode::ThreadSafe> CancelFlag;
+
+    FTSTicker::FDelegateHandle TickHandle;
+    FDelegateHandle MemoryTrimHandle;
+};
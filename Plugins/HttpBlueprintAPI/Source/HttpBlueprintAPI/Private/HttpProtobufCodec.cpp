@@ -0,0 +1,983 @@
+#include "HttpProtobufCodec.h"
+#include "HttpBlueprintAPI.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+#include "Algo/Sort.h"
+
+// =============================================================================
+// WIRE READER
+// =============================================================================
+
+bool FHttpProtobufReader::NextField(uint32& OutFieldNumber, EWireType& OutWireType)
+{
+    uint64 Key = 0;
+    if (AtEnd() || !ReadVarint(Key))
+    {
+        return false;
+    }
+
+    const uint64 WireType = Key & 7;
+    if ((Key >> 3) == 0 || (Key >> 3) > MAX_int32 ||
+        (WireType != 0 && WireType != 1 && WireType != 2 && WireType != 5))
+    {
+        return Fail();
+    }
+
+    OutFieldNumber = (uint32)(Key >> 3);
+    OutWireType = (EWireType)WireType;
+    return true;
+}
+
+bool FHttpProtobufReader::ReadVarintSlow(uint64& OutValue)
+{
+    uint64 Result = 0;
+
+    // With ten bytes left the longest varint fits, so the loop needs no bounds checks
+    if (End - Cur >= 10)
+    {
+        const uint8* Ptr = Cur;
+        for (int32 Shift = 0; Shift < 64; Shift += 7)
+        {
+            const uint8 Byte = *Ptr++;
+            Result |= (uint64)(Byte & 0x7f) << Shift;
+            if (Byte < 0x80)
+            {
+                Cur = Ptr;
+                OutValue = Result;
+                return true;
+            }
+        }
+        return Fail();
+    }
+
+    for (int32 Shift = 0; Shift < 64 && Cur < End; Shift += 7)
+    {
+        const uint8 Byte = *Cur++;
+        Result |= (uint64)(Byte & 0x7f) << Shift;
+        if (Byte < 0x80)
+        {
+            OutValue = Result;
+            return true;
+        }
+    }
+    return Fail();
+}
+
+bool FHttpProtobufReader::ReadFixed32(uint32& OutValue)
+{
+    if (End - Cur < 4)
+    {
+        return Fail();
+    }
+    OutValue = (uint32)Cur[0] | ((uint32)Cur[1] << 8) | ((uint32)Cur[2] << 16) | ((uint32)Cur[3] << 24);
+    Cur += 4;
+    return true;
+}
+
+bool FHttpProtobufReader::ReadFixed64(uint64& OutValue)
+{
+    uint32 Low = 0;
+    uint32 High = 0;
+    if (!ReadFixed32(Low) || !ReadFixed32(High))
+    {
+        return false;
+    }
+    OutValue = (uint64)Low | ((uint64)High << 32);
+    return true;
+}
+
+bool FHttpProtobufReader::ReadBytes(TArrayView<const uint8>& OutBytes)
+{
+    uint64 Length = 0;
+    if (!ReadVarint(Length))
+    {
+        return false;
+    }
+    if (Length > (uint64)(End - Cur))
+    {
+        return Fail();
+    }
+
+    OutBytes = TArrayView<const uint8>(Cur, (int32)Length);
+    Cur += Length;
+    return true;
+}
+
+bool FHttpProtobufReader::ReadString(FUtf8StringView& OutString)
+{
+    TArrayView<const uint8> Bytes;
+    if (!ReadBytes(Bytes))
+    {
+        return false;
+    }
+    OutString = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num());
+    return true;
+}
+
+bool FHttpProtobufReader::SkipField(EWireType WireType)
+{
+    switch (WireType)
+    {
+    case EWireType::Varint:
+    {
+        uint64 Ignored;
+        return ReadVarint(Ignored);
+    }
+    case EWireType::Fixed64:
+    {
+        uint64 Ignored;
+        return ReadFixed64(Ignored);
+    }
+    case EWireType::Fixed32:
+    {
+        uint32 Ignored;
+        return ReadFixed32(Ignored);
+    }
+    default:
+    {
+        TArrayView<const uint8> Ignored;
+        return ReadBytes(Ignored);
+    }
+    }
+}
+
+// =============================================================================
+// SCHEMA
+// =============================================================================
+
+namespace HttpProtobufCodecDetail
+{
+    using EWireType = FHttpProtobufReader::EWireType;
+
+    /** Nested messages deeper than this are rejected (protobuf's own default limit) */
+    constexpr int32 MaxDepth = 100;
+
+    /** Field number tables up to this size are indexed directly */
+    constexpr int32 MaxDenseFieldNumber = 1024;
+
+    enum class EProtoKind : uint8
+    {
+        Bool,
+        Int32,
+        Int64,
+        UInt32,
+        UInt64,
+        Float,
+        Double,
+        String,
+        Name,
+        Text,
+        Bytes,
+        Message
+    };
+
+    static EWireType GetWireType(EProtoKind Kind)
+    {
+        switch (Kind)
+        {
+        case EProtoKind::Float:  return EWireType::Fixed32;
+        case EProtoKind::Double: return EWireType::Fixed64;
+        case EProtoKind::String:
+        case EProtoKind::Name:
+        case EProtoKind::Text:
+        case EProtoKind::Bytes:
+        case EProtoKind::Message: return EWireType::LengthDelimited;
+        default:                  return EWireType::Varint;
+        }
+    }
+
+    struct FProtoField
+    {
+        int32 Number = 0;
+        EProtoKind Kind = EProtoKind::Int32;
+        EWireType WireType = EWireType::Varint;
+        bool bRepeated = false;
+
+        /** Key written before each value, and before a packed run of repeated scalars */
+        uint32 Tag = 0;
+        uint32 PackedTag = 0;
+
+        /** The UPROPERTY (locates the field in the struct) */
+        const FProperty* Property = nullptr;
+
+        /** Property of one value: the field itself, or the inner property of a repeated field */
+        const FProperty* ValueProperty = nullptr;
+        const FNumericProperty* Numeric = nullptr;
+        const FArrayProperty* Array = nullptr;
+        const UScriptStruct* MessageType = nullptr;
+    };
+
+    struct FSchema
+    {
+        /** Sorted by field number */
+        TArray<FProtoField> Fields;
+
+        /** Field number -> index in Fields (INDEX_NONE if unused), when numbers are small */
+        TArray<int32> DenseIndex;
+
+        /** C++ structs keep their properties until reinstanced; user-defined ones can be collected */
+        bool bNative = false;
+
+        const FProtoField* Find(uint32 Number) const
+        {
+            if (DenseIndex.Num() > 0)
+            {
+                return Number < (uint32)DenseIndex.Num() && DenseIndex[Number] != INDEX_NONE ? &Fields[DenseIndex[Number]] : nullptr;
+            }
+
+            const int32 Index = Algo::LowerBoundBy(Fields, (int32)Number, &FProtoField::Number);
+            return Fields.IsValidIndex(Index) && Fields[Index].Number == (int32)Number ? &Fields[Index] : nullptr;
+        }
+    };
+
+    /** Map one (non-array) property onto a protobuf value type */
+    static bool ResolveKind(const FProperty* Property, FProtoField& Field)
+    {
+        if (Property->IsA<FBoolProperty>())
+        {
+            Field.Kind = EProtoKind::Bool;
+        }
+        else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+        {
+            Field.Kind = EProtoKind::Int32;
+            Field.Numeric = EnumProperty->GetUnderlyingProperty();
+        }
+        else if (const FNumericProperty* Numeric = CastField<FNumericProperty>(Property))
+        {
+            Field.Numeric = Numeric;
+            if (Numeric->IsFloatingPoint())
+            {
+                Field.Kind = Property->IsA<FDoubleProperty>() ? EProtoKind::Double : EProtoKind::Float;
+            }
+            else if (Property->IsA<FInt64Property>())
+            {
+                Field.Kind = EProtoKind::Int64;
+            }
+            else if (Property->IsA<FUInt64Property>())
+            {
+                Field.Kind = EProtoKind::UInt64;
+            }
+            else if (Property->IsA<FInt8Property>() || Property->IsA<FInt16Property>() || Property->IsA<FIntProperty>())
+            {
+                Field.Kind = EProtoKind::Int32;
+            }
+            else
+            {
+                // uint8 (including byte enums), uint16, uint32
+                Field.Kind = EProtoKind::UInt32;
+            }
+        }
+        else if (Property->IsA<FStrProperty>())
+        {
+            Field.Kind = EProtoKind::String;
+        }
+        else if (Property->IsA<FNameProperty>())
+        {
+            Field.Kind = EProtoKind::Name;
+        }
+        else if (Property->IsA<FTextProperty>())
+        {
+            Field.Kind = EProtoKind::Text;
+        }
+        else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            Field.Kind = EProtoKind::Message;
+            Field.MessageType = StructProperty->Struct;
+        }
+        else
+        {
+            return false;
+        }
+
+        Field.ValueProperty = Property;
+        return true;
+    }
+
+    static bool ResolveField(const FProperty* Property, FProtoField& Field)
+    {
+        Field.Property = Property;
+
+        const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+        if (!ArrayProperty)
+        {
+            return ResolveKind(Property, Field);
+        }
+
+        // TArray<uint8> is a bytes field rather than a repeated one
+        const FByteProperty* ByteInner = CastField<FByteProperty>(ArrayProperty->Inner);
+        if (ByteInner && !ByteInner->Enum)
+        {
+            Field.Kind = EProtoKind::Bytes;
+            Field.ValueProperty = Property;
+            Field.Array = ArrayProperty;
+            return true;
+        }
+
+        Field.bRepeated = true;
+        Field.Array = ArrayProperty;
+        return ResolveKind(ArrayProperty->Inner, Field);
+    }
+
+    using FSchemaRef = TSharedRef<const FSchema, ESPMode::ThreadSafe>;
+
+    /**
+     * Shared, so RegisterFieldNumbers and ClearSchemaCache can drop schemas an encode or decode is still using
+     * Keyed by FObjectKey: a struct allocated where a collected one used to be gets a new key, not its schema.
+     */
+    static FRWLock SchemaLock;
+    static TMap<FObjectKey, TSharedPtr<const FSchema, ESPMode::ThreadSafe>> Schemas;
+    static TMap<FObjectKey, TMap<FName, int32>> RegisteredNumbers;
+
+    static FDelegateHandle ObjectsReplacedHandle;
+    static FDelegateHandle PreGarbageCollectHandle;
+    static FDelegateHandle PostGarbageCollectHandle;
+
+    /** Reinstancing can change any struct's properties; registered numbers follow the struct to its new instance */
+    static void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects)
+    {
+        FWriteScopeLock Lock(SchemaLock);
+        Schemas.Empty();
+
+        for (const TPair<UObject*, UObject*>& Replaced : ReplacedObjects)
+        {
+            TMap<FName, int32> Numbers;
+            if (Replaced.Value && RegisteredNumbers.RemoveAndCopyValue(FObjectKey(Replaced.Key), Numbers))
+            {
+                RegisteredNumbers.FindOrAdd(FObjectKey(Replaced.Value)).Append(MoveTemp(Numbers));
+            }
+        }
+    }
+
+    /** The schemas point at FProperty objects a collected user-defined struct takes with it */
+    static void OnPreGarbageCollect()
+    {
+        FWriteScopeLock Lock(SchemaLock);
+        for (auto It = Schemas.CreateIterator(); It; ++It)
+        {
+            if (!It.Value()->bNative)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    /** Forget the numbers registered for structs that were collected */
+    static void OnPostGarbageCollect()
+    {
+        FWriteScopeLock Lock(SchemaLock);
+        for (auto It = RegisteredNumbers.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    static FSchemaRef CompileSchema(const UScriptStruct* StructType)
+    {
+        TMap<FName, int32> Registered;
+        {
+            FReadScopeLock Lock(SchemaLock);
+            if (const TMap<FName, int32>* Found = RegisteredNumbers.Find(FObjectKey(StructType)))
+            {
+                Registered = *Found;
+            }
+        }
+
+        TSharedRef<FSchema, ESPMode::ThreadSafe> Schema = MakeShared<FSchema, ESPMode::ThreadSafe>();
+        Schema->bNative = (StructType->StructFlags & STRUCT_Native) != 0;
+        bool bUsedDeclarationOrder = false;
+
+        // Declaration order counts every property, so skipping an unsupported one does not renumber the rest
+        int32 DeclarationIndex = 0;
+        for (TFieldIterator<FProperty> It(StructType); It; ++It)
+        {
+            const FProperty* Property = *It;
+            ++DeclarationIndex;
+
+            FProtoField Field;
+            if (Property->ArrayDim != 1 || !ResolveField(Property, Field))
+            {
+                UE_LOG(LogHttpBlueprintAPI, Verbose, TEXT("Protobuf: %s.%s has no protobuf mapping and is skipped"),
+                    *StructType->GetName(), *Property->GetName());
+                continue;
+            }
+
+            if (const int32* Number = Registered.Find(Property->GetFName()))
+            {
+                Field.Number = *Number;
+            }
+#if WITH_METADATA
+            else if (Property->HasMetaData(TEXT("ProtoField")))
+            {
+                Field.Number = FCString::Atoi(*Property->GetMetaData(TEXT("ProtoField")));
+            }
+#endif
+            else
+            {
+                Field.Number = DeclarationIndex;
+                bUsedDeclarationOrder = true;
+            }
+
+            if (Field.Number <= 0 || Field.Number > 536870911)
+            {
+                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Protobuf: %s.%s has invalid field number %d and is skipped"),
+                    *StructType->GetName(), *Property->GetName(), Field.Number);
+                continue;
+            }
+
+            Field.WireType = GetWireType(Field.Kind);
+            Field.Tag = ((uint32)Field.Number << 3) | (uint32)Field.WireType;
+            Field.PackedTag = ((uint32)Field.Number << 3) | (uint32)EWireType::LengthDelimited;
+            Schema->Fields.Add(Field);
+        }
+
+#if !WITH_METADATA
+        if (bUsedDeclarationOrder && Registered.Num() == 0)
+        {
+            UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Protobuf: %s has no registered field numbers; using declaration order"),
+                *StructType->GetName());
+        }
+#endif
+
+        Algo::SortBy(Schema->Fields, &FProtoField::Number);
+        for (int32 Index = Schema->Fields.Num() - 1; Index > 0; --Index)
+        {
+            if (Schema->Fields[Index].Number == Schema->Fields[Index - 1].Number)
+            {
+                UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Protobuf: %s.%s reuses field number %d and is skipped"),
+                    *StructType->GetName(), *Schema->Fields[Index].Property->GetName(), Schema->Fields[Index].Number);
+                Schema->Fields.RemoveAt(Index);
+            }
+        }
+
+        if (Schema->Fields.Num() > 0 && Schema->Fields.Last().Number <= MaxDenseFieldNumber)
+        {
+            Schema->DenseIndex.Init(INDEX_NONE, Schema->Fields.Last().Number + 1);
+            for (int32 Index = 0; Index < Schema->Fields.Num(); ++Index)
+            {
+                Schema->DenseIndex[Schema->Fields[Index].Number] = Index;
+            }
+        }
+
+        return Schema;
+    }
+
+    /** The returned reference keeps the schema alive for the encode or decode that uses it */
+    static FSchemaRef GetSchema(const UScriptStruct* StructType)
+    {
+        {
+            FReadScopeLock Lock(SchemaLock);
+            if (const TSharedPtr<const FSchema, ESPMode::ThreadSafe>* Found = Schemas.Find(FObjectKey(StructType)))
+            {
+                return Found->ToSharedRef();
+            }
+        }
+
+        FSchemaRef Compiled = CompileSchema(StructType);
+
+        FWriteScopeLock Lock(SchemaLock);
+        TSharedPtr<const FSchema, ESPMode::ThreadSafe>& Slot = Schemas.FindOrAdd(FObjectKey(StructType));
+        if (!Slot.IsValid())
+        {
+            Slot = Compiled;
+        }
+        return Slot.ToSharedRef();
+    }
+}
+
+// =============================================================================
+// ENCODING
+// =============================================================================
+
+namespace HttpProtobufCodecDetail
+{
+    class FProtoWriter
+    {
+    public:
+
+        explicit FProtoWriter(TArray<uint8>& InOut) : Out(InOut) {}
+
+        void WriteMessage(const FSchema& Schema, const void* StructData)
+        {
+            for (const FProtoField& Field : Schema.Fields)
+            {
+                const void* FieldData = Field.Property->ContainerPtrToValuePtr<void>(StructData);
+
+                if (!Field.bRepeated)
+                {
+                    if (Field.Kind == EProtoKind::Message || !IsDefault(Field, FieldData))
+                    {
+                        WriteVarint(Field.Tag);
+                        WriteValue(Field, FieldData);
+                    }
+                    continue;
+                }
+
+                FScriptArrayHelper Elements(Field.Array, FieldData);
+                if (Elements.Num() == 0)
+                {
+                    continue;
+                }
+
+                // Repeated scalars are packed into one length-delimited run
+                if (Field.WireType != EWireType::LengthDelimited)
+                {
+                    WriteVarint(Field.PackedTag);
+                    const int32 LengthPos = BeginLength();
+                    for (int32 Index = 0; Index < Elements.Num(); ++Index)
+                    {
+                        WriteValue(Field, Elements.GetRawPtr(Index));
+                    }
+                    EndLength(LengthPos);
+                    continue;
+                }
+
+                for (int32 Index = 0; Index < Elements.Num(); ++Index)
+                {
+                    WriteVarint(Field.Tag);
+                    WriteValue(Field, Elements.GetRawPtr(Index));
+                }
+            }
+        }
+
+    private:
+
+        FORCEINLINE void WriteVarint(uint64 Value)
+        {
+            if (Value < 0x80)
+            {
+                Out.Add((uint8)Value);
+                return;
+            }
+
+            uint8 Buffer[10];
+            int32 Length = 0;
+            while (Value >= 0x80)
+            {
+                Buffer[Length++] = (uint8)(Value | 0x80);
+                Value >>= 7;
+            }
+            Buffer[Length++] = (uint8)Value;
+            Out.Append(Buffer, Length);
+        }
+
+        void WriteFixed32(uint32 Value)
+        {
+            const uint8 Bytes[4] = { (uint8)Value, (uint8)(Value >> 8), (uint8)(Value >> 16), (uint8)(Value >> 24) };
+            Out.Append(Bytes, 4);
+        }
+
+        void WriteFixed64(uint64 Value)
+        {
+            WriteFixed32((uint32)Value);
+            WriteFixed32((uint32)(Value >> 32));
+        }
+
+        void WriteUtf8(const FString& String)
+        {
+            FTCHARToUTF8 Utf8(*String);
+            WriteVarint((uint64)Utf8.Length());
+            Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        }
+
+        /**
+         * Lengths of nested messages are not known up front: reserve one byte (enough below 128)
+         * and move the payload along in the rare case the length needs more
+         */
+        int32 BeginLength()
+        {
+            const int32 LengthPos = Out.Num();
+            Out.AddUninitialized(1);
+            return LengthPos;
+        }
+
+        void EndLength(int32 LengthPos)
+        {
+            uint64 Length = (uint64)(Out.Num() - LengthPos - 1);
+            if (Length < 0x80)
+            {
+                Out[LengthPos] = (uint8)Length;
+                return;
+            }
+
+            uint8 Buffer[10];
+            int32 Size = 0;
+            while (Length >= 0x80)
+            {
+                Buffer[Size++] = (uint8)(Length | 0x80);
+                Length >>= 7;
+            }
+            Buffer[Size++] = (uint8)Length;
+
+            Out.InsertUninitialized(LengthPos + 1, Size - 1);
+            FMemory::Memcpy(Out.GetData() + LengthPos, Buffer, Size);
+        }
+
+        static bool IsDefault(const FProtoField& Field, const void* Value)
+        {
+            switch (Field.Kind)
+            {
+            case EProtoKind::Bool:   return !CastFieldChecked<const FBoolProperty>(Field.ValueProperty)->GetPropertyValue(Value);
+            case EProtoKind::Int32:
+            case EProtoKind::Int64:  return Field.Numeric->GetSignedIntPropertyValue(Value) == 0;
+            case EProtoKind::UInt32:
+            case EProtoKind::UInt64: return Field.Numeric->GetUnsignedIntPropertyValue(Value) == 0;
+            case EProtoKind::Float:
+            case EProtoKind::Double: return Field.Numeric->GetFloatingPointPropertyValue(Value) == 0.0;
+            case EProtoKind::String: return static_cast<const FString*>(Value)->IsEmpty();
+            case EProtoKind::Name:   return static_cast<const FName*>(Value)->IsNone();
+            case EProtoKind::Text:   return static_cast<const FText*>(Value)->IsEmpty();
+            case EProtoKind::Bytes:  return FScriptArrayHelper(Field.Array, Value).Num() == 0;
+            default:                 return false;
+            }
+        }
+
+        void WriteValue(const FProtoField& Field, const void* Value)
+        {
+            switch (Field.Kind)
+            {
+            case EProtoKind::Bool:
+                WriteVarint(CastFieldChecked<const FBoolProperty>(Field.ValueProperty)->GetPropertyValue(Value) ? 1 : 0);
+                break;
+
+            case EProtoKind::Int32:
+            case EProtoKind::Int64:
+                // Negative numbers are sign-extended to 64 bits, as protobuf does
+                WriteVarint((uint64)Field.Numeric->GetSignedIntPropertyValue(Value));
+                break;
+
+            case EProtoKind::UInt32:
+            case EProtoKind::UInt64:
+                WriteVarint(Field.Numeric->GetUnsignedIntPropertyValue(Value));
+                break;
+
+            case EProtoKind::Float:
+            {
+                const float Number = (float)Field.Numeric->GetFloatingPointPropertyValue(Value);
+                uint32 Bits;
+                FMemory::Memcpy(&Bits, &Number, sizeof(Bits));
+                WriteFixed32(Bits);
+                break;
+            }
+
+            case EProtoKind::Double:
+            {
+                const double Number = Field.Numeric->GetFloatingPointPropertyValue(Value);
+                uint64 Bits;
+                FMemory::Memcpy(&Bits, &Number, sizeof(Bits));
+                WriteFixed64(Bits);
+                break;
+            }
+
+            case EProtoKind::String:
+                WriteUtf8(*static_cast<const FString*>(Value));
+                break;
+
+            case EProtoKind::Name:
+                WriteUtf8(static_cast<const FName*>(Value)->ToString());
+                break;
+
+            case EProtoKind::Text:
+                WriteUtf8(static_cast<const FText*>(Value)->ToString());
+                break;
+
+            case EProtoKind::Bytes:
+            {
+                FScriptArrayHelper Bytes(Field.Array, Value);
+                WriteVarint((uint64)Bytes.Num());
+                Out.Append(Bytes.Num() > 0 ? Bytes.GetRawPtr(0) : nullptr, Bytes.Num());
+                break;
+            }
+
+            case EProtoKind::Message:
+            {
+                const int32 LengthPos = BeginLength();
+                WriteMessage(*GetSchema(Field.MessageType), Value);
+                EndLength(LengthPos);
+                break;
+            }
+            }
+        }
+
+        TArray<uint8>& Out;
+    };
+}
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+namespace HttpProtobufCodecDetail
+{
+    static bool ReadMessage(const FSchema& Schema, FHttpProtobufReader& Reader, void* StructData, int32 Depth, FString& OutError);
+
+    /** Read one value of Field (already known to have the right wire type) into Value */
+    static bool ReadValue(const FProtoField& Field, FHttpProtobufReader& Reader, void* Value, int32 Depth, FString& OutError)
+    {
+        switch (Field.Kind)
+        {
+        case EProtoKind::Bool:
+        {
+            uint64 Varint = 0;
+            if (!Reader.ReadVarint(Varint))
+            {
+                return false;
+            }
+            CastFieldChecked<const FBoolProperty>(Field.ValueProperty)->SetPropertyValue(Value, Varint != 0);
+            return true;
+        }
+
+        case EProtoKind::Int32:
+        case EProtoKind::Int64:
+        {
+            uint64 Varint = 0;
+            if (!Reader.ReadVarint(Varint))
+            {
+                return false;
+            }
+            Field.Numeric->SetIntPropertyValue(Value, (int64)Varint);
+            return true;
+        }
+
+        case EProtoKind::UInt32:
+        case EProtoKind::UInt64:
+        {
+            uint64 Varint = 0;
+            if (!Reader.ReadVarint(Varint))
+            {
+                return false;
+            }
+            Field.Numeric->SetIntPropertyValue(Value, Varint);
+            return true;
+        }
+
+        case EProtoKind::Float:
+        {
+            uint32 Bits = 0;
+            if (!Reader.ReadFixed32(Bits))
+            {
+                return false;
+            }
+            float Number;
+            FMemory::Memcpy(&Number, &Bits, sizeof(Number));
+            Field.Numeric->SetFloatingPointPropertyValue(Value, (double)Number);
+            return true;
+        }
+
+        case EProtoKind::Double:
+        {
+            uint64 Bits = 0;
+            if (!Reader.ReadFixed64(Bits))
+            {
+                return false;
+            }
+            double Number;
+            FMemory::Memcpy(&Number, &Bits, sizeof(Number));
+            Field.Numeric->SetFloatingPointPropertyValue(Value, Number);
+            return true;
+        }
+
+        case EProtoKind::String:
+        case EProtoKind::Name:
+        case EProtoKind::Text:
+        {
+            // Converted straight from the response buffer; no intermediate copy
+            FUtf8StringView View;
+            if (!Reader.ReadString(View))
+            {
+                return false;
+            }
+
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+            if (Field.Kind == EProtoKind::String)
+            {
+                *static_cast<FString*>(Value) = FString(Converted.Length(), Converted.Get());
+            }
+            else if (Field.Kind == EProtoKind::Name)
+            {
+                *static_cast<FName*>(Value) = FName(Converted.Length(), Converted.Get());
+            }
+            else
+            {
+                *static_cast<FText*>(Value) = FText::FromString(FString(Converted.Length(), Converted.Get()));
+            }
+            return true;
+        }
+
+        case EProtoKind::Bytes:
+        {
+            TArrayView<const uint8> Bytes;
+            if (!Reader.ReadBytes(Bytes))
+            {
+                return false;
+            }
+            FScriptArrayHelper Array(Field.Array, Value);
+            Array.Resize(Bytes.Num());
+            if (Bytes.Num() > 0)
+            {
+                FMemory::Memcpy(Array.GetRawPtr(0), Bytes.GetData(), Bytes.Num());
+            }
+            return true;
+        }
+
+        case EProtoKind::Message:
+        {
+            TArrayView<const uint8> Payload;
+            if (!Reader.ReadBytes(Payload))
+            {
+                return false;
+            }
+            FHttpProtobufReader MessageReader(Payload);
+            return ReadMessage(*GetSchema(Field.MessageType), MessageReader, Value, Depth + 1, OutError);
+        }
+        }
+        return false;
+    }
+
+    static bool ReadMessage(const FSchema& Schema, FHttpProtobufReader& Reader, void* StructData, int32 Depth, FString& OutError)
+    {
+        if (Depth > MaxDepth)
+        {
+            OutError = TEXT("Protobuf messages nested too deeply");
+            return false;
+        }
+
+        uint32 Number = 0;
+        EWireType WireType = EWireType::Varint;
+        while (Reader.NextField(Number, WireType))
+        {
+            const FProtoField* Field = Schema.Find(Number);
+            if (!Field)
+            {
+                if (!Reader.SkipField(WireType))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            void* FieldData = Field->Property->ContainerPtrToValuePtr<void>(StructData);
+            bool bRead = true;
+
+            if (!Field->bRepeated)
+            {
+                bRead = WireType == Field->WireType
+                    ? ReadValue(*Field, Reader, FieldData, Depth, OutError)
+                    : Reader.SkipField(WireType);
+            }
+            else if (WireType == EWireType::LengthDelimited && Field->WireType != EWireType::LengthDelimited)
+            {
+                // Packed run of scalars
+                TArrayView<const uint8> Packed;
+                bRead = Reader.ReadBytes(Packed);
+
+                FScriptArrayHelper Elements(Field->Array, FieldData);
+                FHttpProtobufReader PackedReader(Packed);
+                while (bRead && !PackedReader.AtEnd())
+                {
+                    const int32 Index = Elements.AddValue();
+                    bRead = ReadValue(*Field, PackedReader, Elements.GetRawPtr(Index), Depth, OutError);
+                }
+
+                // The run's own reader holds the error of a truncated or malformed element
+                if (!bRead || PackedReader.HasError())
+                {
+                    bRead = false;
+                    if (OutError.IsEmpty())
+                    {
+                        OutError = FString::Printf(TEXT("Malformed packed repeated field %d"), Field->Number);
+                    }
+                }
+            }
+            else if (WireType == Field->WireType)
+            {
+                FScriptArrayHelper Elements(Field->Array, FieldData);
+                const int32 Index = Elements.AddValue();
+                bRead = ReadValue(*Field, Reader, Elements.GetRawPtr(Index), Depth, OutError);
+            }
+            else
+            {
+                bRead = Reader.SkipField(WireType);
+            }
+
+            if (!bRead)
+            {
+                if (OutError.IsEmpty())
+                {
+                    OutError = FString::Printf(TEXT("Malformed protobuf field %u"), Number);
+                }
+                break;
+            }
+        }
+
+        if (OutError.IsEmpty() && Reader.HasError())
+        {
+            OutError = TEXT("Malformed protobuf message");
+        }
+        return OutError.IsEmpty();
+    }
+}
+
+// =============================================================================
+// PROTOBUF CODEC
+// =============================================================================
+
+bool FHttpProtobufCodec::Encode(const UScriptStruct* StructType, const void* StructData, TArray<uint8>& OutBytes)
+{
+    check(StructType && StructData);
+
+    HttpProtobufCodecDetail::FProtoWriter(OutBytes).WriteMessage(*HttpProtobufCodecDetail::GetSchema(StructType), StructData);
+    return true;
+}
+
+bool FHttpProtobufCodec::Decode(const UScriptStruct* StructType, TArrayView<const uint8> Bytes, void* StructData, FString& OutError)
+{
+    check(StructType && StructData);
+
+    OutError.Reset();
+    FHttpProtobufReader Reader(Bytes);
+    return HttpProtobufCodecDetail::ReadMessage(*HttpProtobufCodecDetail::GetSchema(StructType), Reader, StructData, 0, OutError);
+}
+
+void FHttpProtobufCodec::RegisterFieldNumbers(const UScriptStruct* StructType, const TMap<FName, int32>& FieldNumbers)
+{
+    check(StructType);
+
+    FWriteScopeLock Lock(HttpProtobufCodecDetail::SchemaLock);
+    HttpProtobufCodecDetail::RegisteredNumbers.FindOrAdd(FObjectKey(StructType)).Append(FieldNumbers);
+    HttpProtobufCodecDetail::Schemas.Remove(FObjectKey(StructType));
+}
+
+void FHttpProtobufCodec::ClearSchemaCache()
+{
+    FWriteScopeLock Lock(HttpProtobufCodecDetail::SchemaLock);
+    HttpProtobufCodecDetail::Schemas.Empty();
+}
+
+void FHttpProtobufCodec::Startup()
+{
+    using namespace HttpProtobufCodecDetail;
+
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddStatic(&OnObjectsReplaced);
+    PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&OnPreGarbageCollect);
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&OnPostGarbageCollect);
+}
+
+void FHttpProtobufCodec::Shutdown()
+{
+    using namespace HttpProtobufCodecDetail;
+
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    FWriteScopeLock Lock(SchemaLock);
+    Schemas.Empty();
+    RegisteredNumbers.Empty();
+}
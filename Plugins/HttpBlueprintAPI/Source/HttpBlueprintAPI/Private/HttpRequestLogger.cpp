@@ -0,0 +1,453 @@
+#include "HttpRequestLogger.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpCallSites.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpRequestLoggerCommands
+{
+    static FAutoConsoleCommand StartTraceCommand(
+        TEXT("HttpBlueprint.Log.StartTrace"),
+        TEXT("Start writing binary HTTP trace records. Usage: HttpBlueprint.Log.StartTrace [FilePath]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                FHttpRequestLogger::Get().StartBinaryTrace(Args.Num() > 0 ? Args[0] : FString());
+            }));
+
+    static FAutoConsoleCommand StopTraceCommand(
+        TEXT("HttpBlueprint.Log.StopTrace"),
+        TEXT("Stop writing binary HTTP trace records."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpRequestLogger::Get().StopBinaryTrace();
+            }));
+
+    static FAutoConsoleCommand DecodeTraceCommand(
+        TEXT("HttpBlueprint.Log.DecodeTrace"),
+        TEXT("Decode a binary HTTP trace into text. Usage: HttpBlueprint.Log.DecodeTrace <TraceFile> [OutputFile]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                if (Args.Num() < 1)
+                {
+                    UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Usage: HttpBlueprint.Log.DecodeTrace <TraceFile> [OutputFile]"));
+                    return;
+                }
+
+                TArray<FString> Lines;
+                if (!FHttpRequestLogger::DecodeBinaryTrace(Args[0], Lines))
+                {
+                    UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Could not decode HTTP trace file: %s"), *Args[0]);
+                    return;
+                }
+
+                const FString OutputFile = Args.Num() > 1 ? Args[1] : FPaths::ChangeExtension(Args[0], TEXT("txt"));
+                FFileHelper::SaveStringArrayToFile(Lines, *OutputFile);
+                UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Decoded %d HTTP trace records to %s"), Lines.Num(), *OutputFile);
+            }));
+}
+
+// =============================================================================
+// BINARY TRACE FORMAT
+// =============================================================================
+
+namespace HttpTraceFormat
+{
+    /** "HBTR" */
+    static constexpr uint32 Magic = 0x52544248;
+    static constexpr uint16 Version = 1;
+
+    /** Record tag for a string table entry; event records use the EHttpLogEvent value */
+    static constexpr uint8 StringTag = 0;
+
+    /** String id 0 is reserved for the empty string */
+    static constexpr uint32 EmptyStringId = 0;
+}
+
+// =============================================================================
+// LOGGER
+// =============================================================================
+
+FHttpRequestLogger& FHttpRequestLogger::Get()
+{
+    static FHttpRequestLogger Instance;
+    return Instance;
+}
+
+FHttpRequestLogger::~FHttpRequestLogger()
+{
+    Shutdown();
+}
+
+uint32 FHttpRequestLogger::NextRequestId()
+{
+    static TAtomic<uint32> Counter { 0 };
+    return ++Counter;
+}
+
+bool FHttpRequestLogger::ShouldSample(uint32 RequestId, float SampleRate)
+{
+    if (SampleRate >= 1.0f)
+    {
+        return true;
+    }
+    if (SampleRate <= 0.0f)
+    {
+        return false;
+    }
+
+    // The roll is a hash of the request id, so start and completion agree without carrying state between them.
+    // Ids are sequential; the murmur3 finalizer spreads them evenly, and the seed varies the sample between runs.
+    static const uint32 Seed = FPlatformTime::Cycles();
+    uint32 Roll = RequestId ^ Seed;
+    Roll ^= Roll >> 16;
+    Roll *= 0x85ebca6bu;
+    Roll ^= Roll >> 13;
+    Roll *= 0xc2b2ae35u;
+    Roll ^= Roll >> 16;
+
+    return (Roll & 0x00FFFFFF) < (uint32)(SampleRate * 16777216.0f);
+}
+
+void FHttpRequestLogger::LogRequestStarted(const FHttpBlueprintRuntimeSettings& Settings, uint32 RequestId, const FString& Method, const FString& URL, const FString& Body, uint32 CallSiteId)
+{
+    if (!UE_LOG_ACTIVE(LogHttpBlueprintAPI, Log) && !bTraceActive)
+    {
+        return;
+    }
+
+    if (!ShouldSample(RequestId, Settings.LogSampleRate))
+    {
+        return;
+    }
+
+    FHttpLogRecord Record;
+    Record.Event = EHttpLogEvent::Started;
+    Record.RequestId = RequestId;
+    Record.TimestampCycles = FPlatformTime::Cycles64();
+    Record.Method = Method;
+    Record.URL = URL;
+    Record.BodyBytes = Body.Len();
+    Record.CallSiteId = CallSiteId;
+
+    // Only copy (a bounded prefix of) the body when someone will actually see it
+    if (Settings.LogMaxBodyBytes > 0 && !Body.IsEmpty() && UE_LOG_ACTIVE(LogHttpBlueprintAPI, Verbose))
+    {
+        Record.BodyExcerpt = Body.Left(Settings.LogMaxBodyBytes);
+    }
+
+    Enqueue(MoveTemp(Record));
+}
+
+void FHttpRequestLogger::LogRequestCompleted(
+    const FHttpBlueprintRuntimeSettings& Settings,
+    uint32 RequestId,
+    const FString& URL,
+    const FHttpResponseData& Response,
+    int32 BodyBytes)
+{
+    if (!UE_LOG_ACTIVE(LogHttpBlueprintAPI, Log) && !bTraceActive)
+    {
+        return;
+    }
+
+    // Same roll as the start: sampled requests always log their completion, and failures are also
+    // logged at the failure rate when their start was not sampled
+    if (!ShouldSample(RequestId, Response.bWasSuccessful ? Settings.LogSampleRate : Settings.LogFailureSampleRate))
+    {
+        return;
+    }
+
+    FHttpLogRecord Record;
+    Record.Event = Response.bWasSuccessful ? EHttpLogEvent::Completed : EHttpLogEvent::Failed;
+    Record.RequestId = RequestId;
+    Record.TimestampCycles = FPlatformTime::Cycles64();
+    Record.URL = URL;
+    Record.ResponseCode = Response.ResponseCode;
+    Record.ElapsedSeconds = Response.ResponseTimeSeconds;
+    Record.BodyBytes = BodyBytes;
+    Record.ErrorKind = Response.ErrorKind;
+    Record.ErrorValue = Response.ErrorValue;
+    Record.ErrorLimit = Response.ErrorLimit;
+    Record.ErrorMessage = Response.ErrorMessage;
+
+    Enqueue(MoveTemp(Record));
+}
+
+void FHttpRequestLogger::Enqueue(FHttpLogRecord&& Record)
+{
+    if (bStopping)
+    {
+        return;
+    }
+
+    PendingRecords.Enqueue(MoveTemp(Record));
+
+    if (!Thread.Load())
+    {
+        FScopeLock Lock(&ThreadLock);
+        if (!Thread.Load() && !bStopping)
+        {
+            // WakeEvent is set before the thread is published, so Run always sees it
+            WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+            Thread = FRunnableThread::Create(this, TEXT("HttpBlueprintLogger"), 0, TPri_BelowNormal);
+        }
+    }
+}
+
+uint32 FHttpRequestLogger::Run()
+{
+    // Records are drained in batches; waking on a short timer rather than per record
+    // keeps the producer side to a single lock-free enqueue
+    while (!bStopping)
+    {
+        WakeEvent->Wait(FTimespan::FromMilliseconds(50));
+        DrainQueue();
+    }
+
+    DrainQueue();
+    return 0;
+}
+
+void FHttpRequestLogger::Stop()
+{
+    bStopping = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FHttpRequestLogger::Shutdown()
+{
+    FScopeLock Lock(&ThreadLock);
+
+    if (FRunnableThread* LoggingThread = Thread.Exchange(nullptr))
+    {
+        LoggingThread->Kill(true);
+        delete LoggingThread;
+    }
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+
+    StopBinaryTrace();
+}
+
+void FHttpRequestLogger::DrainQueue()
+{
+    FScopeLock Lock(&TraceLock);
+
+    FHttpLogRecord Record;
+    while (PendingRecords.Dequeue(Record))
+    {
+        FormatRecord(Record);
+
+        if (TraceWriter.IsValid())
+        {
+            WriteTraceRecord(Record);
+        }
+    }
+}
+
+void FHttpRequestLogger::FormatRecord(const FHttpLogRecord& Record) const
+{
+    switch (Record.Event)
+    {
+    case EHttpLogEvent::Started:
+        UE_LOG(LogHttpBlueprintAPI, Log, TEXT("[%u] Starting HTTP %s request to: %s (from %s)"),
+            Record.RequestId, *Record.Method, *Record.URL, *FHttpCallSites::GetName(Record.CallSiteId));
+        if (!Record.BodyExcerpt.IsEmpty())
+        {
+            UE_LOG(LogHttpBlueprintAPI, Verbose, TEXT("[%u] Request body (%d chars): %s%s"),
+                Record.RequestId, Record.BodyBytes, *Record.BodyExcerpt,
+                Record.BodyExcerpt.Len() < Record.BodyBytes ? TEXT("...") : TEXT(""));
+        }
+        break;
+
+    case EHttpLogEvent::Completed:
+        UE_LOG(LogHttpBlueprintAPI, Log, TEXT("[%u] HTTP request completed. Code: %d, Bytes: %d, Time: %.3fs"),
+            Record.RequestId, Record.ResponseCode, Record.BodyBytes, Record.ElapsedSeconds);
+        break;
+
+    case EHttpLogEvent::Failed:
+        // Most failures carry no message; describe them here rather than on the request path
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("[%u] HTTP request failed: %s (Code: %d, Time: %.3fs)"),
+            Record.RequestId,
+            Record.ErrorMessage.IsEmpty()
+                ? *FHttpResponseData::FormatErrorMessage(Record.ErrorKind, Record.ResponseCode, Record.ErrorValue, Record.ErrorLimit)
+                : *Record.ErrorMessage,
+            Record.ResponseCode, Record.ElapsedSeconds);
+        break;
+    }
+}
+
+bool FHttpRequestLogger::StartBinaryTrace(const FString& FilePath)
+{
+    FScopeLock Lock(&TraceLock);
+
+    if (TraceWriter.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HTTP binary trace is already running"));
+        return false;
+    }
+
+    const FString TracePath = FilePath.IsEmpty()
+        ? FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("HttpTrace_%s.hbtr"), *FDateTime::Now().ToString()))
+        : FilePath;
+
+    TraceWriter.Reset(IFileManager::Get().CreateFileWriter(*TracePath));
+    if (!TraceWriter.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not open HTTP trace file: %s"), *TracePath);
+        return false;
+    }
+
+    TraceStringIds.Reset();
+    TraceStartCycles = FPlatformTime::Cycles64();
+
+    uint32 Magic = HttpTraceFormat::Magic;
+    uint16 Version = HttpTraceFormat::Version;
+    int64 StartTicks = FDateTime::UtcNow().GetTicks();
+    *TraceWriter << Magic << Version << StartTicks;
+    bTraceActive = true;
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HTTP binary trace started: %s"), *TracePath);
+    return true;
+}
+
+void FHttpRequestLogger::StopBinaryTrace()
+{
+    FScopeLock Lock(&TraceLock);
+
+    bTraceActive = false;
+    if (TraceWriter.IsValid())
+    {
+        TraceWriter->Close();
+        TraceWriter.Reset();
+        TraceStringIds.Reset();
+        UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HTTP binary trace stopped"));
+    }
+}
+
+uint32 FHttpRequestLogger::GetTraceStringId(const FString& Value)
+{
+    if (Value.IsEmpty())
+    {
+        return HttpTraceFormat::EmptyStringId;
+    }
+
+    if (const uint32* ExistingId = TraceStringIds.Find(Value))
+    {
+        return *ExistingId;
+    }
+
+    // First use of this string: emit a string table record before the event that references it
+    uint32 NewId = TraceStringIds.Num() + 1;
+    TraceStringIds.Add(Value, NewId);
+
+    FTCHARToUTF8 Utf8(*Value);
+    uint8 Tag = HttpTraceFormat::StringTag;
+    uint16 Length = (uint16)FMath::Min(Utf8.Length(), (int32)MAX_uint16);
+    *TraceWriter << Tag << NewId << Length;
+    TraceWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Length);
+
+    return NewId;
+}
+
+void FHttpRequestLogger::WriteTraceRecord(const FHttpLogRecord& Record)
+{
+    uint32 MethodId = GetTraceStringId(Record.Method);
+    uint32 UrlId = GetTraceStringId(Record.URL);
+
+    uint8 Tag = (uint8)Record.Event;
+    uint32 RequestId = Record.RequestId;
+    uint64 TimestampMicros = (uint64)(FPlatformTime::ToMilliseconds64(Record.TimestampCycles - TraceStartCycles) * 1000.0);
+    int16 ResponseCode = (int16)Record.ResponseCode;
+    uint32 ElapsedMicros = (uint32)(Record.ElapsedSeconds * 1000000.0f);
+    uint32 BodyBytes = (uint32)Record.BodyBytes;
+
+    *TraceWriter << Tag << RequestId << TimestampMicros << MethodId << UrlId << ResponseCode << ElapsedMicros << BodyBytes;
+}
+
+bool FHttpRequestLogger::DecodeBinaryTrace(const FString& FilePath, TArray<FString>& OutLines)
+{
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(FileData);
+
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    int64 StartTicks = 0;
+    Reader << Magic << Version << StartTicks;
+    if (Reader.IsError() || Magic != HttpTraceFormat::Magic || Version != HttpTraceFormat::Version)
+    {
+        return false;
+    }
+
+    OutLines.Add(FString::Printf(TEXT("# HTTP trace started %s UTC"), *FDateTime(StartTicks).ToString()));
+
+    TMap<uint32, FString> Strings;
+    Strings.Add(HttpTraceFormat::EmptyStringId, FString());
+
+    while (!Reader.AtEnd() && !Reader.IsError())
+    {
+        uint8 Tag = 0;
+        Reader << Tag;
+
+        if (Tag == HttpTraceFormat::StringTag)
+        {
+            uint32 Id = 0;
+            uint16 Length = 0;
+            Reader << Id << Length;
+
+            TArray<ANSICHAR> Utf8;
+            Utf8.SetNumZeroed(Length + 1);
+            Reader.Serialize(Utf8.GetData(), Length);
+            Strings.Add(Id, FString(UTF8_TO_TCHAR(Utf8.GetData())));
+            continue;
+        }
+
+        uint32 RequestId = 0;
+        uint64 TimestampMicros = 0;
+        uint32 MethodId = 0;
+        uint32 UrlId = 0;
+        int16 ResponseCode = 0;
+        uint32 ElapsedMicros = 0;
+        uint32 BodyBytes = 0;
+        Reader << RequestId << TimestampMicros << MethodId << UrlId << ResponseCode << ElapsedMicros << BodyBytes;
+
+        const TCHAR* EventName =
+            Tag == (uint8)EHttpLogEvent::Started ? TEXT("START") :
+            Tag == (uint8)EHttpLogEvent::Completed ? TEXT("DONE") :
+            Tag == (uint8)EHttpLogEvent::Failed ? TEXT("FAIL") : TEXT("UNKNOWN");
+
+        OutLines.Add(FString::Printf(TEXT("%12.6f %-5s id=%u %s %s code=%d bytes=%u elapsed=%.3fms"),
+            TimestampMicros / 1000000.0,
+            EventName,
+            RequestId,
+            *Strings.FindRef(MethodId),
+            *Strings.FindRef(UrlId),
+            ResponseCode,
+            BodyBytes,
+            ElapsedMicros / 1000.0));
+    }
+
+    return !Reader.IsError();
+}
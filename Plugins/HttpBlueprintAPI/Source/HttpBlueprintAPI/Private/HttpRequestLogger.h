@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+class FRunnableThread;
+class FArchive;
+
+/**
+ * Kind of event captured by the request logger
+ * The numeric values are part of the binary trace format and must not change
+ */
+enum class EHttpLogEvent : uint8
+{
+    Started = 1,
+    Completed = 2,
+    Failed = 3
+};
+
+/**
+ * A single request log entry
+ * Captured cheaply on the calling thread; all string formatting happens on the logging thread
+ */
+struct FHttpLogRecord
+{
+    EHttpLogEvent Event = EHttpLogEvent::Started;
+    uint32 RequestId = 0;
+    uint64 TimestampCycles = 0;
+    FString Method;
+    FString URL;
+    int32 ResponseCode = 0;
+    float ElapsedSeconds = 0.0f;
+    int32 BodyBytes = 0;
+
+    /** FHttpCallSites id of the caller; its name is looked up on the logging thread */
+    uint32 CallSiteId = 0;
+
+    /** Truncated copy of the body, only captured when Verbose logging is enabled */
+    FString BodyExcerpt;
+
+    /** Failure details; the message is built from them on the logging thread */
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+    int64 ErrorValue = 0;
+    int64 ErrorLimit = 0;
+    FString ErrorMessage;
+};
+
+/**
+ * Structured, sampled request logger
+ *
+ * Requests are sampled (HttpBlueprint.Log.SampleRate and HttpBlueprint.Log.FailureSampleRate) with
+ * one roll per request id, so a sampled start is always followed by its completion record, and
+ * failures are logged at the (higher) failure rate. Bodies are truncated to HttpBlueprint.Log.MaxBodyBytes,
+ * and the surviving records are handed to a dedicated logging thread that formats them
+ * and optionally appends compact binary trace records (HttpBlueprint.Log.StartTrace).
+ */
+class FHttpRequestLogger : public FRunnable
+{
+public:
+
+    static FHttpRequestLogger& Get();
+
+    /** Allocate a process-unique id used to correlate start and completion records */
+    static uint32 NextRequestId();
+
+    /** Record that a request is being sent. Cheap when the event is not sampled */
+    void LogRequestStarted(const FHttpBlueprintRuntimeSettings& Settings, uint32 RequestId, const FString& Method, const FString& URL, const FString& Body, uint32 CallSiteId);
+
+    /** Record that a request finished, successfully or not */
+    void LogRequestCompleted(
+        const FHttpBlueprintRuntimeSettings& Settings,
+        uint32 RequestId,
+        const FString& URL,
+        const FHttpResponseData& Response,
+        int32 BodyBytes
+    );
+
+    /** Start appending binary trace records to a file (empty path picks one in the log dir) */
+    bool StartBinaryTrace(const FString& FilePath);
+
+    /** Stop binary tracing and close the trace file */
+    void StopBinaryTrace();
+
+    /**
+     * Decode a binary trace file into human-readable lines
+     *
+     * @param FilePath - Trace file written by StartBinaryTrace
+     * @param OutLines - One line per decoded event
+     * @return False if the file could not be read or is not a trace file
+     */
+    static bool DecodeBinaryTrace(const FString& FilePath, TArray<FString>& OutLines);
+
+    /** Flush pending records and stop the logging thread */
+    void Shutdown();
+
+    //~ Begin FRunnable Interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+    //~ End FRunnable Interface
+
+private:
+
+    FHttpRequestLogger() = default;
+    virtual ~FHttpRequestLogger() override;
+
+    /** Whether a request is sampled at a rate; the same request id always draws the same roll */
+    static bool ShouldSample(uint32 RequestId, float SampleRate);
+
+    /** Queue a record and lazily start the logging thread */
+    void Enqueue(FHttpLogRecord&& Record);
+
+    /** Format and write everything currently queued (logging thread only) */
+    void DrainQueue();
+
+    void FormatRecord(const FHttpLogRecord& Record) const;
+    void WriteTraceRecord(const FHttpLogRecord& Record);
+    uint32 GetTraceStringId(const FString& Value);
+
+    TQueue<FHttpLogRecord, EQueueMode::Mpsc> PendingRecords;
+
+    /** Created on first use; read without ThreadLock on the enqueue path */
+    TAtomic<FRunnableThread*> Thread { nullptr };
+    FEvent* WakeEvent = nullptr;
+    FCriticalSection ThreadLock;
+    TAtomic<bool> bStopping { false };
+
+    /** Binary trace state. Only touched by the logging thread once tracing is running */
+    TAtomic<bool> bTraceActive { false };
+    FCriticalSection TraceLock;
+    TUniquePtr<FArchive> TraceWriter;
+    TMap<FString, uint32> TraceStringIds;
+    uint64 TraceStartCycles = 0;
+};
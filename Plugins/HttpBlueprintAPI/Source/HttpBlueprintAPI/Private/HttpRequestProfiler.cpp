@@ -0,0 +1,463 @@
+#include "HttpRequestProfiler.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintStats.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpFixtureStore.h"
+#include "HttpPayloadCodec.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_STAT(STAT_HttpStartRequest);
+DEFINE_STAT(STAT_HttpCompleteRequest);
+DEFINE_STAT(STAT_HttpDeliverResponse);
+
+// =============================================================================
+// PHASE TOTALS
+// =============================================================================
+
+namespace HttpRequestProfilerDetail
+{
+    struct FPhaseCounters
+    {
+        TAtomic<uint64> Count { 0 };
+        TAtomic<uint64> TotalCycles { 0 };
+        TAtomic<uint64> MaxCycles { 0 };
+    };
+
+    static FPhaseCounters Phases[(int32)EHttpOverheadPhase::Num];
+}
+
+// =============================================================================
+// ALLOCATION COUNTER
+// =============================================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace HttpRequestProfilerDetail
+{
+    /** Forwards everything to the allocator it was installed over, counting calls from one thread */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+
+        FMalloc* Inner = nullptr;
+        TAtomic<uint32> CountingThreadId { 0 };
+        TAtomic<uint64> Count { 0 };
+
+        virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+        {
+            CountCall();
+            return Inner->Malloc(Size, Alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+        {
+            CountCall();
+            return Inner->TryMalloc(Size, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+        {
+            if (Size > 0)
+            {
+                CountCall();
+            }
+            return Inner->Realloc(Original, Size, Alignment);
+        }
+
+        virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+        {
+            if (Size > 0)
+            {
+                CountCall();
+            }
+            return Inner->TryRealloc(Original, Size, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return Inner->QuantizeSize(Size, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void MarkTLSCachesAsUsedOnCurrentThread() override { Inner->MarkTLSCachesAsUsedOnCurrentThread(); }
+        virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { Inner->MarkTLSCachesAsUnusedOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual void UpdateStats() override { Inner->UpdateStats(); }
+        virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+        virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+    private:
+
+        void CountCall()
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == CountingThreadId.Load(EMemoryOrder::Relaxed))
+            {
+                Count.IncrementExchange();
+            }
+        }
+    };
+
+    /**
+     * Static storage that is never destructed: once installed the wrapper is GMalloc for the rest of
+     * the process, including static destruction, so it cannot be freed or torn down
+     */
+    static TTypeCompatibleBytes<FCountingMalloc> CountingMallocStorage;
+    static FCountingMalloc* CountingMalloc = nullptr;
+}
+
+FHttpAllocationCounter::FHttpAllocationCounter()
+{
+    if (HttpRequestProfilerDetail::FCountingMalloc* CountingMalloc = HttpRequestProfilerDetail::CountingMalloc)
+    {
+        check(CountingMalloc->CountingThreadId.Load() == 0);
+        CountingMalloc->Count = 0;
+        CountingMalloc->CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+    }
+}
+
+FHttpAllocationCounter::~FHttpAllocationCounter()
+{
+    if (HttpRequestProfilerDetail::FCountingMalloc* CountingMalloc = HttpRequestProfilerDetail::CountingMalloc)
+    {
+        CountingMalloc->CountingThreadId = 0;
+    }
+}
+
+uint64 FHttpAllocationCounter::GetCount() const
+{
+    const HttpRequestProfilerDetail::FCountingMalloc* CountingMalloc = HttpRequestProfilerDetail::CountingMalloc;
+    return CountingMalloc ? CountingMalloc->Count.Load(EMemoryOrder::Relaxed) : 0;
+}
+
+void FHttpAllocationCounter::Startup()
+{
+    check(IsInGameThread());
+    if (HttpRequestProfilerDetail::CountingMalloc || !FParse::Param(FCommandLine::Get(), TEXT("HttpBlueprintCountAllocs")))
+    {
+        return;
+    }
+
+    // Other threads may be allocating: Inner must be visible before they can reach the wrapper through GMalloc.
+    // A thread that read the old GMalloc just before the swap still uses the real allocator, which stays valid.
+    HttpRequestProfilerDetail::FCountingMalloc* CountingMalloc = new (&HttpRequestProfilerDetail::CountingMallocStorage) HttpRequestProfilerDetail::FCountingMalloc();
+    CountingMalloc->Inner = GMalloc;
+    FPlatformMisc::MemoryBarrier();
+    GMalloc = CountingMalloc;
+    HttpRequestProfilerDetail::CountingMalloc = CountingMalloc;
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("Counting heap allocations through %s for the HTTP benchmarks"), CountingMalloc->Inner->GetDescriptiveName());
+}
+
+bool FHttpAllocationCounter::IsAvailable()
+{
+    return HttpRequestProfilerDetail::CountingMalloc != nullptr;
+}
+
+#endif // !UE_BUILD_SHIPPING
+
+// =============================================================================
+// UTILITY BENCHMARK
+// =============================================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace HttpRequestProfilerDetail
+{
+    /** Timed runs per function; the reported figures are their minimum and median */
+    constexpr int32 BenchRuns = 5;
+
+    struct FBenchResult
+    {
+        const TCHAR* Name = nullptr;
+        double MinNsPerOp = 0.0;
+        double MedianNsPerOp = 0.0;
+        double AllocsPerOp = 0.0;
+    };
+
+    /**
+     * Time Function(Index) over Iterations calls, after an untimed warm-up run
+     * Function returns a value that is folded into a sink so the calls cannot be optimized away.
+     * Allocations are counted in a separate untimed run; with -HttpBlueprintCountAllocs every allocation
+     * also passes through the counting allocator, so compare timings from runs with the same switches.
+     */
+    template<typename FunctionType>
+    static FBenchResult Bench(const TCHAR* Name, int32 Iterations, FunctionType&& Function)
+    {
+        volatile int64 Sink = 0;
+        TArray<double, TInlineAllocator<BenchRuns>> NsPerOp;
+
+        for (int32 Run = -1; Run < BenchRuns; ++Run)
+        {
+            int64 Folded = 0;
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 Index = 0; Index < Iterations; ++Index)
+            {
+                Folded += (int64)Function(Index);
+            }
+            const double ElapsedNs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0;
+            Sink = Sink + Folded;
+
+            if (Run >= 0)
+            {
+                NsPerOp.Add(ElapsedNs / Iterations);
+            }
+        }
+
+        uint64 Allocations = 0;
+        {
+            FHttpAllocationCounter Counter;
+            int64 Folded = 0;
+            for (int32 Index = 0; Index < Iterations; ++Index)
+            {
+                Folded += (int64)Function(Index);
+            }
+            Allocations = Counter.GetCount();
+            Sink = Sink + Folded;
+        }
+
+        NsPerOp.Sort();
+        return FBenchResult{ Name, NsPerOp[0], NsPerOp[BenchRuns / 2], (double)Allocations / Iterations };
+    }
+
+    /** Fixed inputs, so results are comparable between runs and machines */
+    static const TCHAR* BenchURLs[] =
+    {
+        TEXT("https://api.example.com/v1/players/12345/inventory?include=items&sort=asc"),
+        TEXT("http://localhost:8080/health"),
+        TEXT("https://cdn.example.com/assets/textures/atlas_0001.png"),
+        TEXT("https://API.Example.com/search?q=sword&page=2&limit=50#results"),
+        TEXT("ftp://not-http.example.com/file"),
+        TEXT("https://bad host.example.com/<script>"),
+    };
+
+    static const int32 BenchCodes[] = { 200, 201, 204, 304, 400, 401, 404, 429, 500, 503, 299, 599 };
+
+    static const TCHAR* BenchContentTypes[] =
+    {
+        TEXT("application/json; charset=utf-8"),
+        TEXT("application/msgpack"),
+        TEXT("application/cbor"),
+        TEXT("application/x-protobuf"),
+        TEXT("text/html"),
+    };
+
+    static TArray<FBenchResult> BenchUtilities(int32 Iterations)
+    {
+        TArray<FString> URLs;
+        for (const TCHAR* URL : BenchURLs)
+        {
+            URLs.Add(URL);
+        }
+        TArray<FString> ContentTypes;
+        for (const TCHAR* ContentType : BenchContentTypes)
+        {
+            ContentTypes.Add(ContentType);
+        }
+        const FString Method = TEXT("GET");
+        const FString EmptyBody;
+
+        TArray<FBenchResult> Results;
+        Results.Add(Bench(TEXT("IsValidURL"), Iterations, [&URLs](int32 Index)
+            {
+                return UHttpBlueprintFunctionLibrary::IsValidURL(URLs[Index % URLs.Num()]);
+            }));
+        Results.Add(Bench(TEXT("GetDomainFromURL"), Iterations, [&URLs](int32 Index)
+            {
+                return UHttpBlueprintFunctionLibrary::GetDomainFromURL(URLs[Index % URLs.Num()]).Len();
+            }));
+        Results.Add(Bench(TEXT("GetHttpResponseCodeDescription"), Iterations, [](int32 Index)
+            {
+                return UHttpBlueprintFunctionLibrary::GetHttpResponseCodeDescription(BenchCodes[Index % UE_ARRAY_COUNT(BenchCodes)]).Len();
+            }));
+        Results.Add(Bench(TEXT("IsHttpResponseSuccessful"), Iterations, [](int32 Index)
+            {
+                return UHttpBlueprintFunctionLibrary::IsHttpResponseSuccessful(BenchCodes[Index % UE_ARRAY_COUNT(BenchCodes)]);
+            }));
+        Results.Add(Bench(TEXT("FormatFromContentType"), Iterations, [&ContentTypes](int32 Index)
+            {
+                return (int32)FHttpPayloadCodec::FormatFromContentType(ContentTypes[Index % ContentTypes.Num()]);
+            }));
+        Results.Add(Bench(TEXT("MakeFixtureKey (URL normalization)"), FMath::Max(1, Iterations / 10), [&URLs, &Method, &EmptyBody](int32 Index)
+            {
+                return FHttpFixtureStore::MakeFixtureKey(Method, URLs[Index % URLs.Num()], EmptyBody).Len();
+            }));
+        return Results;
+    }
+}
+
+#endif // !UE_BUILD_SHIPPING
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpRequestProfilerCommands
+{
+    static void Report(const TArray<FString>& Args, FOutputDevice& Ar)
+    {
+        Ar.Logf(TEXT("HTTP Blueprint API overhead per request:"));
+        for (int32 Index = 0; Index < (int32)EHttpOverheadPhase::Num; ++Index)
+        {
+            const EHttpOverheadPhase Phase = (EHttpOverheadPhase)Index;
+            const FHttpRequestProfiler::FPhaseStats Stats = FHttpRequestProfiler::GetStats(Phase);
+            Ar.Logf(TEXT("  %-12s %10llu calls  avg %9.2f us  max %9.2f us"),
+                FHttpRequestProfiler::GetPhaseName(Phase), Stats.Count, Stats.GetAverageMicroseconds(), Stats.MaxMicroseconds);
+        }
+    }
+
+    /** Budgets are average microseconds per request, in phase order; 0 or missing skips a phase */
+    static void CheckBudget(const TArray<FString>& Args, FOutputDevice& Ar)
+    {
+        if (Args.Num() < 1)
+        {
+            Ar.Logf(ELogVerbosity::Warning, TEXT("Usage: HttpBlueprint.Perf.CheckBudget <StartUs> [CompletionUs] [DeliveryUs]"));
+            return;
+        }
+
+        TArray<double> BudgetMicroseconds;
+        for (const FString& Arg : Args)
+        {
+            BudgetMicroseconds.Add(FCString::Atod(*Arg));
+        }
+
+        TArray<FString> Failures;
+        if (FHttpRequestProfiler::CheckBudget(BudgetMicroseconds, Failures))
+        {
+            Ar.Logf(TEXT("HTTP request overhead is within budget"));
+        }
+        for (const FString& Failure : Failures)
+        {
+            Ar.Logf(ELogVerbosity::Error, TEXT("%s"), *Failure);
+        }
+    }
+
+#if !UE_BUILD_SHIPPING
+    static void BenchUtilities(const TArray<FString>& Args, FOutputDevice& Ar)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+        const TArray<HttpRequestProfilerDetail::FBenchResult> Results = HttpRequestProfilerDetail::BenchUtilities(Iterations);
+
+        FString Csv = TEXT("Function,MinNsPerOp,MedianNsPerOp,AllocsPerOp\n");
+        Ar.Logf(TEXT("HTTP utility benchmark (%d iterations, %d runs):"), Iterations, HttpRequestProfilerDetail::BenchRuns);
+        if (!FHttpAllocationCounter::IsAvailable())
+        {
+            Ar.Logf(TEXT("  (allocations are not counted; run with -HttpBlueprintCountAllocs to count them)"));
+        }
+        for (const HttpRequestProfilerDetail::FBenchResult& Result : Results)
+        {
+            Ar.Logf(TEXT("  %-36s min %9.1f ns/op  median %9.1f ns/op  %6.2f allocs/op"), Result.Name, Result.MinNsPerOp, Result.MedianNsPerOp, Result.AllocsPerOp);
+            Csv += FString::Printf(TEXT("%s,%.1f,%.1f,%.2f\n"), Result.Name, Result.MinNsPerOp, Result.MedianNsPerOp, Result.AllocsPerOp);
+        }
+
+        // Keep a baseline to compare optimization work against
+        if (Args.Num() > 1)
+        {
+            if (FFileHelper::SaveStringToFile(Csv, *Args[1]))
+            {
+                Ar.Logf(TEXT("Results written to %s"), *Args[1]);
+            }
+            else
+            {
+                Ar.Logf(ELogVerbosity::Warning, TEXT("Could not write '%s'"), *Args[1]);
+            }
+        }
+    }
+
+    static FAutoConsoleCommand BenchUtilitiesCommand(
+        TEXT("HttpBlueprint.Perf.BenchUtilities"),
+        TEXT("Time the URL, status code and header utility functions in ns/op and count their allocs/op. Usage: HttpBlueprint.Perf.BenchUtilities [Iterations] [CsvFile]"),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchUtilities));
+#endif // !UE_BUILD_SHIPPING
+
+    static FAutoConsoleCommand ReportCommand(
+        TEXT("HttpBlueprint.Perf.Report"),
+        TEXT("Print the average and maximum time the plugin adds per request when starting, completing and delivering it."),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&Report));
+
+    static FAutoConsoleCommand CheckBudgetCommand(
+        TEXT("HttpBlueprint.Perf.CheckBudget"),
+        TEXT("Print an error for each phase whose average overhead is over budget. Usage: HttpBlueprint.Perf.CheckBudget <StartUs> [CompletionUs] [DeliveryUs]"),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&CheckBudget));
+
+    static FAutoConsoleCommand ResetCommand(
+        TEXT("HttpBlueprint.Perf.Reset"),
+        TEXT("Clear the per-request overhead totals."),
+        FConsoleCommandDelegate::CreateStatic(&FHttpRequestProfiler::Reset));
+}
+
+// =============================================================================
+// REQUEST PROFILER
+// =============================================================================
+
+void FHttpRequestProfiler::Record(EHttpOverheadPhase Phase, uint64 Cycles)
+{
+    HttpRequestProfilerDetail::FPhaseCounters& Counters = HttpRequestProfilerDetail::Phases[(int32)Phase];
+    Counters.Count.IncrementExchange();
+    Counters.TotalCycles.AddExchange(Cycles);
+
+    uint64 MaxCycles = Counters.MaxCycles.Load(EMemoryOrder::Relaxed);
+    while (Cycles > MaxCycles && !Counters.MaxCycles.CompareExchange(MaxCycles, Cycles))
+    {
+    }
+}
+
+FHttpRequestProfiler::FPhaseStats FHttpRequestProfiler::GetStats(EHttpOverheadPhase Phase)
+{
+    const HttpRequestProfilerDetail::FPhaseCounters& Counters = HttpRequestProfilerDetail::Phases[(int32)Phase];
+
+    FPhaseStats Stats;
+    Stats.Count = Counters.Count.Load(EMemoryOrder::Relaxed);
+    Stats.TotalMicroseconds = FPlatformTime::ToMilliseconds64(Counters.TotalCycles.Load(EMemoryOrder::Relaxed)) * 1000.0;
+    Stats.MaxMicroseconds = FPlatformTime::ToMilliseconds64(Counters.MaxCycles.Load(EMemoryOrder::Relaxed)) * 1000.0;
+    return Stats;
+}
+
+void FHttpRequestProfiler::Reset()
+{
+    for (HttpRequestProfilerDetail::FPhaseCounters& Counters : HttpRequestProfilerDetail::Phases)
+    {
+        Counters.Count.Store(0);
+        Counters.TotalCycles.Store(0);
+        Counters.MaxCycles.Store(0);
+    }
+}
+
+bool FHttpRequestProfiler::CheckBudget(TConstArrayView<double> BudgetMicroseconds, TArray<FString>& OutFailures)
+{
+    bool bWithinBudget = true;
+    for (int32 Index = 0; Index < (int32)EHttpOverheadPhase::Num && Index < BudgetMicroseconds.Num(); ++Index)
+    {
+        const EHttpOverheadPhase Phase = (EHttpOverheadPhase)Index;
+        const FPhaseStats Stats = GetStats(Phase);
+        if (BudgetMicroseconds[Index] <= 0.0 || Stats.Count == 0)
+        {
+            continue;
+        }
+
+        if (Stats.GetAverageMicroseconds() > BudgetMicroseconds[Index])
+        {
+            OutFailures.Add(FString::Printf(TEXT("HTTP %s overhead %.2f us per request is over the %.2f us budget (%llu requests)"),
+                GetPhaseName(Phase), Stats.GetAverageMicroseconds(), BudgetMicroseconds[Index], Stats.Count));
+            bWithinBudget = false;
+        }
+    }
+    return bWithinBudget;
+}
+
+const TCHAR* FHttpRequestProfiler::GetPhaseName(EHttpOverheadPhase Phase)
+{
+    switch (Phase)
+    {
+    case EHttpOverheadPhase::Start:      return TEXT("Start");
+    case EHttpOverheadPhase::Completion: return TEXT("Completion");
+    case EHttpOverheadPhase::Delivery:   return TEXT("Delivery");
+    default:                             return TEXT("Unknown");
+    }
+}
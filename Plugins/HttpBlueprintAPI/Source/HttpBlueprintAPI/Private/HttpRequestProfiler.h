@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Plugin code on the request path whose cost is measured per request
+ * (time spent in the HTTP module's own threads and in user callbacks is excluded)
+ */
+enum class EHttpOverheadPhase : uint8
+{
+    /** StartHttpRequest: validation, request creation and ProcessRequest */
+    Start,
+
+    /** OnHttpRequestComplete: response processing up to hand-off (includes Delivery when it is synchronous) */
+    Completion,
+
+    /** DeliverResponse: copying the response into the callback and queueing it */
+    Delivery,
+
+    Num
+};
+
+/**
+ * Per-request overhead of the plugin's dispatch and completion paths
+ *
+ * Every request adds its time in each phase to lock-free totals. HttpBlueprint.Perf.Report
+ * prints averages and maxima, and CheckBudget compares the averages with per-phase budgets
+ * (the HttpBlueprint.Perf automation tests fail on regressions through it).
+ */
+class FHttpRequestProfiler
+{
+public:
+
+    struct FPhaseStats
+    {
+        uint64 Count = 0;
+        double TotalMicroseconds = 0.0;
+        double MaxMicroseconds = 0.0;
+
+        double GetAverageMicroseconds() const { return Count > 0 ? TotalMicroseconds / Count : 0.0; }
+    };
+
+    static void Record(EHttpOverheadPhase Phase, uint64 Cycles);
+
+    static FPhaseStats GetStats(EHttpOverheadPhase Phase);
+
+    static void Reset();
+
+    /**
+     * Compare the average overhead of each phase with a budget
+     *
+     * @param BudgetMicroseconds - Average microseconds per request, in phase order (0 or missing skips a phase)
+     * @param OutFailures - One message per phase over budget
+     * @return True if every phase with requests is within its budget
+     */
+    static bool CheckBudget(TConstArrayView<double> BudgetMicroseconds, TArray<FString>& OutFailures);
+
+    static const TCHAR* GetPhaseName(EHttpOverheadPhase Phase);
+};
+
+/** Adds the time until the end of the scope to a phase */
+class FHttpOverheadScope
+{
+public:
+
+    explicit FHttpOverheadScope(EHttpOverheadPhase InPhase)
+        : Phase(InPhase)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FHttpOverheadScope()
+    {
+        FHttpRequestProfiler::Record(Phase, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+
+    EHttpOverheadPhase Phase;
+    uint64 StartCycles;
+};
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Counts the heap allocations made by the constructing thread while it is alive
+ *
+ * Counting needs a forwarding FMalloc over GMalloc, which Startup installs once when the process runs
+ * with -HttpBlueprintCountAllocs and never removes, so no thread can be inside it while it goes away.
+ * Without the switch every count is 0 (check IsAvailable). Allocations by other threads pass through
+ * uncounted and reallocations count as allocations. One counter at a time, for benchmarks and tests
+ * only. Platforms that call their allocator inline instead of through GMalloc count nothing.
+ */
+class FHttpAllocationCounter
+{
+public:
+
+    FHttpAllocationCounter();
+    ~FHttpAllocationCounter();
+
+    uint64 GetCount() const;
+
+    /** Install the counting allocator if the command line asks for it; call once, from module startup */
+    static void Startup();
+
+    static bool IsAvailable();
+
+private:
+
+    FHttpAllocationCounter(const FHttpAllocationCounter&) = delete;
+    FHttpAllocationCounter& operator=(const FHttpAllocationCounter&) = delete;
+};
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,679 @@
+#include "HttpRequestSigning.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+
+// =============================================================================
+// SHA-256
+// =============================================================================
+
+namespace HttpSha256Detail
+{
+    static const uint32 RoundConstants[64] =
+    {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    FORCEINLINE uint32 RotateRight(uint32 Value, uint32 Bits)
+    {
+        return (Value >> Bits) | (Value << (32 - Bits));
+    }
+}
+
+FHttpSha256::FHttpSha256()
+{
+    Reset();
+}
+
+void FHttpSha256::Reset()
+{
+    State[0] = 0x6a09e667;
+    State[1] = 0xbb67ae85;
+    State[2] = 0x3c6ef372;
+    State[3] = 0xa54ff53a;
+    State[4] = 0x510e527f;
+    State[5] = 0x9b05688c;
+    State[6] = 0x1f83d9ab;
+    State[7] = 0x5be0cd19;
+    TotalLength = 0;
+    BufferLength = 0;
+}
+
+void FHttpSha256::Update(const uint8* Data, int64 Length)
+{
+    TotalLength += Length;
+
+    // Top up a partially filled block first
+    if (BufferLength > 0)
+    {
+        const int32 ToCopy = (int32)FMath::Min<int64>(BlockSize - BufferLength, Length);
+        FMemory::Memcpy(Buffer + BufferLength, Data, ToCopy);
+        BufferLength += ToCopy;
+        Data += ToCopy;
+        Length -= ToCopy;
+
+        if (BufferLength < BlockSize)
+        {
+            return;
+        }
+
+        ProcessBlock(Buffer);
+        BufferLength = 0;
+    }
+
+    // Hash whole blocks straight from the caller's memory
+    while (Length >= BlockSize)
+    {
+        ProcessBlock(Data);
+        Data += BlockSize;
+        Length -= BlockSize;
+    }
+
+    if (Length > 0)
+    {
+        FMemory::Memcpy(Buffer, Data, Length);
+        BufferLength = (int32)Length;
+    }
+}
+
+void FHttpSha256::UpdateString(const FString& Value)
+{
+    FTCHARToUTF8 Utf8(*Value);
+    Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+void FHttpSha256::Final(uint8 OutDigest[DigestSize])
+{
+    const uint64 BitLength = TotalLength * 8;
+
+    // Append the 0x80 terminator, pad with zeros and finish with the big-endian bit length
+    Buffer[BufferLength++] = 0x80;
+    if (BufferLength > BlockSize - 8)
+    {
+        FMemory::Memzero(Buffer + BufferLength, BlockSize - BufferLength);
+        ProcessBlock(Buffer);
+        BufferLength = 0;
+    }
+
+    FMemory::Memzero(Buffer + BufferLength, BlockSize - 8 - BufferLength);
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        Buffer[BlockSize - 1 - Index] = (uint8)(BitLength >> (Index * 8));
+    }
+    ProcessBlock(Buffer);
+
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        OutDigest[Index * 4 + 0] = (uint8)(State[Index] >> 24);
+        OutDigest[Index * 4 + 1] = (uint8)(State[Index] >> 16);
+        OutDigest[Index * 4 + 2] = (uint8)(State[Index] >> 8);
+        OutDigest[Index * 4 + 3] = (uint8)(State[Index]);
+    }
+}
+
+void FHttpSha256::ProcessBlock(const uint8* Block)
+{
+    using namespace HttpSha256Detail;
+
+    uint32 W[64];
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        W[Index] = ((uint32)Block[Index * 4] << 24) | ((uint32)Block[Index * 4 + 1] << 16) |
+            ((uint32)Block[Index * 4 + 2] << 8) | (uint32)Block[Index * 4 + 3];
+    }
+    for (int32 Index = 16; Index < 64; ++Index)
+    {
+        const uint32 S0 = RotateRight(W[Index - 15], 7) ^ RotateRight(W[Index - 15], 18) ^ (W[Index - 15] >> 3);
+        const uint32 S1 = RotateRight(W[Index - 2], 17) ^ RotateRight(W[Index - 2], 19) ^ (W[Index - 2] >> 10);
+        W[Index] = W[Index - 16] + S0 + W[Index - 7] + S1;
+    }
+
+    uint32 A = State[0], B = State[1], C = State[2], D = State[3];
+    uint32 E = State[4], F = State[5], G = State[6], H = State[7];
+
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        const uint32 S1 = RotateRight(E, 6) ^ RotateRight(E, 11) ^ RotateRight(E, 25);
+        const uint32 Choose = (E & F) ^ (~E & G);
+        const uint32 Temp1 = H + S1 + Choose + RoundConstants[Index] + W[Index];
+        const uint32 S0 = RotateRight(A, 2) ^ RotateRight(A, 13) ^ RotateRight(A, 22);
+        const uint32 Majority = (A & B) ^ (A & C) ^ (B & C);
+        const uint32 Temp2 = S0 + Majority;
+
+        H = G;
+        G = F;
+        F = E;
+        E = D + Temp1;
+        D = C;
+        C = B;
+        B = A;
+        A = Temp1 + Temp2;
+    }
+
+    State[0] += A; State[1] += B; State[2] += C; State[3] += D;
+    State[4] += E; State[5] += F; State[6] += G; State[7] += H;
+}
+
+TArray<uint8> FHttpSha256::HashBuffer(const uint8* Data, int64 Length)
+{
+    FHttpSha256 Hasher;
+    Hasher.Update(Data, Length);
+
+    TArray<uint8> Digest;
+    Digest.SetNumUninitialized(DigestSize);
+    Hasher.Final(Digest.GetData());
+    return Digest;
+}
+
+FString FHttpSha256::ToHex(const uint8* Data, int32 Length)
+{
+    static const TCHAR HexDigits[] = TEXT("0123456789abcdef");
+
+    FString Result;
+    Result.Reserve(Length * 2);
+    for (int32 Index = 0; Index < Length; ++Index)
+    {
+        Result.AppendChar(HexDigits[Data[Index] >> 4]);
+        Result.AppendChar(HexDigits[Data[Index] & 0x0F]);
+    }
+    return Result;
+}
+
+// =============================================================================
+// REQUEST SIGNER
+// =============================================================================
+
+namespace HttpSigningDetail
+{
+    /** Size of each read when hashing a streamed file body */
+    static constexpr int64 FileReadChunkSize = 64 * 1024;
+
+    /** Derived SigV4 keys, keyed by "AccessKeyId/Date/Region/Service" */
+    static FCriticalSection KeyCacheLock;
+    static TMap<FString, TArray<uint8>> DerivedKeyCache;
+
+    static TArray<uint8> StringToBytes(const FString& Value)
+    {
+        FTCHARToUTF8 Utf8(*Value);
+        return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    /** Split a URL into its path and query parts (host is taken from GetDomainFromURL) */
+    static void SplitUrl(const FString& URL, FString& OutPath, FString& OutQuery)
+    {
+        const int32 ProtocolEnd = URL.Find(TEXT("://"));
+        const int32 HostStart = ProtocolEnd >= 0 ? ProtocolEnd + 3 : 0;
+
+        int32 PathStart = INDEX_NONE;
+        for (int32 Index = HostStart; Index < URL.Len(); ++Index)
+        {
+            if (URL[Index] == TEXT('/') || URL[Index] == TEXT('?'))
+            {
+                PathStart = Index;
+                break;
+            }
+        }
+
+        FString PathAndQuery = PathStart >= 0 ? URL.RightChop(PathStart) : FString();
+        if (!PathAndQuery.Split(TEXT("?"), &OutPath, &OutQuery))
+        {
+            OutPath = PathAndQuery;
+            OutQuery.Reset();
+        }
+
+        if (OutPath.IsEmpty())
+        {
+            OutPath = TEXT("/");
+        }
+    }
+
+    /** Decode %XX escapes of a URL component into raw bytes (malformed escapes are kept as-is) */
+    static TArray<uint8> PercentDecode(const FString& Value)
+    {
+        FTCHARToUTF8 Utf8(*Value);
+        const uint8* Bytes = reinterpret_cast<const uint8*>(Utf8.Get());
+        const int32 Length = Utf8.Length();
+
+        TArray<uint8> Decoded;
+        Decoded.Reserve(Length);
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            if (Bytes[Index] == '%' && Index + 2 < Length && FChar::IsHexDigit(Bytes[Index + 1]) && FChar::IsHexDigit(Bytes[Index + 2]))
+            {
+                Decoded.Add((uint8)((FParse::HexDigit(Bytes[Index + 1]) << 4) | FParse::HexDigit(Bytes[Index + 2])));
+                Index += 2;
+            }
+            else
+            {
+                Decoded.Add(Bytes[Index]);
+            }
+        }
+        return Decoded;
+    }
+
+    /** RFC 3986 percent-encoding: everything but unreserved characters, with uppercase hex digits */
+    static FString UriEncode(const TArray<uint8>& Bytes)
+    {
+        static const TCHAR HexDigits[] = TEXT("0123456789ABCDEF");
+
+        FString Encoded;
+        Encoded.Reserve(Bytes.Num());
+        for (const uint8 Byte : Bytes)
+        {
+            const bool bUnreserved = (Byte >= 'A' && Byte <= 'Z') || (Byte >= 'a' && Byte <= 'z') || (Byte >= '0' && Byte <= '9') ||
+                Byte == '-' || Byte == '_' || Byte == '.' || Byte == '~';
+            if (bUnreserved)
+            {
+                Encoded.AppendChar((TCHAR)Byte);
+            }
+            else
+            {
+                Encoded.AppendChar(TEXT('%'));
+                Encoded.AppendChar(HexDigits[Byte >> 4]);
+                Encoded.AppendChar(HexDigits[Byte & 0x0F]);
+            }
+        }
+        return Encoded;
+    }
+
+    /** Re-encode a URL component consistently, whether the caller escaped it or not */
+    static FString NormalizeComponent(const FString& Value)
+    {
+        return UriEncode(PercentDecode(Value));
+    }
+
+    /**
+     * Encode each segment of a path, keeping the slashes
+     * SigV4 encodes segments twice for every service but S3, so already-escaped characters are signed as sent.
+     */
+    static FString CanonicalizePath(const FString& Path, bool bDoubleEncode)
+    {
+        TArray<FString> Segments;
+        Path.ParseIntoArray(Segments, TEXT("/"), false);
+        for (FString& Segment : Segments)
+        {
+            Segment = NormalizeComponent(Segment);
+            if (bDoubleEncode)
+            {
+                Segment = UriEncode(StringToBytes(Segment));
+            }
+        }
+        return FString::Join(Segments, TEXT("/"));
+    }
+
+    /**
+     * Build the canonical header block ("name:value\n" per header, sorted) and the signed header list ("a;b;c")
+     *
+     * @param ShouldSign - Whether a lowercased header name is signed; host is always signed
+     */
+    static void CanonicalizeHeaders(const IHttpRequest& Request, TFunctionRef<bool(const FString&)> ShouldSign,
+        FString& OutCanonicalHeaders, FString& OutSignedHeaders)
+    {
+        TMap<FString, FString> SignedHeaderValues;
+        SignedHeaderValues.Add(TEXT("host"), UHttpBlueprintFunctionLibrary::GetDomainFromURL(Request.GetURL()).ToLower());
+        for (const FString& HeaderLine : Request.GetAllHeaders())
+        {
+            FString HeaderName, HeaderValue;
+            if (HeaderLine.Split(TEXT(":"), &HeaderName, &HeaderValue))
+            {
+                HeaderName = HeaderName.TrimStartAndEnd().ToLower();
+                if (ShouldSign(HeaderName))
+                {
+                    SignedHeaderValues.Add(HeaderName, HeaderValue.TrimStartAndEnd());
+                }
+            }
+        }
+        SignedHeaderValues.KeySort([](const FString& A, const FString& B)
+            {
+                return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+            });
+
+        OutCanonicalHeaders.Reset();
+        OutSignedHeaders.Reset();
+        for (const auto& HeaderPair : SignedHeaderValues)
+        {
+            OutCanonicalHeaders += HeaderPair.Key + TEXT(":") + HeaderPair.Value + TEXT("\n");
+            if (!OutSignedHeaders.IsEmpty())
+            {
+                OutSignedHeaders += TEXT(";");
+            }
+            OutSignedHeaders += HeaderPair.Key;
+        }
+    }
+}
+
+bool FHttpRequestSigner::SignRequest(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+    const FHttpSigningConfig& Config,
+    FString& OutErrorMessage)
+{
+    if (Config.Scheme == EHttpSigningScheme::None)
+    {
+        return true;
+    }
+
+    if (Config.SecretKey.IsEmpty())
+    {
+        OutErrorMessage = TEXT("Request signing failed: secret key cannot be empty");
+        return false;
+    }
+
+    FString PayloadHash;
+    if (!HashRequestBody(Request, Config, PayloadHash, OutErrorMessage))
+    {
+        return false;
+    }
+
+    switch (Config.Scheme)
+    {
+    case EHttpSigningScheme::AwsSigV4:
+        if (Config.AccessKeyId.IsEmpty() || Config.Region.IsEmpty() || Config.Service.IsEmpty())
+        {
+            OutErrorMessage = TEXT("Request signing failed: SigV4 requires an access key id, region and service");
+            return false;
+        }
+        return SignAwsSigV4(Request, Config, PayloadHash);
+
+    case EHttpSigningScheme::CustomHmac:
+        return SignCustomHmac(Request, Config, PayloadHash);
+
+    default:
+        OutErrorMessage = TEXT("Request signing failed: unknown signing scheme");
+        return false;
+    }
+}
+
+TArray<uint8> FHttpRequestSigner::HmacSha256(const TArray<uint8>& Key, const FString& Message)
+{
+    constexpr int32 BlockSize = FHttpSha256::BlockSize;
+
+    // Keys longer than a block are hashed first, shorter keys are zero padded
+    uint8 KeyBlock[BlockSize] = {};
+    if (Key.Num() > BlockSize)
+    {
+        TArray<uint8> HashedKey = FHttpSha256::HashBuffer(Key.GetData(), Key.Num());
+        FMemory::Memcpy(KeyBlock, HashedKey.GetData(), HashedKey.Num());
+    }
+    else if (Key.Num() > 0)
+    {
+        FMemory::Memcpy(KeyBlock, Key.GetData(), Key.Num());
+    }
+
+    uint8 InnerPad[BlockSize];
+    uint8 OuterPad[BlockSize];
+    for (int32 Index = 0; Index < BlockSize; ++Index)
+    {
+        InnerPad[Index] = KeyBlock[Index] ^ 0x36;
+        OuterPad[Index] = KeyBlock[Index] ^ 0x5c;
+    }
+
+    uint8 InnerDigest[FHttpSha256::DigestSize];
+    FHttpSha256 Hasher;
+    Hasher.Update(InnerPad, BlockSize);
+    Hasher.UpdateString(Message);
+    Hasher.Final(InnerDigest);
+
+    TArray<uint8> Result;
+    Result.SetNumUninitialized(FHttpSha256::DigestSize);
+    Hasher.Reset();
+    Hasher.Update(OuterPad, BlockSize);
+    Hasher.Update(InnerDigest, FHttpSha256::DigestSize);
+    Hasher.Final(Result.GetData());
+
+    return Result;
+}
+
+void FHttpRequestSigner::ClearKeyCache()
+{
+    FScopeLock Lock(&HttpSigningDetail::KeyCacheLock);
+    HttpSigningDetail::DerivedKeyCache.Empty();
+}
+
+FString FHttpRequestSigner::CanonicalizeQuery(const FString& Query)
+{
+    if (Query.IsEmpty())
+    {
+        return FString();
+    }
+
+    TArray<FString> Params;
+    Query.ParseIntoArray(Params, TEXT("&"), true);
+
+    TArray<TPair<FString, FString>> EncodedParams;
+    EncodedParams.Reserve(Params.Num());
+    for (const FString& Param : Params)
+    {
+        FString Name, Value;
+        if (!Param.Split(TEXT("="), &Name, &Value))
+        {
+            Name = Param;
+        }
+        EncodedParams.Emplace(HttpSigningDetail::NormalizeComponent(Name), HttpSigningDetail::NormalizeComponent(Value));
+    }
+
+    // SigV4 sorts by encoded name, then by encoded value, in byte order (FString's operator< is
+    // case-insensitive). Comparing joined "name=value" strings would not: '=' (0x3D) sorts above
+    // digits, so "a1=2" would land before "a=1".
+    EncodedParams.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+        {
+            const int32 NameOrder = A.Key.Compare(B.Key, ESearchCase::CaseSensitive);
+            return NameOrder != 0 ? NameOrder < 0 : A.Value.Compare(B.Value, ESearchCase::CaseSensitive) < 0;
+        });
+
+    FString Canonical;
+    for (const TPair<FString, FString>& Param : EncodedParams)
+    {
+        if (!Canonical.IsEmpty())
+        {
+            Canonical.AppendChar(TEXT('&'));
+        }
+        Canonical += Param.Key;
+        Canonical.AppendChar(TEXT('='));
+        Canonical += Param.Value;
+    }
+    return Canonical;
+}
+
+bool FHttpRequestSigner::HashRequestBody(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+    const FHttpSigningConfig& Config,
+    FString& OutHexDigest,
+    FString& OutErrorMessage)
+{
+    FHttpSha256 Hasher;
+    uint8 Digest[FHttpSha256::DigestSize];
+
+    if (!Config.BodyFilePath.IsEmpty())
+    {
+        // Stream the file through the hasher so the body is never fully loaded
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*Config.BodyFilePath));
+        if (!FileHandle)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Request signing failed: cannot open body file %s"), *Config.BodyFilePath);
+            return false;
+        }
+
+        TArray<uint8> Chunk;
+        Chunk.SetNumUninitialized(HttpSigningDetail::FileReadChunkSize);
+
+        int64 Remaining = FileHandle->Size();
+        while (Remaining > 0)
+        {
+            const int64 ToRead = FMath::Min(Remaining, HttpSigningDetail::FileReadChunkSize);
+            if (!FileHandle->Read(Chunk.GetData(), ToRead))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Request signing failed: error reading body file %s"), *Config.BodyFilePath);
+                return false;
+            }
+            Hasher.Update(Chunk.GetData(), ToRead);
+            Remaining -= ToRead;
+        }
+    }
+    else
+    {
+        const TArray<uint8>& Content = Request->GetContent();
+        Hasher.Update(Content.GetData(), Content.Num());
+    }
+
+    Hasher.Final(Digest);
+    OutHexDigest = FHttpSha256::ToHex(Digest, FHttpSha256::DigestSize);
+    return true;
+}
+
+TArray<uint8> FHttpRequestSigner::GetSigV4SigningKey(const FHttpSigningConfig& Config, const FString& DateStamp)
+{
+    using namespace HttpSigningDetail;
+
+    const FString CacheKey = FString::Printf(TEXT("%s/%s/%s/%s"),
+        *Config.AccessKeyId, *DateStamp, *Config.Region, *Config.Service);
+
+    {
+        FScopeLock Lock(&KeyCacheLock);
+        if (const TArray<uint8>* CachedKey = DerivedKeyCache.Find(CacheKey))
+        {
+            return *CachedKey;
+        }
+    }
+
+    // kSigning = HMAC(HMAC(HMAC(HMAC("AWS4" + secret, date), region), service), "aws4_request")
+    TArray<uint8> DateKey = HmacSha256(StringToBytes(TEXT("AWS4") + Config.SecretKey), DateStamp);
+    TArray<uint8> RegionKey = HmacSha256(DateKey, Config.Region);
+    TArray<uint8> ServiceKey = HmacSha256(RegionKey, Config.Service);
+    TArray<uint8> SigningKey = HmacSha256(ServiceKey, TEXT("aws4_request"));
+
+    {
+        FScopeLock Lock(&KeyCacheLock);
+
+        // Keys are only valid for one day, so drop anything derived for an older date
+        const FString DateSegment = FString::Printf(TEXT("/%s/"), *DateStamp);
+        for (auto It = DerivedKeyCache.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().Contains(DateSegment))
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        DerivedKeyCache.Add(CacheKey, SigningKey);
+    }
+
+    return SigningKey;
+}
+
+bool FHttpRequestSigner::SignAwsSigV4(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+    const FHttpSigningConfig& Config,
+    const FString& PayloadHash)
+{
+    const FDateTime Now = FDateTime::UtcNow();
+    const FString AmzDate = Now.ToString(TEXT("%Y%m%dT%H%M%SZ"));
+    const FString DateStamp = Now.ToString(TEXT("%Y%m%d"));
+
+    Request->SetHeader(TEXT("x-amz-date"), AmzDate);
+    Request->SetHeader(TEXT("x-amz-content-sha256"), PayloadHash);
+
+    FString Path, Query;
+    HttpSigningDetail::SplitUrl(Request->GetURL(), Path, Query);
+
+    // Sign host, content-type and all x-amz-* headers. Other headers (e.g., User-Agent)
+    // are commonly rewritten by proxies and would break the signature.
+    FString CanonicalHeaders;
+    FString SignedHeaders;
+    HttpSigningDetail::CanonicalizeHeaders(*Request, [](const FString& HeaderName)
+        {
+            return HeaderName == TEXT("content-type") || HeaderName.StartsWith(TEXT("x-amz-"));
+        },
+        CanonicalHeaders, SignedHeaders);
+
+    const bool bDoubleEncodePath = !Config.Service.Equals(TEXT("s3"), ESearchCase::IgnoreCase);
+
+    const FString CanonicalRequest = FString::Printf(TEXT("%s\n%s\n%s\n%s\n%s\n%s"),
+        *Request->GetVerb().ToUpper(),
+        *HttpSigningDetail::CanonicalizePath(Path, bDoubleEncodePath),
+        *CanonicalizeQuery(Query),
+        *CanonicalHeaders,
+        *SignedHeaders,
+        *PayloadHash);
+
+    FHttpSha256 Hasher;
+    uint8 CanonicalDigest[FHttpSha256::DigestSize];
+    Hasher.UpdateString(CanonicalRequest);
+    Hasher.Final(CanonicalDigest);
+
+    const FString CredentialScope = FString::Printf(TEXT("%s/%s/%s/aws4_request"),
+        *DateStamp, *Config.Region, *Config.Service);
+
+    const FString StringToSign = FString::Printf(TEXT("AWS4-HMAC-SHA256\n%s\n%s\n%s"),
+        *AmzDate,
+        *CredentialScope,
+        *FHttpSha256::ToHex(CanonicalDigest, FHttpSha256::DigestSize));
+
+    TArray<uint8> Signature = HmacSha256(GetSigV4SigningKey(Config, DateStamp), StringToSign);
+
+    Request->SetHeader(TEXT("Authorization"), FString::Printf(
+        TEXT("AWS4-HMAC-SHA256 Credential=%s/%s, SignedHeaders=%s, Signature=%s"),
+        *Config.AccessKeyId,
+        *CredentialScope,
+        *SignedHeaders,
+        *FHttpSha256::ToHex(Signature.GetData(), Signature.Num())));
+
+    return true;
+}
+
+bool FHttpRequestSigner::SignCustomHmac(
+    const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+    const FHttpSigningConfig& Config,
+    const FString& PayloadHash)
+{
+    const FString Timestamp = FString::Printf(TEXT("%lld"), FDateTime::UtcNow().ToUnixTimestamp());
+    const FString SignatureHeader = Config.SignatureHeader.IsEmpty() ? TEXT("X-Signature") : Config.SignatureHeader;
+
+    // Set before canonicalizing so they are signed too
+    Request->SetHeader(TEXT("X-Timestamp"), Timestamp);
+    Request->SetHeader(TEXT("X-Content-SHA256"), PayloadHash);
+    if (!Config.AccessKeyId.IsEmpty())
+    {
+        Request->SetHeader(TEXT("X-Key-Id"), Config.AccessKeyId);
+    }
+
+    FString Path, Query;
+    HttpSigningDetail::SplitUrl(Request->GetURL(), Path, Query);
+    Path = HttpSigningDetail::CanonicalizePath(Path, false);
+    if (!Query.IsEmpty())
+    {
+        Path += TEXT("?") + CanonicalizeQuery(Query);
+    }
+
+    // Sign host, content-type and x-* headers (but the signature and signed header list themselves),
+    // so a tampered header fails verification; the list tells the server which ones to check
+    const FString LowerSignatureHeader = SignatureHeader.ToLower();
+    FString CanonicalHeaders;
+    FString SignedHeaders;
+    HttpSigningDetail::CanonicalizeHeaders(*Request, [&LowerSignatureHeader](const FString& HeaderName)
+        {
+            return HeaderName == TEXT("content-type") ||
+                (HeaderName.StartsWith(TEXT("x-")) && HeaderName != LowerSignatureHeader && HeaderName != TEXT("x-signed-headers"));
+        },
+        CanonicalHeaders, SignedHeaders);
+
+    const FString StringToSign = FString::Printf(TEXT("%s\n%s\n%s\n%s%s\n%s"),
+        *Request->GetVerb().ToUpper(), *Path, *Timestamp, *CanonicalHeaders, *SignedHeaders, *PayloadHash);
+
+    TArray<uint8> Signature = HmacSha256(HttpSigningDetail::StringToBytes(Config.SecretKey), StringToSign);
+
+    Request->SetHeader(TEXT("X-Signed-Headers"), SignedHeaders);
+    Request->SetHeader(SignatureHeader, FHttpSha256::ToHex(Signature.GetData(), Signature.Num()));
+
+    return true;
+}
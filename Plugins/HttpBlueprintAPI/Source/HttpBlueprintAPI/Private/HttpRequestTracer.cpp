@@ -0,0 +1,373 @@
+#include "HttpRequestTracer.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpRequestTracerCommands
+{
+    static FAutoConsoleCommand StartExportCommand(
+        TEXT("HttpBlueprint.Trace.StartExport"),
+        TEXT("Export client spans of sampled HTTP requests to an OTLP JSON file. Usage: HttpBlueprint.Trace.StartExport [FilePath]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                FHttpRequestTracer::Get().StartExport(Args.Num() > 0 ? Args[0] : FString());
+            }));
+
+    static FAutoConsoleCommand StopExportCommand(
+        TEXT("HttpBlueprint.Trace.StopExport"),
+        TEXT("Write pending HTTP client spans and close the OTLP JSON file."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpRequestTracer::Get().StopExport();
+            }));
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+namespace HttpRequestTracerDetail
+{
+    typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FCondensedJsonWriter;
+
+    /** Spans buffered before an OTLP line is written */
+    static constexpr int32 SpansPerLine = 64;
+
+    /** OTLP SPAN_KIND_CLIENT */
+    static constexpr int32 SpanKindClient = 3;
+
+    /** OTLP STATUS_CODE_ERROR */
+    static constexpr int32 StatusCodeError = 2;
+
+    /** Thread-local splitmix64: ids and sampling decisions without locks or shared state */
+    static uint64 NextRandom()
+    {
+        static thread_local uint64 State = (uint64(FPlatformTLS::GetCurrentThreadId()) << 32) ^ FPlatformTime::Cycles64() ^ UPTRINT(&State);
+        uint64 Value = (State += 0x9E3779B97F4A7C15ull);
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    /** Non-zero random value (all-zero trace and span ids are invalid) */
+    static uint64 NextId()
+    {
+        uint64 Id = NextRandom();
+        while (Id == 0)
+        {
+            Id = NextRandom();
+        }
+        return Id;
+    }
+
+    static float GetSampleRate(const FHttpBlueprintRuntimeSettings& Settings, const FString& URL)
+    {
+        for (const TPair<FString, float>& Rule : Settings.TraceRouteRules)
+        {
+            if (URL.MatchesWildcard(Rule.Key))
+            {
+                return Rule.Value;
+            }
+        }
+        return Settings.TraceSampleRate;
+    }
+
+    static bool ShouldSample(float SampleRate)
+    {
+        if (SampleRate >= 1.0f)
+        {
+            return true;
+        }
+        if (SampleRate <= 0.0f)
+        {
+            return false;
+        }
+        return (NextRandom() >> 40) < (uint64)(SampleRate * 16777216.0f);
+    }
+
+    static bool IsLowerHex(const FString& Value, int32 Start, int32 Length)
+    {
+        bool bAllZero = true;
+        for (int32 Index = Start; Index < Start + Length; ++Index)
+        {
+            const TCHAR Char = Value[Index];
+            if (!((Char >= TEXT('0') && Char <= TEXT('9')) || (Char >= TEXT('a') && Char <= TEXT('f'))))
+            {
+                return false;
+            }
+            bAllZero &= Char == TEXT('0');
+        }
+        return !bAllZero;
+    }
+
+    static int64 ToUnixNano(const FDateTime& Time)
+    {
+        return (Time - FDateTime(1970, 1, 1)).GetTicks() * ETimespan::NanosecondsPerTick;
+    }
+
+    static void WriteAttribute(FCondensedJsonWriter& Writer, const TCHAR* Key, const FString& Value)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("key"), Key);
+        Writer.WriteObjectStart(TEXT("value"));
+        Writer.WriteValue(TEXT("stringValue"), Value);
+        Writer.WriteObjectEnd();
+        Writer.WriteObjectEnd();
+    }
+
+    /** OTLP JSON carries 64-bit integers as strings */
+    static void WriteAttribute(FCondensedJsonWriter& Writer, const TCHAR* Key, int64 Value)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("key"), Key);
+        Writer.WriteObjectStart(TEXT("value"));
+        Writer.WriteValue(TEXT("intValue"), LexToString(Value));
+        Writer.WriteObjectEnd();
+        Writer.WriteObjectEnd();
+    }
+}
+
+// =============================================================================
+// PROPAGATION
+// =============================================================================
+
+FHttpRequestTracer& FHttpRequestTracer::Get()
+{
+    static FHttpRequestTracer Instance;
+    return Instance;
+}
+
+FHttpRequestTracer::FHttpRequestTracer()
+    : WriterPipe(TEXT("HttpBlueprintTraceWriter"))
+{
+}
+
+void FHttpRequestTracer::InjectHeaders(IHttpRequest& Request, const FHttpBlueprintRuntimeSettings& Settings) const
+{
+    using namespace HttpRequestTracerDetail;
+
+    if (!Settings.bTraceEnabled || !Request.GetHeader(TEXT("traceparent")).IsEmpty())
+    {
+        return;
+    }
+
+    const bool bSampled = ShouldSample(GetSampleRate(Settings, Request.GetURL()));
+
+    // version-traceid-parentid-flags; this request's span is the parent of the server's spans
+    Request.SetHeader(TEXT("traceparent"), FString::Printf(TEXT("00-%016llx%016llx-%016llx-%s"),
+        NextId(), NextRandom(), NextId(), bSampled ? TEXT("01") : TEXT("00")));
+
+    if (!Settings.TraceState.IsEmpty())
+    {
+        Request.SetHeader(TEXT("tracestate"), Settings.TraceState);
+    }
+}
+
+bool FHttpRequestTracer::ParseTraceParent(const FString& Value, FString& OutTraceId, FString& OutSpanId, bool& bOutSampled)
+{
+    using namespace HttpRequestTracerDetail;
+
+    // 00-<32 hex trace id>-<16 hex span id>-<2 hex flags>
+    if (Value.Len() != 55 || !Value.StartsWith(TEXT("00-")) || Value[35] != TEXT('-') || Value[52] != TEXT('-') ||
+        !IsLowerHex(Value, 3, 32) || !IsLowerHex(Value, 36, 16))
+    {
+        return false;
+    }
+
+    OutTraceId = Value.Mid(3, 32);
+    OutSpanId = Value.Mid(36, 16);
+    bOutSampled = (FParse::HexDigit(Value[54]) & 1) != 0;
+    return true;
+}
+
+// =============================================================================
+// EXPORT
+// =============================================================================
+
+bool FHttpRequestTracer::StartExport(const FString& FilePath)
+{
+    if (bExporting)
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HTTP span export is already running"));
+        return false;
+    }
+
+    // Make sure a previous export has fully finished before reusing the writer
+    WriterPipe.WaitUntilEmpty();
+
+    const FString ExportPath = FilePath.IsEmpty()
+        ? FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("HttpSpans_%s.jsonl"), *FDateTime::Now().ToString()))
+        : FilePath;
+
+    ExportWriter.Reset(IFileManager::Get().CreateFileWriter(*ExportPath));
+    if (!ExportWriter.IsValid())
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not open HTTP span export file: %s"), *ExportPath);
+        return false;
+    }
+
+    WrittenSpans = 0;
+    bExporting = true;
+
+    if (!FHttpBlueprintRuntimeSettings::Get().bTraceEnabled)
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HttpBlueprint.Trace.Enabled is off; only requests with a caller-provided traceparent will be exported"));
+    }
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HTTP span export started: %s"), *ExportPath);
+    return true;
+}
+
+void FHttpRequestTracer::StopExport()
+{
+    if (!bExporting.Exchange(false))
+    {
+        return;
+    }
+
+    WriterPipe.Launch(UE_SOURCE_LOCATION, [this]()
+        {
+            FlushSpans();
+            ExportWriter->Close();
+            ExportWriter.Reset();
+        }).Wait();
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HTTP span export stopped. Spans written: %d"), WrittenSpans);
+}
+
+void FHttpRequestTracer::RecordSpan(const FHttpRequestPtr& Request, const FHttpResponseData& Response)
+{
+    if (!bExporting || !Request.IsValid())
+    {
+        return;
+    }
+
+    FHttpTraceSpan Span;
+    bool bSampled = false;
+    if (!ParseTraceParent(Request->GetHeader(TEXT("traceparent")), Span.TraceId, Span.SpanId, bSampled) || !bSampled)
+    {
+        return;
+    }
+
+    const FDateTime EndTime = FDateTime::UtcNow();
+    Span.EndTimeUnixNano = HttpRequestTracerDetail::ToUnixNano(EndTime);
+    Span.StartTimeUnixNano = HttpRequestTracerDetail::ToUnixNano(EndTime - FTimespan::FromSeconds(Response.ResponseTimeSeconds));
+    Span.Method = Request->GetVerb();
+    Span.URL = Request->GetURL();
+    Span.ResponseCode = Response.ResponseCode;
+    Span.ResponseBytes = Response.ResponseBody.Len();
+    Span.ErrorKind = Response.ErrorKind;
+
+    WriterPipe.Launch(UE_SOURCE_LOCATION, [this, Span = MoveTemp(Span)]() mutable
+        {
+            if (!ExportWriter.IsValid())
+            {
+                return;
+            }
+
+            PendingSpans.Add(MoveTemp(Span));
+            if (PendingSpans.Num() >= HttpRequestTracerDetail::SpansPerLine)
+            {
+                FlushSpans();
+            }
+        });
+}
+
+void FHttpRequestTracer::FlushSpans()
+{
+    if (PendingSpans.Num() == 0 || !ExportWriter.IsValid())
+    {
+        return;
+    }
+
+    FTCHARToUTF8 Utf8(*(SerializeSpans(PendingSpans) + TEXT("\n")));
+    ExportWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+
+    WrittenSpans += PendingSpans.Num();
+    PendingSpans.Reset();
+}
+
+FString FHttpRequestTracer::SerializeSpans(const TArray<FHttpTraceSpan>& Spans) const
+{
+    using namespace HttpRequestTracerDetail;
+
+    FString Json;
+    TSharedRef<FCondensedJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("resourceSpans"));
+    Writer->WriteObjectStart();
+
+    Writer->WriteObjectStart(TEXT("resource"));
+    Writer->WriteArrayStart(TEXT("attributes"));
+    WriteAttribute(*Writer, TEXT("service.name"), FString(FApp::GetProjectName()));
+    WriteAttribute(*Writer, TEXT("telemetry.sdk.name"), FString(TEXT("HttpBlueprintAPI")));
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+
+    Writer->WriteArrayStart(TEXT("scopeSpans"));
+    Writer->WriteObjectStart();
+    Writer->WriteObjectStart(TEXT("scope"));
+    Writer->WriteValue(TEXT("name"), TEXT("HttpBlueprintAPI"));
+    Writer->WriteObjectEnd();
+
+    Writer->WriteArrayStart(TEXT("spans"));
+    for (const FHttpTraceSpan& Span : Spans)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("traceId"), Span.TraceId);
+        Writer->WriteValue(TEXT("spanId"), Span.SpanId);
+        Writer->WriteValue(TEXT("name"), Span.Method);
+        Writer->WriteValue(TEXT("kind"), SpanKindClient);
+        Writer->WriteValue(TEXT("startTimeUnixNano"), LexToString(Span.StartTimeUnixNano));
+        Writer->WriteValue(TEXT("endTimeUnixNano"), LexToString(Span.EndTimeUnixNano));
+
+        Writer->WriteArrayStart(TEXT("attributes"));
+        WriteAttribute(*Writer, TEXT("http.request.method"), Span.Method);
+        WriteAttribute(*Writer, TEXT("url.full"), Span.URL);
+        if (Span.ResponseCode > 0)
+        {
+            WriteAttribute(*Writer, TEXT("http.response.status_code"), Span.ResponseCode);
+            WriteAttribute(*Writer, TEXT("http.response.body.size"), Span.ResponseBytes);
+        }
+        if (Span.ErrorKind != EHttpErrorKind::None)
+        {
+            // Semantic conventions use the status code as error.type for HTTP status failures
+            const bool bStatusError = Span.ErrorKind == EHttpErrorKind::HttpClientError || Span.ErrorKind == EHttpErrorKind::HttpServerError ||
+                Span.ErrorKind == EHttpErrorKind::HttpUnexpectedStatus;
+            WriteAttribute(*Writer, TEXT("error.type"), bStatusError
+                ? LexToString(Span.ResponseCode)
+                : StaticEnum<EHttpErrorKind>()->GetNameStringByValue((int64)Span.ErrorKind));
+        }
+        Writer->WriteArrayEnd();
+
+        if (Span.ErrorKind != EHttpErrorKind::None)
+        {
+            Writer->WriteObjectStart(TEXT("status"));
+            Writer->WriteValue(TEXT("code"), StatusCodeError);
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Json;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Tasks/Pipe.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+class FArchive;
+
+/**
+ * Client-side span of one traced request, taken on the completion thread
+ * and serialized to OTLP JSON later on a worker
+ */
+struct FHttpTraceSpan
+{
+    /** 32 lowercase hex digits */
+    FString TraceId;
+
+    /** 16 lowercase hex digits */
+    FString SpanId;
+
+    FString Method;
+    FString URL;
+    int64 StartTimeUnixNano = 0;
+    int64 EndTimeUnixNano = 0;
+    int32 ResponseCode = 0;
+    int32 ResponseBytes = 0;
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+};
+
+/**
+ * W3C Trace Context propagation and client span export
+ *
+ * When HttpBlueprint.Trace.Enabled is set, every request gets a traceparent header (and
+ * tracestate when HttpBlueprint.Trace.State is set) with fresh trace and span ids from a
+ * thread-local generator. The sampled flag is decided per request from the first matching
+ * HttpBlueprint.Trace.RouteSampleRates rule, or HttpBlueprint.Trace.SampleRate otherwise.
+ *
+ * While an export is running (HttpBlueprint.Trace.StartExport), sampled requests are recorded
+ * as CLIENT spans and appended to a file in OTLP JSON, one ExportTraceServiceRequest per line,
+ * as read by the OpenTelemetry Collector's otlpjsonfile receiver. Server spans of the same
+ * trace then share the trace id and name the client span as their parent.
+ */
+class FHttpRequestTracer
+{
+public:
+
+    static FHttpRequestTracer& Get();
+
+    /** Add traceparent/tracestate to a request about to be sent (no-op when tracing is off or the caller set traceparent) */
+    void InjectHeaders(IHttpRequest& Request, const FHttpBlueprintRuntimeSettings& Settings) const;
+
+    /** Record the span of a finished request if its traceparent is sampled and an export is running */
+    void RecordSpan(const FHttpRequestPtr& Request, const FHttpResponseData& Response);
+
+    /** Start appending spans to an OTLP JSON file (empty path picks one in the log dir) */
+    bool StartExport(const FString& FilePath);
+
+    /** Write pending spans and close the file */
+    void StopExport();
+
+    bool IsExporting() const { return bExporting; }
+
+    /**
+     * Parse a traceparent header value
+     *
+     * @return False if it is not a version 00 traceparent
+     */
+    static bool ParseTraceParent(const FString& Value, FString& OutTraceId, FString& OutSpanId, bool& bOutSampled);
+
+private:
+
+    FHttpRequestTracer();
+
+    /** Append buffered spans as one OTLP line (writer pipe only) */
+    void FlushSpans();
+
+    /** Serialize spans as an OTLP ExportTraceServiceRequest (writer pipe only) */
+    FString SerializeSpans(const TArray<FHttpTraceSpan>& Spans) const;
+
+    UE::Tasks::FPipe WriterPipe;
+    TUniquePtr<FArchive> ExportWriter;
+    TArray<FHttpTraceSpan> PendingSpans;
+    TAtomic<bool> bExporting { false };
+    int32 WrittenSpans = 0;
+};
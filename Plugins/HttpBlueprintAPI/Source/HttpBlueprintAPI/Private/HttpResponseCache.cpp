@@ -0,0 +1,349 @@
+#include "HttpResponseCache.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpMemoryTracker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpResponseCacheCommands
+{
+    static FAutoConsoleCommand ReportCommand(
+        TEXT("HttpBlueprint.Cache.Report"),
+        TEXT("Print the HTTP response cache size and hit rate."),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+            {
+                const FHttpResponseCache::FCacheStats Stats = FHttpResponseCache::Get().GetStats();
+                const uint64 Lookups = Stats.Hits + Stats.StaleHits + Stats.Misses;
+                Ar.Logf(TEXT("HTTP response cache: %d entries, %.1f KB (budget %.1f KB), %llu hits + %llu stale / %llu lookups (%.1f%%), %llu evictions"),
+                    Stats.NumEntries, Stats.Bytes / 1024.0, FHttpBlueprintRuntimeSettings::Get().CacheMaxBytes / 1024.0,
+                    Stats.Hits, Stats.StaleHits, Lookups, Lookups > 0 ? 100.0 * (Stats.Hits + Stats.StaleHits) / Lookups : 0.0, Stats.Evictions);
+            }));
+
+    static FAutoConsoleCommand ClearCommand(
+        TEXT("HttpBlueprint.Cache.Clear"),
+        TEXT("Drop every cached HTTP response."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpResponseCache::Get().Clear();
+            }));
+}
+
+// =============================================================================
+// RESPONSE CACHE
+// =============================================================================
+
+FHttpResponseCache& FHttpResponseCache::Get()
+{
+    static FHttpResponseCache Instance;
+    return Instance;
+}
+
+bool FHttpResponseCache::FEntry::IsWithin(EStaleWindow Window, double Now) const
+{
+    const double Age = Now - StoredTime - Lifetime.MaxAgeSeconds;
+    switch (Window)
+    {
+    case EStaleWindow::WhileRevalidate: return Age < Lifetime.StaleWhileRevalidateSeconds;
+    case EStaleWindow::IfError:         return Age < Lifetime.StaleIfErrorSeconds;
+    default:                            return false;
+    }
+}
+
+bool FHttpResponseCache::FEntry::MatchesVary(FRequestHeaderGetter GetRequestHeader) const
+{
+    for (const TPair<FString, FString>& Header : VaryHeaders)
+    {
+        if (!GetRequestHeader(Header.Key).Equals(Header.Value, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FString FHttpResponseCache::MakeKey(const FString& Method, const FString& URL)
+{
+    return Method.ToUpper() + TEXT(" ") + URL;
+}
+
+bool FHttpResponseCache::IsCacheableMethod(const FString& Method)
+{
+    return Method.Equals(TEXT("GET"), ESearchCase::IgnoreCase);
+}
+
+FHttpResponseCache::ELookupResult FHttpResponseCache::Find(const FString& Method, const FString& URL, FRequestHeaderGetter GetRequestHeader,
+    FHttpResponseData& OutResponse, EStaleWindow AllowStale)
+{
+    const double Now = FPlatformTime::Seconds();
+    const FString Key = MakeKey(Method, URL);
+
+    FScopeLock ScopeLock(&Lock);
+    FEntry* Entry = Entries.Find(Key);
+    if (!Entry || !Entry->MatchesVary(GetRequestHeader))
+    {
+        ++Misses;
+        return ELookupResult::Miss;
+    }
+
+    const bool bFresh = Entry->IsFresh(Now);
+    if (!bFresh && !Entry->IsWithin(AllowStale, Now))
+    {
+        ++Misses;
+        return ELookupResult::Miss;
+    }
+
+    ++(bFresh ? Hits : StaleHits);
+    Entry->LastAccessTime = Now;
+    OutResponse = Entry->Response;
+    OutResponse.bIsStale = !bFresh;
+    return bFresh ? ELookupResult::Fresh : ELookupResult::Stale;
+}
+
+bool FHttpResponseCache::Contains(const FString& Method, const FString& URL) const
+{
+    const double Now = FPlatformTime::Seconds();
+    const FString Key = MakeKey(Method, URL);
+
+    FScopeLock ScopeLock(&Lock);
+    const FEntry* Entry = Entries.Find(Key);
+    return Entry && Entry->IsFresh(Now);
+}
+
+bool FHttpResponseCache::Store(const FString& Method, const FString& URL, FRequestHeaderGetter GetRequestHeader, const FHttpResponseData& Response)
+{
+    LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+    const int64 MaxBytes = FHttpBlueprintRuntimeSettings::Get().CacheMaxBytes;
+    if (MaxBytes <= 0 || !Response.bWasSuccessful || !IsCacheableMethod(Method))
+    {
+        return false;
+    }
+
+    // Per-user responses must not answer requests made with other (or no) credentials
+    const FLifetime Lifetime = GetLifetime(Response);
+    if (!Lifetime.bCacheable || !GetRequestHeader(TEXT("Authorization")).IsEmpty())
+    {
+        return false;
+    }
+
+    FEntry Entry;
+    if (const FString* Vary = Response.ResponseHeaders.Find(TEXT("Vary")))
+    {
+        TArray<FString> HeaderNames;
+        Vary->ParseIntoArray(HeaderNames, TEXT(","));
+        for (FString& HeaderName : HeaderNames)
+        {
+            HeaderName.TrimStartAndEndInline();
+            if (HeaderName == TEXT("*"))
+            {
+                return false;
+            }
+
+            FString Value = GetRequestHeader(HeaderName);
+            Entry.VaryHeaders.Emplace(MoveTemp(HeaderName), MoveTemp(Value));
+        }
+    }
+    Entry.Response = Response;
+
+    // Results of per-request processing are not part of the cached response
+    Entry.Response.ExtractedFields.Empty();
+    Entry.Response.PipelineOutput.Reset();
+    Entry.Response.bIsStale = false;
+
+    FString Key = MakeKey(Method, URL);
+    Entry.StoredTime = Entry.LastAccessTime = FPlatformTime::Seconds();
+    Entry.Lifetime = Lifetime;
+    Entry.Bytes = GetEntryBytes(Key, Entry);
+    if (Entry.Bytes > MaxBytes)
+    {
+        return false;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    RemoveEntry(Key);
+    EvictToFit(MaxBytes, Entry.Bytes);
+
+    TotalBytes += Entry.Bytes;
+    FHttpMemoryTracker::AddCacheBytes(Entry.Bytes);
+    Entries.Add(MoveTemp(Key), MoveTemp(Entry));
+    return true;
+}
+
+void FHttpResponseCache::MarkRevalidated(const FString& Method, const FString& URL, const FHttpResponseData& NotModified)
+{
+    const FString Key = MakeKey(Method, URL);
+
+    FScopeLock ScopeLock(&Lock);
+    FEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        return;
+    }
+
+    // Headers describing the body the 304 does not carry stay as they were
+    for (const TPair<FString, FString>& Header : NotModified.ResponseHeaders)
+    {
+        if (!Header.Key.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase) &&
+            !Header.Key.Equals(TEXT("Content-Type"), ESearchCase::IgnoreCase) &&
+            !Header.Key.Equals(TEXT("Content-Encoding"), ESearchCase::IgnoreCase) &&
+            !Header.Key.Equals(TEXT("Transfer-Encoding"), ESearchCase::IgnoreCase))
+        {
+            Entry->Response.ResponseHeaders.Add(Header.Key, Header.Value);
+        }
+    }
+
+    Entry->Lifetime = GetLifetime(Entry->Response);
+    if (!Entry->Lifetime.bCacheable)
+    {
+        RemoveEntry(Key);
+        return;
+    }
+    Entry->StoredTime = FPlatformTime::Seconds();
+
+    const int64 Bytes = GetEntryBytes(Key, *Entry);
+    TotalBytes += Bytes - Entry->Bytes;
+    FHttpMemoryTracker::AddCacheBytes(Bytes - Entry->Bytes);
+    Entry->Bytes = Bytes;
+}
+
+bool FHttpResponseCache::BeginRevalidation(const FString& Method, const FString& URL)
+{
+    FString Key = MakeKey(Method, URL);
+
+    FScopeLock ScopeLock(&Lock);
+    bool bAlreadyRevalidating = false;
+    Revalidating.Add(MoveTemp(Key), &bAlreadyRevalidating);
+    return !bAlreadyRevalidating;
+}
+
+void FHttpResponseCache::EndRevalidation(const FString& Method, const FString& URL)
+{
+    const FString Key = MakeKey(Method, URL);
+
+    FScopeLock ScopeLock(&Lock);
+    Revalidating.Remove(Key);
+}
+
+void FHttpResponseCache::Clear()
+{
+    FScopeLock ScopeLock(&Lock);
+    Entries.Empty();
+    FHttpMemoryTracker::AddCacheBytes(-TotalBytes);
+    TotalBytes = 0;
+}
+
+FHttpResponseCache::FCacheStats FHttpResponseCache::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FCacheStats Stats;
+    Stats.NumEntries = Entries.Num();
+    Stats.Bytes = TotalBytes;
+    Stats.Hits = Hits;
+    Stats.StaleHits = StaleHits;
+    Stats.Misses = Misses;
+    Stats.Evictions = Evictions;
+    return Stats;
+}
+
+bool FHttpResponseCache::IsFull() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return TotalBytes >= FHttpBlueprintRuntimeSettings::Get().CacheMaxBytes;
+}
+
+FHttpResponseCache::FLifetime FHttpResponseCache::GetLifetime(const FHttpResponseData& Response)
+{
+    const FHttpBlueprintRuntimeSettings& Settings = FHttpBlueprintRuntimeSettings::Get();
+
+    FLifetime Lifetime;
+    Lifetime.bCacheable = true;
+    Lifetime.MaxAgeSeconds = Settings.CacheDefaultTtlSeconds;
+    Lifetime.StaleWhileRevalidateSeconds = Settings.CacheStaleWhileRevalidateSeconds;
+    Lifetime.StaleIfErrorSeconds = Settings.CacheStaleIfErrorSeconds;
+
+    const FString* CacheControl = Response.ResponseHeaders.Find(TEXT("Cache-Control"));
+    if (!CacheControl)
+    {
+        return Lifetime;
+    }
+
+    TArray<FString> Directives;
+    CacheControl->ParseIntoArray(Directives, TEXT(","));
+    for (FString& Directive : Directives)
+    {
+        Directive.TrimStartAndEndInline();
+
+        FString Name;
+        FString Value;
+        if (!Directive.Split(TEXT("="), &Name, &Value))
+        {
+            Name = Directive;
+        }
+
+        if (Name.Equals(TEXT("no-store"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("no-cache"), ESearchCase::IgnoreCase) ||
+            Name.Equals(TEXT("private"), ESearchCase::IgnoreCase))
+        {
+            Lifetime.bCacheable = false;
+        }
+        else if (Name.Equals(TEXT("max-age"), ESearchCase::IgnoreCase))
+        {
+            Lifetime.MaxAgeSeconds = FCString::Atod(*Value);
+        }
+        else if (Name.Equals(TEXT("stale-while-revalidate"), ESearchCase::IgnoreCase))
+        {
+            Lifetime.StaleWhileRevalidateSeconds = FCString::Atod(*Value);
+        }
+        else if (Name.Equals(TEXT("stale-if-error"), ESearchCase::IgnoreCase))
+        {
+            Lifetime.StaleIfErrorSeconds = FCString::Atod(*Value);
+        }
+    }
+    return Lifetime;
+}
+
+void FHttpResponseCache::EvictToFit(int64 MaxBytes, int64 Extra)
+{
+    // Few entries fit in a memory budget, so a linear scan for the oldest is cheap enough
+    while (Entries.Num() > 0 && TotalBytes + Extra > MaxBytes)
+    {
+        const FString* OldestKey = nullptr;
+        double OldestAccessTime = TNumericLimits<double>::Max();
+        for (const TPair<FString, FEntry>& Pair : Entries)
+        {
+            if (Pair.Value.LastAccessTime < OldestAccessTime)
+            {
+                OldestAccessTime = Pair.Value.LastAccessTime;
+                OldestKey = &Pair.Key;
+            }
+        }
+
+        RemoveEntry(FString(*OldestKey));
+        ++Evictions;
+    }
+}
+
+void FHttpResponseCache::RemoveEntry(const FString& Key)
+{
+    if (const FEntry* Entry = Entries.Find(Key))
+    {
+        TotalBytes -= Entry->Bytes;
+        FHttpMemoryTracker::AddCacheBytes(-Entry->Bytes);
+        Entries.Remove(Key);
+    }
+}
+
+int64 FHttpResponseCache::GetEntryBytes(const FString& Key, const FEntry& Entry)
+{
+    int64 Bytes = Key.GetAllocatedSize() + FHttpMemoryTracker::GetBodyBytes(Entry.Response) + FHttpMemoryTracker::GetHeaderBytes(Entry.Response);
+    for (const TPair<FString, FString>& Header : Entry.VaryHeaders)
+    {
+        Bytes += Header.Key.GetAllocatedSize() + Header.Value.GetAllocatedSize();
+    }
+    return Bytes;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+/**
+ * In-memory cache of successful GET responses, keyed by method and URL
+ *
+ * Only requests that opt in through FHttpRequestOptions::CachePolicy (prefetches among them) store
+ * and look up responses. A response with a Vary header only answers requests whose named headers
+ * have the values it was fetched with; responses to requests with an Authorization header, and
+ * Cache-Control private ones, are not stored. Entries are fresh for their Cache-Control max-age
+ * (HttpBlueprint.Cache.DefaultTtlSeconds without one), and may then still be served stale for
+ * their stale-while-revalidate and stale-if-error windows to requests that allow it. The least
+ * recently used entries are evicted beyond HttpBlueprint.Cache.MaxBytes. Cached bytes are
+ * reported to FHttpMemoryTracker. Safe on any thread.
+ */
+class FHttpResponseCache
+{
+public:
+
+    struct FCacheStats
+    {
+        int32 NumEntries = 0;
+        int64 Bytes = 0;
+        uint64 Hits = 0;
+        uint64 StaleHits = 0;
+        uint64 Misses = 0;
+        uint64 Evictions = 0;
+    };
+
+    /** How long a response may be served, from Cache-Control and the cache settings */
+    struct FLifetime
+    {
+        /** False for no-store, no-cache and private responses */
+        bool bCacheable = false;
+        double MaxAgeSeconds = 0.0;
+        double StaleWhileRevalidateSeconds = 0.0;
+        double StaleIfErrorSeconds = 0.0;
+    };
+
+    /** Which stale window, if any, a lookup may serve an expired entry from */
+    enum class EStaleWindow : uint8
+    {
+        None,
+        WhileRevalidate,
+        IfError
+    };
+
+    enum class ELookupResult : uint8
+    {
+        Miss,
+        Fresh,
+
+        /** Past its max-age but within the requested stale window; the response has bIsStale set */
+        Stale
+    };
+
+    /** Value of a header of the request a response answers (empty if it has none), matched against Vary */
+    using FRequestHeaderGetter = TFunctionRef<FString(const FString& /*Name*/)>;
+
+    static FHttpResponseCache& Get();
+
+    /** Whether responses to a method are cached */
+    static bool IsCacheableMethod(const FString& Method);
+
+    /**
+     * Copy out the response cached for a request
+     *
+     * @param GetRequestHeader - Headers of the request, for the cached response's Vary header
+     * @param AllowStale - Stale window an expired entry may still be served from
+     */
+    ELookupResult Find(const FString& Method, const FString& URL, FRequestHeaderGetter GetRequestHeader,
+        FHttpResponseData& OutResponse, EStaleWindow AllowStale = EStaleWindow::None);
+
+    /** Whether a fresh response is cached for a method and URL, whatever it varies on (not counted as a hit or miss) */
+    bool Contains(const FString& Method, const FString& URL) const;
+
+    /**
+     * Cache the response to a request, replacing any older one for its method and URL
+     *
+     * @param GetRequestHeader - Headers the request was sent with
+     * @return False if it cannot be cached (failed, not a GET, authorized request, Cache-Control no-store/no-cache/private,
+     *         Vary: *, caching disabled or larger than the budget)
+     */
+    bool Store(const FString& Method, const FString& URL, FRequestHeaderGetter GetRequestHeader, const FHttpResponseData& Response);
+
+    /**
+     * Refresh a cached response the server reported unchanged
+     * The 304's headers (Cache-Control, ETag, Last-Modified, ...) replace the stored ones, and the lifetime
+     * restarts from them; an entry the new headers make uncacheable is dropped.
+     *
+     * @param NotModified - The 304 response
+     */
+    void MarkRevalidated(const FString& Method, const FString& URL, const FHttpResponseData& NotModified);
+
+    /**
+     * Claim the background refresh of a cached response, so concurrent stale hits send a single request
+     *
+     * @return False if a refresh of it is already in flight
+     */
+    bool BeginRevalidation(const FString& Method, const FString& URL);
+
+    void EndRevalidation(const FString& Method, const FString& URL);
+
+    void Clear();
+
+    FCacheStats GetStats() const;
+
+    bool IsFull() const;
+
+    static FLifetime GetLifetime(const FHttpResponseData& Response);
+
+private:
+
+    FHttpResponseCache() = default;
+
+    struct FEntry
+    {
+        FHttpResponseData Response;
+
+        /** Request headers named by the response's Vary header, with the values it was fetched with */
+        TArray<TPair<FString, FString>> VaryHeaders;
+
+        FLifetime Lifetime;
+        double StoredTime = 0.0;
+        double LastAccessTime = 0.0;
+        int64 Bytes = 0;
+
+        bool IsFresh(double Now) const { return Now - StoredTime < Lifetime.MaxAgeSeconds; }
+        bool IsWithin(EStaleWindow Window, double Now) const;
+        bool MatchesVary(FRequestHeaderGetter GetRequestHeader) const;
+    };
+
+    static FString MakeKey(const FString& Method, const FString& URL);
+
+    /** Drop least recently used entries until Extra more bytes fit in MaxBytes (lock held) */
+    void EvictToFit(int64 MaxBytes, int64 Extra);
+
+    void RemoveEntry(const FString& Key);
+
+    static int64 GetEntryBytes(const FString& Key, const FEntry& Entry);
+
+    mutable FCriticalSection Lock;
+
+    /** Keyed by MakeKey */
+    TMap<FString, FEntry> Entries;
+    TSet<FString> Revalidating;
+    int64 TotalBytes = 0;
+    uint64 Hits = 0;
+    uint64 StaleHits = 0;
+    uint64 Misses = 0;
+    uint64 Evictions = 0;
+};
@@ -0,0 +1,422 @@
+#include "HttpResponsePipeline.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpBlueprintStats.h"
+#include "HttpMemoryTracker.h"
+#include "HttpPayloadCodec.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "JsonObjectConverter.h"
+#include "UObject/StructOnScope.h"
+#include "Tasks/Task.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+DEFINE_STAT(STAT_HttpPipelinesInFlight);
+DEFINE_STAT(STAT_HttpPipelinesWaiting);
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpResponsePipelineCommands
+{
+    static FAutoConsoleCommand StatsCommand(
+        TEXT("HttpBlueprint.Pipeline.Stats"),
+        TEXT("Print time spent in each response pipeline stage, most expensive first."),
+        FConsoleCommandDelegate::CreateStatic(&FHttpResponsePipeline::DumpStageStats));
+}
+
+// =============================================================================
+// SCHEDULING AND STAGE TIMING
+// =============================================================================
+
+namespace HttpResponsePipelineDetail
+{
+    struct FStageTiming
+    {
+        uint64 Runs = 0;
+        double TotalMs = 0.0;
+        double MaxMs = 0.0;
+    };
+
+    static FCriticalSection TimingLock;
+    static TMap<FName, FStageTiming> StageTimings;
+
+    /** Pipelines waiting for a free slot, oldest first */
+    static FCriticalSection SlotLock;
+    static TArray<TUniqueFunction<void()>> WaitingPipelines;
+    static int32 PipelinesInFlight = 0;
+
+    static void RecordStageTime(FName StageName, double ElapsedMs)
+    {
+        FScopeLock Lock(&TimingLock);
+        FStageTiming& Timing = StageTimings.FindOrAdd(StageName);
+        ++Timing.Runs;
+        Timing.TotalMs += ElapsedMs;
+        Timing.MaxMs = FMath::Max(Timing.MaxMs, ElapsedMs);
+    }
+
+    /** Start a pipeline now if a slot is free, otherwise queue it */
+    static void AcquireSlot(TUniqueFunction<void()>&& Start)
+    {
+        const int32 MaxInFlight = FMath::Max(1, FHttpBlueprintRuntimeSettings::Get().PipelineMaxInFlight);
+        {
+            FScopeLock Lock(&SlotLock);
+            if (PipelinesInFlight >= MaxInFlight)
+            {
+                WaitingPipelines.Add(MoveTemp(Start));
+                INC_DWORD_STAT(STAT_HttpPipelinesWaiting);
+                return;
+            }
+            ++PipelinesInFlight;
+            INC_DWORD_STAT(STAT_HttpPipelinesInFlight);
+        }
+
+        Start();
+    }
+
+    /** Hand a finished pipeline's slot to the oldest waiting pipeline */
+    static void ReleaseSlot()
+    {
+        TUniqueFunction<void()> Next;
+        {
+            FScopeLock Lock(&SlotLock);
+            if (WaitingPipelines.Num() == 0)
+            {
+                --PipelinesInFlight;
+                DEC_DWORD_STAT(STAT_HttpPipelinesInFlight);
+                return;
+            }
+            Next = MoveTemp(WaitingPipelines[0]);
+            WaitingPipelines.RemoveAt(0, 1, EAllowShrinking::No);
+            DEC_DWORD_STAT(STAT_HttpPipelinesWaiting);
+        }
+
+        Next();
+    }
+
+    static void SetBodyString(FHttpResponseData& Response, const TArray<uint8>& Body)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+        Response.ResponseBody = FString(Converted.Length(), Converted.Get());
+    }
+
+    /**
+     * Gzip (1F 8B) or zlib (CMF/FLG checksum) header
+     * Only a hint: about one in 31 bodies starting with an 8/x8 byte also passes the zlib check
+     */
+    static bool LooksCompressed(const TArray<uint8>& Body)
+    {
+        if (Body.Num() < 2)
+        {
+            return false;
+        }
+        const bool bGzip = Body[0] == 0x1F && Body[1] == 0x8B;
+        const bool bZlib = (Body[0] & 0x0F) == 8 && ((Body[0] << 8) | Body[1]) % 31 == 0;
+        return bGzip || bZlib;
+    }
+
+    static bool Inflate(const TArray<uint8>& Compressed, TArray<uint8>& OutBody)
+    {
+        z_stream Stream;
+        FMemory::Memzero(Stream);
+
+        // 15 window bits + 32 detects gzip and zlib headers automatically
+        if (inflateInit2(&Stream, 15 + 32) != Z_OK)
+        {
+            return false;
+        }
+
+        Stream.next_in = const_cast<Bytef*>(Compressed.GetData());
+        Stream.avail_in = (uInt)Compressed.Num();
+
+        constexpr int32 ChunkSize = 64 * 1024;
+        OutBody.Reset(Compressed.Num() * 4);
+
+        int Result = Z_OK;
+        while (Result == Z_OK)
+        {
+            const int32 Offset = OutBody.Num();
+            OutBody.AddUninitialized(ChunkSize);
+            Stream.next_out = OutBody.GetData() + Offset;
+            Stream.avail_out = ChunkSize;
+
+            Result = inflate(&Stream, Z_NO_FLUSH);
+            OutBody.SetNum(Offset + ChunkSize - (int32)Stream.avail_out, EAllowShrinking::No);
+        }
+
+        inflateEnd(&Stream);
+        return Result == Z_STREAM_END;
+    }
+}
+
+// =============================================================================
+// BUILT-IN STAGES
+// =============================================================================
+
+FHttpResponsePipeline& FHttpResponsePipeline::Decompress()
+{
+    return Then(TEXT("Decompress"), [](FHttpPipelineContext& Context)
+        {
+            TArray<uint8>& Body = Context.Output->Body;
+
+            // Content-Encoding decides; HTTP backends that inflate on their own keep the header, so the
+            // body is still checked. Without the header, a body that only looks compressed is left as is.
+            const FString* Encoding = Context.Response.ResponseHeaders.Find(TEXT("Content-Encoding"));
+            const bool bDeclared = Encoding && (Encoding->Equals(TEXT("gzip"), ESearchCase::IgnoreCase) ||
+                Encoding->Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase) || Encoding->Equals(TEXT("deflate"), ESearchCase::IgnoreCase));
+            if ((Encoding && !bDeclared) || !HttpResponsePipelineDetail::LooksCompressed(Body))
+            {
+                return true;
+            }
+
+            TArray<uint8> Inflated;
+            if (!HttpResponsePipelineDetail::Inflate(Body, Inflated))
+            {
+                if (!bDeclared)
+                {
+                    return true;
+                }
+                Context.Response.SetError(EHttpErrorKind::DecodeError);
+                Context.Response.ErrorMessage = TEXT("Could not decompress response body");
+                return false;
+            }
+
+            Body = MoveTemp(Inflated);
+            HttpResponsePipelineDetail::SetBodyString(Context.Response, Body);
+            return true;
+        });
+}
+
+FHttpResponsePipeline& FHttpResponsePipeline::ValidateStatus(int64 MaxBodyBytes)
+{
+    return Then(TEXT("Validate"), [MaxBodyBytes](FHttpPipelineContext& Context)
+        {
+            // ErrorKind already describes status failures (FHttpResponseData::GetErrorMessage)
+            if (!UHttpBlueprintFunctionLibrary::IsHttpResponseSuccessful(Context.Response.ResponseCode))
+            {
+                return false;
+            }
+
+            if (MaxBodyBytes > 0 && Context.Output->Body.Num() > MaxBodyBytes)
+            {
+                Context.Response.SetError(EHttpErrorKind::BodyTooLarge, Context.Output->Body.Num(), MaxBodyBytes);
+                return false;
+            }
+            return true;
+        });
+}
+
+FHttpResponsePipeline& FHttpResponsePipeline::DecodeJson()
+{
+    return Then(TEXT("DecodeJson"), [](FHttpPipelineContext& Context)
+        {
+            // MessagePack and CBOR bodies decode into the same value tree
+            const EHttpPayloadFormat Format = FHttpPayloadCodec::GetResponseFormat(Context.Response);
+            if (Format != EHttpPayloadFormat::Json)
+            {
+                FString Error;
+                Context.Output->Json = FHttpPayloadCodec::Decode(Format, Context.Output->Body, Error);
+                if (!Context.Output->Json.IsValid())
+                {
+                    Context.Response.SetError(EHttpErrorKind::DecodeError);
+                    Context.Response.ErrorMessage = FString::Printf(TEXT("Response is not valid %s: %s"), FHttpPayloadCodec::GetContentType(Format), *Error);
+                    return false;
+                }
+                return true;
+            }
+
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Context.Response.ResponseBody);
+            if (!FJsonSerializer::Deserialize(Reader, Context.Output->Json) || !Context.Output->Json.IsValid())
+            {
+                Context.Response.SetError(EHttpErrorKind::DecodeError);
+                Context.Response.ErrorMessage = FString::Printf(TEXT("Response is not valid JSON: %s"), *Reader->GetErrorMessage());
+                return false;
+            }
+            return true;
+        });
+}
+
+FHttpResponsePipeline& FHttpResponsePipeline::ToStruct(const UScriptStruct* StructType)
+{
+    check(StructType);
+
+    // Native USTRUCTs are never garbage collected, so holding the raw pointer is safe
+    return Then(TEXT("ToStruct"), [StructType](FHttpPipelineContext& Context)
+        {
+            TSharedRef<FStructOnScope> Struct = MakeShared<FStructOnScope>(StructType);
+
+            const EHttpPayloadFormat Format = FHttpPayloadCodec::GetResponseFormat(Context.Response);
+            if (!Context.Output->Json.IsValid() && Format != EHttpPayloadFormat::Json)
+            {
+                FString Error;
+                if (!FHttpPayloadCodec::DecodeStruct(Format, Context.Output->Body, StructType, Struct->GetStructMemory(), Error))
+                {
+                    Context.Response.SetError(EHttpErrorKind::DecodeError);
+                    Context.Response.ErrorMessage = FString::Printf(TEXT("Response cannot be read as %s: %s"), *StructType->GetName(), *Error);
+                    return false;
+                }
+                Context.Output->Struct = Struct;
+                return true;
+            }
+
+            // Without a decoded tree, read the body directly through the compiled field map
+            if (!Context.Output->Json.IsValid())
+            {
+                FString Error;
+                if (!FHttpStructDeserializer::ReadStruct(StructType, Context.Output->Body, Struct->GetStructMemory(), Error))
+                {
+                    Context.Response.SetError(EHttpErrorKind::DecodeError);
+                    Context.Response.ErrorMessage = FString::Printf(TEXT("Response cannot be read as %s: %s"), *StructType->GetName(), *Error);
+                    return false;
+                }
+                Context.Output->Struct = Struct;
+                return true;
+            }
+
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (!Context.Output->Json->TryGetObject(Object))
+            {
+                Context.Response.SetError(EHttpErrorKind::DecodeError);
+                Context.Response.ErrorMessage = FString::Printf(TEXT("Response is not a JSON object and cannot be read as %s"), *StructType->GetName());
+                return false;
+            }
+
+            if (!FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), StructType, Struct->GetStructMemory()))
+            {
+                Context.Response.SetError(EHttpErrorKind::DecodeError);
+                Context.Response.ErrorMessage = FString::Printf(TEXT("Response does not match %s"), *StructType->GetName());
+                return false;
+            }
+
+            Context.Output->Struct = Struct;
+            return true;
+        });
+}
+
+FHttpResponsePipeline& FHttpResponsePipeline::Then(FName StageName, FStageFunction&& Stage)
+{
+    Stages.Add({ StageName, MoveTemp(Stage) });
+    return *this;
+}
+
+// =============================================================================
+// EXECUTION
+// =============================================================================
+
+void FHttpResponsePipeline::Run(const FHttpResponseData& ResponseData, TArray<uint8>&& RawBody,
+    TUniqueFunction<void(const FHttpResponseData&)>&& OnFinished) const
+{
+    TSharedRef<FHttpPipelineContext> Context = MakeShared<FHttpPipelineContext>();
+    Context->Response = ResponseData;
+    Context->Output->Body = MoveTemp(RawBody);
+
+    if (Context->Output->Body.Num() == 0 && !ResponseData.ResponseBody.IsEmpty())
+    {
+        FTCHARToUTF8 Utf8Body(*ResponseData.ResponseBody);
+        Context->Output->Body.Append(reinterpret_cast<const uint8*>(Utf8Body.Get()), Utf8Body.Length());
+    }
+
+    HttpResponsePipelineDetail::AcquireSlot(
+        [Pipeline = AsShared(), Context, OnFinished = MoveTemp(OnFinished)]() mutable
+        {
+            Pipeline->LaunchStages(Context, MoveTemp(OnFinished));
+        });
+}
+
+void FHttpResponsePipeline::LaunchStages(const TSharedRef<FHttpPipelineContext>& Context,
+    TUniqueFunction<void(const FHttpResponseData&)>&& OnFinished) const
+{
+    TSharedRef<const FHttpResponsePipeline> Pipeline = AsShared();
+
+    UE::Tasks::FTask Previous;
+    for (int32 StageIndex = 0; StageIndex < Stages.Num(); ++StageIndex)
+    {
+        auto RunStage = [Pipeline, Context, StageIndex]()
+            {
+                if (Context->bFailed)
+                {
+                    return;
+                }
+
+                const FStage& Stage = Pipeline->Stages[StageIndex];
+                TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Stage.Name.ToString());
+                LLM_SCOPE_BYTAG(HttpBlueprintAPI);
+
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                const bool bSucceeded = Stage.Function(*Context);
+                const double ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+                Context->Output->StageTimesMs.Emplace(Stage.Name, ElapsedMs);
+                HttpResponsePipelineDetail::RecordStageTime(Stage.Name, ElapsedMs);
+
+                if (!bSucceeded)
+                {
+                    Context->bFailed = true;
+                    Context->Response.bWasSuccessful = false;
+                    // Built-in stages and HTTP status failures have already set the kind
+                    if (Context->Response.ErrorKind == EHttpErrorKind::None)
+                    {
+                        Context->Response.ErrorKind = EHttpErrorKind::PipelineStageFailed;
+                        if (Context->Response.ErrorMessage.IsEmpty())
+                        {
+                            Context->Response.ErrorMessage = FString::Printf(TEXT("Response pipeline stage '%s' failed"), *Stage.Name.ToString());
+                        }
+                    }
+                }
+            };
+
+        Previous = Previous.IsValid()
+            ? UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(RunStage), UE::Tasks::Prerequisites(Previous))
+            : UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(RunStage));
+    }
+
+    auto Finish = [Context, OnFinished = MoveTemp(OnFinished)]()
+        {
+            Context->Response.PipelineOutput = Context->Output;
+            OnFinished(Context->Response);
+            HttpResponsePipelineDetail::ReleaseSlot();
+        };
+
+    if (Previous.IsValid())
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Finish), UE::Tasks::Prerequisites(Previous));
+    }
+    else
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Finish));
+    }
+}
+
+void FHttpResponsePipeline::DumpStageStats()
+{
+    TArray<TPair<FName, HttpResponsePipelineDetail::FStageTiming>> Timings;
+    {
+        FScopeLock Lock(&HttpResponsePipelineDetail::TimingLock);
+        Timings = HttpResponsePipelineDetail::StageTimings.Array();
+    }
+
+    Timings.Sort([](const auto& A, const auto& B)
+        {
+            return A.Value.TotalMs > B.Value.TotalMs;
+        });
+
+    UE_LOG(LogHttpBlueprintAPI, Display, TEXT("HTTP response pipeline stages (%d):"), Timings.Num());
+    for (const auto& Pair : Timings)
+    {
+        UE_LOG(LogHttpBlueprintAPI, Display, TEXT("  %-16s runs %8llu  total %10.2f ms  avg %8.3f ms  max %8.3f ms"),
+            *Pair.Key.ToString(),
+            Pair.Value.Runs,
+            Pair.Value.TotalMs,
+            Pair.Value.Runs > 0 ? Pair.Value.TotalMs / Pair.Value.Runs : 0.0,
+            Pair.Value.MaxMs);
+    }
+}
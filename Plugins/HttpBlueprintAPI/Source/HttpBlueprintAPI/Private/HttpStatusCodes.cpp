@@ -0,0 +1,184 @@
+#include "HttpStatusCodes.h"
+
+// =============================================================================
+// REGISTRY
+// =============================================================================
+
+namespace HttpStatusCodesDetail
+{
+    struct FStatusEntry
+    {
+        int32 Code;
+        const TCHAR* Reason;
+    };
+
+    /** IANA HTTP Status Code Registry (RFC 9110 and extensions); unassigned and "(Unused)" codes are left out */
+    static constexpr FStatusEntry Registry[] =
+    {
+        { 100, TEXT("Continue") },
+        { 101, TEXT("Switching Protocols") },
+        { 102, TEXT("Processing") },
+        { 103, TEXT("Early Hints") },
+
+        { 200, TEXT("OK") },
+        { 201, TEXT("Created") },
+        { 202, TEXT("Accepted") },
+        { 203, TEXT("Non-Authoritative Information") },
+        { 204, TEXT("No Content") },
+        { 205, TEXT("Reset Content") },
+        { 206, TEXT("Partial Content") },
+        { 207, TEXT("Multi-Status") },
+        { 208, TEXT("Already Reported") },
+        { 226, TEXT("IM Used") },
+
+        { 300, TEXT("Multiple Choices") },
+        { 301, TEXT("Moved Permanently") },
+        { 302, TEXT("Found") },
+        { 303, TEXT("See Other") },
+        { 304, TEXT("Not Modified") },
+        { 305, TEXT("Use Proxy") },
+        { 307, TEXT("Temporary Redirect") },
+        { 308, TEXT("Permanent Redirect") },
+
+        { 400, TEXT("Bad Request") },
+        { 401, TEXT("Unauthorized") },
+        { 402, TEXT("Payment Required") },
+        { 403, TEXT("Forbidden") },
+        { 404, TEXT("Not Found") },
+        { 405, TEXT("Method Not Allowed") },
+        { 406, TEXT("Not Acceptable") },
+        { 407, TEXT("Proxy Authentication Required") },
+        { 408, TEXT("Request Timeout") },
+        { 409, TEXT("Conflict") },
+        { 410, TEXT("Gone") },
+        { 411, TEXT("Length Required") },
+        { 412, TEXT("Precondition Failed") },
+        { 413, TEXT("Content Too Large") },
+        { 414, TEXT("URI Too Long") },
+        { 415, TEXT("Unsupported Media Type") },
+        { 416, TEXT("Range Not Satisfiable") },
+        { 417, TEXT("Expectation Failed") },
+        { 421, TEXT("Misdirected Request") },
+        { 422, TEXT("Unprocessable Content") },
+        { 423, TEXT("Locked") },
+        { 424, TEXT("Failed Dependency") },
+        { 425, TEXT("Too Early") },
+        { 426, TEXT("Upgrade Required") },
+        { 428, TEXT("Precondition Required") },
+        { 429, TEXT("Too Many Requests") },
+        { 431, TEXT("Request Header Fields Too Large") },
+        { 451, TEXT("Unavailable For Legal Reasons") },
+
+        { 500, TEXT("Internal Server Error") },
+        { 501, TEXT("Not Implemented") },
+        { 502, TEXT("Bad Gateway") },
+        { 503, TEXT("Service Unavailable") },
+        { 504, TEXT("Gateway Timeout") },
+        { 505, TEXT("HTTP Version Not Supported") },
+        { 506, TEXT("Variant Also Negotiates") },
+        { 507, TEXT("Insufficient Storage") },
+        { 508, TEXT("Loop Detected") },
+        { 510, TEXT("Not Extended") },
+        { 511, TEXT("Network Authentication Required") },
+    };
+
+    constexpr int32 NumCodes = FHttpStatusCodes::MaxCode - FHttpStatusCodes::MinCode + 1;
+
+    constexpr int32 LengthOf(const TCHAR* Text)
+    {
+        int32 Length = 0;
+        while (Text[Length] != 0)
+        {
+            ++Length;
+        }
+        return Length;
+    }
+
+    /** Reason phrases indexed by Code - MinCode */
+    struct FReasonTable
+    {
+        FStringView Reasons[NumCodes];
+    };
+
+    constexpr FReasonTable MakeReasonTable()
+    {
+        FReasonTable Table;
+        for (const FStatusEntry& Entry : Registry)
+        {
+            Table.Reasons[Entry.Code - FHttpStatusCodes::MinCode] = FStringView(Entry.Reason, LengthOf(Entry.Reason));
+        }
+        return Table;
+    }
+
+    static constexpr FReasonTable ReasonTable = MakeReasonTable();
+
+    static_assert(ReasonTable.Reasons[404 - FHttpStatusCodes::MinCode].Len() == 9, "Reason table must be built at compile time");
+
+    constexpr bool IsInRange(int32 Code)
+    {
+        return Code >= FHttpStatusCodes::MinCode && Code <= FHttpStatusCodes::MaxCode;
+    }
+
+    /** Names and texts for every code in range, built once on first use */
+    struct FInternedDescriptions
+    {
+        FName Names[NumCodes];
+        FText Texts[NumCodes];
+
+        FInternedDescriptions()
+        {
+            for (int32 Index = 0; Index < NumCodes; ++Index)
+            {
+                const FStringView Reason = ReasonTable.Reasons[Index];
+                if (Reason.IsEmpty())
+                {
+                    Texts[Index] = FText::AsCultureInvariant(FString::Printf(TEXT("HTTP %d"), FHttpStatusCodes::MinCode + Index));
+                }
+                else
+                {
+                    Names[Index] = FName(Reason.Len(), Reason.GetData());
+                    Texts[Index] = FText::AsCultureInvariant(FString(Reason));
+                }
+            }
+        }
+    };
+
+    static const FInternedDescriptions& GetInterned()
+    {
+        static const FInternedDescriptions Interned;
+        return Interned;
+    }
+}
+
+// =============================================================================
+// STATUS CODES
+// =============================================================================
+
+FStringView FHttpStatusCodes::GetReasonPhrase(int32 Code)
+{
+    return HttpStatusCodesDetail::IsInRange(Code) ? HttpStatusCodesDetail::ReasonTable.Reasons[Code - MinCode] : FStringView();
+}
+
+FName FHttpStatusCodes::GetReasonName(int32 Code)
+{
+    return HttpStatusCodesDetail::IsInRange(Code) ? HttpStatusCodesDetail::GetInterned().Names[Code - MinCode] : NAME_None;
+}
+
+FText FHttpStatusCodes::GetDescription(int32 Code)
+{
+    if (HttpStatusCodesDetail::IsInRange(Code))
+    {
+        return HttpStatusCodesDetail::GetInterned().Texts[Code - MinCode];
+    }
+    return FText::AsCultureInvariant(FString::Printf(TEXT("HTTP %d"), Code));
+}
+
+FString FHttpStatusCodes::FormatError(int32 Code)
+{
+    const FStringView Reason = GetReasonPhrase(Code);
+    if (Reason.IsEmpty())
+    {
+        return FString::Printf(TEXT("HTTP Error %d: HTTP %d"), Code, Code);
+    }
+    return FString::Printf(TEXT("HTTP Error %d: %.*s"), Code, Reason.Len(), Reason.GetData());
+}
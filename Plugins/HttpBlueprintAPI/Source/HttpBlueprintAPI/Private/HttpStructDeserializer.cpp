@@ -0,0 +1,995 @@
+#include "HttpStructDeserializer.h"
+#include "HttpBlueprintAPI.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "JsonObjectConverter.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+
+// =============================================================================
+// FIELD MAPS
+// =============================================================================
+
+namespace HttpStructDeserializerDetail
+{
+    /** How a property is written, decided once when the field map is compiled */
+    enum class EFieldKind : uint8
+    {
+        Bool,
+        Numeric,
+        Enum,
+        String,
+        Name,
+        Text,
+        Struct,
+        Array,
+        Other
+    };
+
+    struct FFieldEntry
+    {
+        uint32 Hash = 0;
+
+        /** ASCII-lowercased UTF-8 property name */
+        TArray<uint8> LowerKey;
+
+        const FProperty* Property = nullptr;
+        EFieldKind Kind = EFieldKind::Other;
+    };
+
+    struct FFieldMap
+    {
+        /** Sorted by Hash */
+        TArray<FFieldEntry> Entries;
+
+        /** C++ structs keep their properties until reinstanced; user-defined ones can be collected */
+        bool bNative = false;
+
+        const FFieldEntry* Find(uint32 Hash, const uint8* Key, int32 KeyLength) const;
+    };
+
+    static FORCEINLINE uint8 ToLowerAscii(uint8 C)
+    {
+        return (C >= 'A' && C <= 'Z') ? C + ('a' - 'A') : C;
+    }
+
+    /** FNV-1a over the ASCII-lowercased bytes, so matching is case-insensitive like FJsonObject */
+    static uint32 HashKey(const uint8* Key, int32 KeyLength)
+    {
+        uint32 Hash = 2166136261u;
+        for (int32 Index = 0; Index < KeyLength; ++Index)
+        {
+            Hash = (Hash ^ ToLowerAscii(Key[Index])) * 16777619u;
+        }
+        return Hash;
+    }
+
+    const FFieldEntry* FFieldMap::Find(uint32 Hash, const uint8* Key, int32 KeyLength) const
+    {
+        int32 Index = Algo::LowerBoundBy(Entries, Hash, &FFieldEntry::Hash);
+        for (; Index < Entries.Num() && Entries[Index].Hash == Hash; ++Index)
+        {
+            const FFieldEntry& Entry = Entries[Index];
+            if (Entry.LowerKey.Num() != KeyLength)
+            {
+                continue;
+            }
+
+            int32 Char = 0;
+            while (Char < KeyLength && ToLowerAscii(Key[Char]) == Entry.LowerKey[Char])
+            {
+                ++Char;
+            }
+            if (Char == KeyLength)
+            {
+                return &Entry;
+            }
+        }
+        return nullptr;
+    }
+
+    static EFieldKind ClassifyProperty(const FProperty* Property)
+    {
+        if (Property->ArrayDim != 1)
+        {
+            return EFieldKind::Other;
+        }
+        if (Property->IsA<FBoolProperty>())
+        {
+            return EFieldKind::Bool;
+        }
+        if (Property->IsA<FEnumProperty>())
+        {
+            return EFieldKind::Enum;
+        }
+        if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+        {
+            return ByteProperty->Enum ? EFieldKind::Enum : EFieldKind::Numeric;
+        }
+        if (Property->IsA<FNumericProperty>())
+        {
+            return EFieldKind::Numeric;
+        }
+        if (Property->IsA<FStrProperty>())
+        {
+            return EFieldKind::String;
+        }
+        if (Property->IsA<FNameProperty>())
+        {
+            return EFieldKind::Name;
+        }
+        if (Property->IsA<FTextProperty>())
+        {
+            return EFieldKind::Text;
+        }
+        if (Property->IsA<FStructProperty>())
+        {
+            return EFieldKind::Struct;
+        }
+        if (Property->IsA<FArrayProperty>())
+        {
+            return EFieldKind::Array;
+        }
+        return EFieldKind::Other;
+    }
+
+    using FFieldMapRef = TSharedRef<const FFieldMap, ESPMode::ThreadSafe>;
+
+    static FFieldMapRef CompileFieldMap(const UScriptStruct* StructType)
+    {
+        TSharedRef<FFieldMap, ESPMode::ThreadSafe> Map = MakeShared<FFieldMap, ESPMode::ThreadSafe>();
+        Map->bNative = (StructType->StructFlags & STRUCT_Native) != 0;
+        for (TFieldIterator<FProperty> It(StructType); It; ++It)
+        {
+            FFieldEntry& Entry = Map->Entries.AddDefaulted_GetRef();
+            Entry.Property = *It;
+            Entry.Kind = ClassifyProperty(*It);
+
+            // The JSON name FJsonObjectConverter uses (user-defined structs' property names carry a GUID suffix)
+            FTCHARToUTF8 Name(*FJsonObjectConverter::StandardizeCase(It->GetAuthoredName()));
+            Entry.LowerKey.SetNumUninitialized(Name.Length());
+            for (int32 Index = 0; Index < Name.Length(); ++Index)
+            {
+                Entry.LowerKey[Index] = ToLowerAscii((uint8)Name.Get()[Index]);
+            }
+            Entry.Hash = HashKey(Entry.LowerKey.GetData(), Entry.LowerKey.Num());
+        }
+
+        Map->Entries.Sort([](const FFieldEntry& A, const FFieldEntry& B)
+            {
+                return A.Hash < B.Hash;
+            });
+        return Map;
+    }
+
+    /**
+     * Shared, so ClearFieldMapCache can drop tables a read on another thread is still using
+     * Keyed by FObjectKey: a struct allocated where a collected one used to be gets a new key, not its table.
+     */
+    static FRWLock FieldMapLock;
+    static TMap<FObjectKey, TSharedPtr<const FFieldMap, ESPMode::ThreadSafe>> FieldMaps;
+
+    static FDelegateHandle ObjectsReplacedHandle;
+    static FDelegateHandle PreGarbageCollectHandle;
+
+    /** Reinstancing (hot reload, Live Coding, Blueprint struct edits) can change any struct's properties */
+    static void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects)
+    {
+        FHttpStructDeserializer::ClearFieldMapCache();
+    }
+
+    /** The tables point at FProperty objects a collected user-defined struct takes with it */
+    static void OnPreGarbageCollect()
+    {
+        FWriteScopeLock Lock(FieldMapLock);
+        for (auto It = FieldMaps.CreateIterator(); It; ++It)
+        {
+            if (!It.Value()->bNative)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    /** The returned reference keeps the table alive for the read that uses it */
+    static FFieldMapRef GetFieldMap(const UScriptStruct* StructType)
+    {
+        {
+            FReadScopeLock Lock(FieldMapLock);
+            if (const TSharedPtr<const FFieldMap, ESPMode::ThreadSafe>* Found = FieldMaps.Find(FObjectKey(StructType)))
+            {
+                return Found->ToSharedRef();
+            }
+        }
+
+        FFieldMapRef Compiled = CompileFieldMap(StructType);
+
+        FWriteScopeLock Lock(FieldMapLock);
+        TSharedPtr<const FFieldMap, ESPMode::ThreadSafe>& Slot = FieldMaps.FindOrAdd(FObjectKey(StructType));
+        if (!Slot.IsValid())
+        {
+            Slot = Compiled;
+        }
+        return Slot.ToSharedRef();
+    }
+
+    // =============================================================================
+    // UTF-8 JSON CURSOR
+    // =============================================================================
+
+    struct FJsonNumber
+    {
+        double Value = 0.0;
+        int64 Int = 0;
+        uint64 UInt = 0;
+        bool bInteger = false;
+        bool bNegative = false;
+    };
+
+    /** Forward-only reader over UTF-8 JSON; never allocates except for string values */
+    class FJsonCursor
+    {
+    public:
+
+        static constexpr int32 MaxDepth = 256;
+
+        explicit FJsonCursor(TArrayView<const uint8> Json)
+            : Begin(Json.GetData())
+            , Cur(Json.GetData())
+            , End(Json.GetData() + Json.Num())
+        {
+        }
+
+        FString Error;
+
+        FORCEINLINE uint8 Peek()
+        {
+            while (Cur < End && (*Cur == ' ' || *Cur == '\t' || *Cur == '\n' || *Cur == '\r'))
+            {
+                ++Cur;
+            }
+            return Cur < End ? *Cur : 0;
+        }
+
+        FORCEINLINE bool Consume(uint8 Char)
+        {
+            if (Peek() == Char)
+            {
+                ++Cur;
+                return true;
+            }
+            return false;
+        }
+
+        bool Expect(uint8 Char)
+        {
+            return Consume(Char) || Fail(*FString::Printf(TEXT("Expected '%c'"), (TCHAR)Char));
+        }
+
+        bool Fail(const TCHAR* Message)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = FString::Printf(TEXT("%s at byte %d"), Message, (int32)(Cur - Begin));
+            }
+            return false;
+        }
+
+        bool AtEnd()
+        {
+            return Peek() == 0 && Cur == End;
+        }
+
+        const uint8* GetPosition() const { return Cur; }
+
+        /** Find the raw (still escaped) bytes of a string without decoding it */
+        bool ScanString(const uint8*& OutBegin, const uint8*& OutEnd, bool& bOutEscaped)
+        {
+            if (Peek() != '"')
+            {
+                return Fail(TEXT("Expected string"));
+            }
+
+            OutBegin = ++Cur;
+            bOutEscaped = false;
+            while (Cur < End)
+            {
+                if (*Cur == '"')
+                {
+                    OutEnd = Cur++;
+                    return true;
+                }
+                if (*Cur == '\\')
+                {
+                    bOutEscaped = true;
+                    Cur = FMath::Min(Cur + 2, End);
+                    continue;
+                }
+                ++Cur;
+            }
+            return Fail(TEXT("Unterminated string"));
+        }
+
+        static void AppendUtf8(TArray<uint8>& Out, uint32 CodePoint)
+        {
+            if (CodePoint < 0x80)
+            {
+                Out.Add((uint8)CodePoint);
+            }
+            else if (CodePoint < 0x800)
+            {
+                Out.Add((uint8)(0xC0 | (CodePoint >> 6)));
+                Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+            }
+            else if (CodePoint < 0x10000)
+            {
+                Out.Add((uint8)(0xE0 | (CodePoint >> 12)));
+                Out.Add((uint8)(0x80 | ((CodePoint >> 6) & 0x3F)));
+                Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+            }
+            else
+            {
+                Out.Add((uint8)(0xF0 | (CodePoint >> 18)));
+                Out.Add((uint8)(0x80 | ((CodePoint >> 12) & 0x3F)));
+                Out.Add((uint8)(0x80 | ((CodePoint >> 6) & 0x3F)));
+                Out.Add((uint8)(0x80 | (CodePoint & 0x3F)));
+            }
+        }
+
+        static bool ParseHex4(const uint8* Text, const uint8* TextEnd, uint32& OutValue)
+        {
+            if (TextEnd - Text < 4)
+            {
+                return false;
+            }
+            OutValue = 0;
+            for (int32 Index = 0; Index < 4; ++Index)
+            {
+                const uint8 C = Text[Index];
+                const uint32 Digit = (C >= '0' && C <= '9') ? C - '0'
+                    : (C >= 'a' && C <= 'f') ? C - 'a' + 10
+                    : (C >= 'A' && C <= 'F') ? C - 'A' + 10
+                    : 16;
+                if (Digit > 15)
+                {
+                    return false;
+                }
+                OutValue = (OutValue << 4) | Digit;
+            }
+            return true;
+        }
+
+        /** Decode escape sequences into UTF-8 */
+        static bool Unescape(const uint8* Text, const uint8* TextEnd, TArray<uint8>& Out)
+        {
+            Out.Reset(TextEnd - Text);
+            while (Text < TextEnd)
+            {
+                if (*Text != '\\')
+                {
+                    Out.Add(*Text++);
+                    continue;
+                }
+
+                if (++Text >= TextEnd)
+                {
+                    return false;
+                }
+
+                switch (*Text++)
+                {
+                case '"':  Out.Add('"'); break;
+                case '\\': Out.Add('\\'); break;
+                case '/':  Out.Add('/'); break;
+                case 'b':  Out.Add('\b'); break;
+                case 'f':  Out.Add('\f'); break;
+                case 'n':  Out.Add('\n'); break;
+                case 'r':  Out.Add('\r'); break;
+                case 't':  Out.Add('\t'); break;
+                case 'u':
+                {
+                    uint32 CodePoint = 0;
+                    if (!ParseHex4(Text, TextEnd, CodePoint))
+                    {
+                        return false;
+                    }
+                    Text += 4;
+
+                    // Surrogate pair
+                    uint32 Low = 0;
+                    if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && TextEnd - Text >= 6 &&
+                        Text[0] == '\\' && Text[1] == 'u' && ParseHex4(Text + 2, TextEnd, Low) && Low >= 0xDC00 && Low <= 0xDFFF)
+                    {
+                        CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                        Text += 6;
+                    }
+                    AppendUtf8(Out, CodePoint);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static FString ToFString(const uint8* Text, int32 Length)
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text), Length);
+            return FString(Converted.Length(), Converted.Get());
+        }
+
+        bool ReadString(FString& OutValue)
+        {
+            const uint8* StringBegin = nullptr;
+            const uint8* StringEnd = nullptr;
+            bool bEscaped = false;
+            if (!ScanString(StringBegin, StringEnd, bEscaped))
+            {
+                return false;
+            }
+
+            if (!bEscaped)
+            {
+                OutValue = ToFString(StringBegin, StringEnd - StringBegin);
+                return true;
+            }
+
+            TArray<uint8> Unescaped;
+            if (!Unescape(StringBegin, StringEnd, Unescaped))
+            {
+                return Fail(TEXT("Invalid escape sequence"));
+            }
+            OutValue = ToFString(Unescaped.GetData(), Unescaped.Num());
+            return true;
+        }
+
+        bool ReadNumber(FJsonNumber& OutNumber)
+        {
+            Peek();
+            const uint8* NumberBegin = Cur;
+
+            OutNumber.bNegative = Cur < End && *Cur == '-';
+            if (OutNumber.bNegative)
+            {
+                ++Cur;
+            }
+
+            uint64 Accumulator = 0;
+            bool bOverflow = false;
+            const uint8* DigitsBegin = Cur;
+            while (Cur < End && *Cur >= '0' && *Cur <= '9')
+            {
+                const uint64 Digit = *Cur++ - '0';
+                bOverflow |= Accumulator > (MAX_uint64 - Digit) / 10;
+                Accumulator = Accumulator * 10 + Digit;
+            }
+            if (Cur == DigitsBegin)
+            {
+                return Fail(TEXT("Expected value"));
+            }
+
+            const bool bFraction = Cur < End && (*Cur == '.' || *Cur == 'e' || *Cur == 'E');
+            while (Cur < End && ((*Cur >= '0' && *Cur <= '9') || *Cur == '.' || *Cur == 'e' || *Cur == 'E' || *Cur == '+' || *Cur == '-'))
+            {
+                ++Cur;
+            }
+
+            const uint64 MaxMagnitude = OutNumber.bNegative ? (uint64)MAX_int64 + 1 : MAX_uint64;
+            if (!bFraction && !bOverflow && Accumulator <= MaxMagnitude)
+            {
+                OutNumber.bInteger = true;
+                OutNumber.UInt = Accumulator;
+                OutNumber.Int = OutNumber.bNegative ? (int64)(0 - Accumulator) : (int64)Accumulator;
+                OutNumber.Value = OutNumber.bNegative ? -(double)Accumulator : (double)Accumulator;
+                return true;
+            }
+
+            // Fractions, exponents and huge integers go through the C runtime parser
+            ANSICHAR Buffer[64];
+            const int32 Length = (int32)(Cur - NumberBegin);
+            if (Length >= UE_ARRAY_COUNT(Buffer))
+            {
+                return Fail(TEXT("Number too long"));
+            }
+            FMemory::Memcpy(Buffer, NumberBegin, Length);
+            Buffer[Length] = '\0';
+
+            OutNumber.bInteger = false;
+            OutNumber.Value = FCStringAnsi::Atod(Buffer);
+            OutNumber.Int = (int64)OutNumber.Value;
+            OutNumber.UInt = (uint64)FMath::Max(OutNumber.Value, 0.0);
+            return true;
+        }
+
+        bool ReadLiteral(const char* Word)
+        {
+            Peek();
+            const int32 Length = (int32)FCStringAnsi::Strlen(Word);
+            if (End - Cur < Length || FMemory::Memcmp(Cur, Word, Length) != 0)
+            {
+                return Fail(TEXT("Invalid literal"));
+            }
+            Cur += Length;
+            return true;
+        }
+
+        bool SkipValue()
+        {
+            if (++Depth > MaxDepth)
+            {
+                return Fail(TEXT("JSON nested too deeply"));
+            }
+            ON_SCOPE_EXIT { --Depth; };
+
+            switch (Peek())
+            {
+            case '"':
+            {
+                const uint8* Unused = nullptr;
+                bool bEscaped = false;
+                return ScanString(Unused, Unused, bEscaped);
+            }
+            case '{':
+                ++Cur;
+                if (Consume('}'))
+                {
+                    return true;
+                }
+                do
+                {
+                    const uint8* Unused = nullptr;
+                    bool bEscaped = false;
+                    if (!ScanString(Unused, Unused, bEscaped) || !Expect(':') || !SkipValue())
+                    {
+                        return false;
+                    }
+                }
+                while (Consume(','));
+                return Expect('}');
+            case '[':
+                ++Cur;
+                if (Consume(']'))
+                {
+                    return true;
+                }
+                do
+                {
+                    if (!SkipValue())
+                    {
+                        return false;
+                    }
+                }
+                while (Consume(','));
+                return Expect(']');
+            case 't':
+                return ReadLiteral("true");
+            case 'f':
+                return ReadLiteral("false");
+            case 'n':
+                return ReadLiteral("null");
+            default:
+            {
+                FJsonNumber Unused;
+                return ReadNumber(Unused);
+            }
+            }
+        }
+
+        int32 Depth = 0;
+
+    private:
+
+        const uint8* Begin;
+        const uint8* Cur;
+        const uint8* End;
+    };
+
+    // =============================================================================
+    // STRUCT READER
+    // =============================================================================
+
+    static bool ReadObject(FJsonCursor& Cursor, const FFieldMap& Map, void* StructData);
+
+    /** Read a value the fast paths do not cover through FJsonObjectConverter */
+    static bool ReadFallback(FJsonCursor& Cursor, const FProperty* Property, void* ValuePtr)
+    {
+        Cursor.Peek();
+        const uint8* ValueBegin = Cursor.GetPosition();
+        if (!Cursor.SkipValue())
+        {
+            return false;
+        }
+
+        const FString ValueText = FJsonCursor::ToFString(ValueBegin, (int32)(Cursor.GetPosition() - ValueBegin));
+        TSharedPtr<FJsonValue> Value;
+        if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ValueText), Value) || !Value.IsValid() ||
+            !FJsonObjectConverter::JsonValueToUProperty(Value, const_cast<FProperty*>(Property), ValuePtr, 0, 0))
+        {
+            return Cursor.Fail(*FString::Printf(TEXT("Could not read field '%s'"), *Property->GetAuthoredName()));
+        }
+        return true;
+    }
+
+    static bool ReadValue(FJsonCursor& Cursor, const FProperty* Property, EFieldKind Kind, void* ValuePtr)
+    {
+        const uint8 Token = Cursor.Peek();
+        if (Token == 'n')
+        {
+            // null leaves the default value in place
+            return Cursor.ReadLiteral("null");
+        }
+
+        switch (Kind)
+        {
+        case EFieldKind::Bool:
+            if (Token == 't' || Token == 'f')
+            {
+                const bool bValue = Token == 't';
+                static_cast<const FBoolProperty*>(Property)->SetPropertyValue(ValuePtr, bValue);
+                return Cursor.ReadLiteral(bValue ? "true" : "false");
+            }
+            break;
+
+        case EFieldKind::Numeric:
+            if (Token == '-' || (Token >= '0' && Token <= '9'))
+            {
+                FJsonNumber Number;
+                if (!Cursor.ReadNumber(Number))
+                {
+                    return false;
+                }
+
+                const FNumericProperty* NumericProperty = static_cast<const FNumericProperty*>(Property);
+                if (NumericProperty->IsFloatingPoint())
+                {
+                    NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Number.Value);
+                }
+                else if (Number.bNegative)
+                {
+                    NumericProperty->SetIntPropertyValue(ValuePtr, Number.Int);
+                }
+                else
+                {
+                    NumericProperty->SetIntPropertyValue(ValuePtr, Number.UInt);
+                }
+                return true;
+            }
+            break;
+
+        case EFieldKind::Enum:
+        {
+            const UEnum* Enum = nullptr;
+            const FNumericProperty* Underlying = nullptr;
+            if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+            {
+                Enum = EnumProperty->GetEnum();
+                Underlying = EnumProperty->GetUnderlyingProperty();
+            }
+            else
+            {
+                Enum = static_cast<const FByteProperty*>(Property)->Enum;
+                Underlying = static_cast<const FNumericProperty*>(Property);
+            }
+
+            if (Token == '"')
+            {
+                FString Name;
+                if (!Cursor.ReadString(Name))
+                {
+                    return false;
+                }
+
+                const int64 Value = Enum->GetValueByNameString(Name);
+                if (Value == INDEX_NONE)
+                {
+                    return Cursor.Fail(*FString::Printf(TEXT("'%s' is not a value of %s"), *Name, *Enum->GetName()));
+                }
+                Underlying->SetIntPropertyValue(ValuePtr, Value);
+                return true;
+            }
+            if (Token == '-' || (Token >= '0' && Token <= '9'))
+            {
+                FJsonNumber Number;
+                if (!Cursor.ReadNumber(Number))
+                {
+                    return false;
+                }
+                Underlying->SetIntPropertyValue(ValuePtr, Number.Int);
+                return true;
+            }
+            break;
+        }
+
+        case EFieldKind::String:
+            if (Token == '"')
+            {
+                return Cursor.ReadString(*static_cast<FString*>(ValuePtr));
+            }
+            break;
+
+        case EFieldKind::Name:
+            if (Token == '"')
+            {
+                FString Value;
+                if (!Cursor.ReadString(Value))
+                {
+                    return false;
+                }
+                *static_cast<FName*>(ValuePtr) = FName(*Value);
+                return true;
+            }
+            break;
+
+        case EFieldKind::Text:
+            if (Token == '"')
+            {
+                FString Value;
+                if (!Cursor.ReadString(Value))
+                {
+                    return false;
+                }
+                *static_cast<FText*>(ValuePtr) = FText::FromString(MoveTemp(Value));
+                return true;
+            }
+            break;
+
+        case EFieldKind::Struct:
+            // Strings (e.g., FDateTime, FColor) are imported by the converter
+            if (Token == '{')
+            {
+                const UScriptStruct* NestedType = static_cast<const FStructProperty*>(Property)->Struct;
+                return ReadObject(Cursor, *GetFieldMap(NestedType), ValuePtr);
+            }
+            break;
+
+        case EFieldKind::Array:
+            if (Token == '[')
+            {
+                const FArrayProperty* ArrayProperty = static_cast<const FArrayProperty*>(Property);
+                const FProperty* Inner = ArrayProperty->Inner;
+                const EFieldKind InnerKind = ClassifyProperty(Inner);
+
+                FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+                Helper.EmptyValues();
+
+                Cursor.Consume('[');
+                if (Cursor.Consume(']'))
+                {
+                    return true;
+                }
+                do
+                {
+                    const int32 Index = Helper.AddValue();
+                    if (!ReadValue(Cursor, Inner, InnerKind, Helper.GetRawPtr(Index)))
+                    {
+                        return false;
+                    }
+                }
+                while (Cursor.Consume(','));
+                return Cursor.Expect(']');
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        return ReadFallback(Cursor, Property, ValuePtr);
+    }
+
+    static bool ReadObject(FJsonCursor& Cursor, const FFieldMap& Map, void* StructData)
+    {
+        if (++Cursor.Depth > FJsonCursor::MaxDepth)
+        {
+            return Cursor.Fail(TEXT("JSON nested too deeply"));
+        }
+        ON_SCOPE_EXIT { --Cursor.Depth; };
+
+        if (!Cursor.Expect('{'))
+        {
+            return false;
+        }
+        if (Cursor.Consume('}'))
+        {
+            return true;
+        }
+
+        TArray<uint8> EscapedKey;
+        do
+        {
+            const uint8* KeyBegin = nullptr;
+            const uint8* KeyEnd = nullptr;
+            bool bEscaped = false;
+            if (!Cursor.ScanString(KeyBegin, KeyEnd, bEscaped) || !Cursor.Expect(':'))
+            {
+                return false;
+            }
+
+            if (bEscaped)
+            {
+                if (!FJsonCursor::Unescape(KeyBegin, KeyEnd, EscapedKey))
+                {
+                    return Cursor.Fail(TEXT("Invalid escape sequence"));
+                }
+                KeyBegin = EscapedKey.GetData();
+                KeyEnd = KeyBegin + EscapedKey.Num();
+            }
+
+            const int32 KeyLength = (int32)(KeyEnd - KeyBegin);
+            const FFieldEntry* Entry = Map.Find(HashKey(KeyBegin, KeyLength), KeyBegin, KeyLength);
+            const bool bRead = Entry
+                ? ReadValue(Cursor, Entry->Property, Entry->Kind, Entry->Property->ContainerPtrToValuePtr<void>(StructData))
+                : Cursor.SkipValue();
+            if (!bRead)
+            {
+                return false;
+            }
+        }
+        while (Cursor.Consume(','));
+
+        return Cursor.Expect('}');
+    }
+}
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpStructDeserializerCommands
+{
+    /** Time FJsonObjectConverter against the compiled field maps on a captured response */
+    static void CompareDeserializers(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 2)
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Usage: HttpBlueprint.Json.CompareDeserializers <StructName> <JsonArrayFile> [Iterations]"));
+            return;
+        }
+
+        const UScriptStruct* StructType = FindFirstObject<UScriptStruct>(*Args[0], EFindFirstObjectOptions::NativeFirst);
+        TArray<uint8> Json;
+        if (!StructType || !FFileHelper::LoadFileToArray(Json, *Args[1]))
+        {
+            UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Could not find struct '%s' or read '%s'"), *Args[0], *Args[1]);
+            return;
+        }
+        const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 10;
+
+        // The converter works on the decoded string body, so decode it once up front
+        const FString JsonText = HttpStructDeserializerDetail::FJsonCursor::ToFString(Json.GetData(), Json.Num());
+
+        int32 Records = 0;
+        const double ConverterStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            TArray<TSharedPtr<FJsonValue>> Values;
+            FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonText), Values);
+
+            TArray<TUniquePtr<FStructOnScope>> Structs;
+            for (const TSharedPtr<FJsonValue>& Value : Values)
+            {
+                const TSharedPtr<FJsonObject>* Object = nullptr;
+                if (Value.IsValid() && Value->TryGetObject(Object))
+                {
+                    TUniquePtr<FStructOnScope>& Struct = Structs.Add_GetRef(MakeUnique<FStructOnScope>(StructType));
+                    FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), StructType, Struct->GetStructMemory());
+                }
+            }
+            Records = Structs.Num();
+        }
+        const double ConverterMs = (FPlatformTime::Seconds() - ConverterStart) * 1000.0 / Iterations;
+
+        FString Error;
+        const double CompiledStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            TArray<TUniquePtr<FStructOnScope>> Structs;
+            FHttpStructDeserializer::ReadArray(StructType, Json,
+                [&Structs, StructType]() -> void*
+                {
+                    return Structs.Add_GetRef(MakeUnique<FStructOnScope>(StructType))->GetStructMemory();
+                }, Error);
+        }
+        const double CompiledMs = (FPlatformTime::Seconds() - CompiledStart) * 1000.0 / Iterations;
+
+        UE_LOG(LogHttpBlueprintAPI, Display, TEXT("%s x %d records (%d bytes): FJsonObjectConverter %.3f ms, compiled field map %.3f ms (%.1fx)%s%s"),
+            *StructType->GetName(), Records, Json.Num(), ConverterMs, CompiledMs,
+            CompiledMs > 0.0 ? ConverterMs / CompiledMs : 0.0,
+            Error.IsEmpty() ? TEXT("") : TEXT(", error: "), *Error);
+    }
+
+    static FAutoConsoleCommand CompareDeserializersCommand(
+        TEXT("HttpBlueprint.Json.CompareDeserializers"),
+        TEXT("Time FJsonObjectConverter against the compiled struct deserializer. Usage: HttpBlueprint.Json.CompareDeserializers <StructName> <JsonArrayFile> [Iterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CompareDeserializers));
+}
+
+// =============================================================================
+// STRUCT DESERIALIZER
+// =============================================================================
+
+bool FHttpStructDeserializer::ReadStruct(const UScriptStruct* StructType, TArrayView<const uint8> Json, void* StructData, FString& OutError)
+{
+    using namespace HttpStructDeserializerDetail;
+
+    check(StructType && StructData);
+
+    FJsonCursor Cursor(Json);
+    const bool bRead = ReadObject(Cursor, *GetFieldMap(StructType), StructData) &&
+        (Cursor.AtEnd() || Cursor.Fail(TEXT("Unexpected data after JSON object")));
+
+    OutError = MoveTemp(Cursor.Error);
+    return bRead;
+}
+
+bool FHttpStructDeserializer::ReadArray(const UScriptStruct* StructType, TArrayView<const uint8> Json,
+    TFunctionRef<void*()> AddElement, FString& OutError)
+{
+    using namespace HttpStructDeserializerDetail;
+
+    check(StructType);
+
+    FJsonCursor Cursor(Json);
+    const FFieldMapRef Map = GetFieldMap(StructType);
+
+    auto ReadElements = [&]()
+        {
+            if (!Cursor.Expect('['))
+            {
+                return false;
+            }
+            if (Cursor.Consume(']'))
+            {
+                return true;
+            }
+            do
+            {
+                if (!ReadObject(Cursor, *Map, AddElement()))
+                {
+                    return false;
+                }
+            }
+            while (Cursor.Consume(','));
+            return Cursor.Expect(']');
+        };
+
+    const bool bRead = ReadElements() &&
+        (Cursor.AtEnd() || Cursor.Fail(TEXT("Unexpected data after JSON array")));
+
+    OutError = MoveTemp(Cursor.Error);
+    return bRead;
+}
+
+void FHttpStructDeserializer::ClearFieldMapCache()
+{
+    FWriteScopeLock Lock(HttpStructDeserializerDetail::FieldMapLock);
+    HttpStructDeserializerDetail::FieldMaps.Empty();
+}
+
+void FHttpStructDeserializer::Startup()
+{
+    using namespace HttpStructDeserializerDetail;
+
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddStatic(&OnObjectsReplaced);
+    PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&OnPreGarbageCollect);
+}
+
+void FHttpStructDeserializer::Shutdown()
+{
+    using namespace HttpStructDeserializerDetail;
+
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+    ClearFieldMapCache();
+}
@@ -0,0 +1,528 @@
+#include "HttpTrafficArchive.h"
+#include "HttpBlueprintAPI.h"
+#include "HttpBlueprintSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+// =============================================================================
+// CONSOLE COMMANDS
+// =============================================================================
+
+namespace HttpTrafficArchiveCommands
+{
+    static FAutoConsoleCommand StartCaptureCommand(
+        TEXT("HttpBlueprint.Har.StartCapture"),
+        TEXT("Start capturing HTTP traffic to a HAR file. Usage: HttpBlueprint.Har.StartCapture [FilePath]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                FHttpTrafficArchive::Get().StartCapture(Args.Num() > 0 ? Args[0] : FString());
+            }));
+
+    static FAutoConsoleCommand StopCaptureCommand(
+        TEXT("HttpBlueprint.Har.StopCapture"),
+        TEXT("Stop capturing HTTP traffic and finish the HAR file."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpTrafficArchive::Get().StopCapture([](bool bSucceeded, const FString& FilePath)
+                    {
+                        if (bSucceeded)
+                        {
+                            UE_LOG(LogHttpBlueprintAPI, Display, TEXT("HAR file written: %s"), *FilePath);
+                        }
+                    });
+            }));
+
+    static FAutoConsoleCommand StartReplayCommand(
+        TEXT("HttpBlueprint.Har.StartReplay"),
+        TEXT("Answer HTTP requests from a HAR file. Usage: HttpBlueprint.Har.StartReplay <FilePath>"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                if (Args.Num() < 1)
+                {
+                    UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("Usage: HttpBlueprint.Har.StartReplay <FilePath>"));
+                    return;
+                }
+                FHttpTrafficArchive::Get().StartReplay(Args[0]);
+            }));
+
+    static FAutoConsoleCommand StopReplayCommand(
+        TEXT("HttpBlueprint.Har.StopReplay"),
+        TEXT("Stop answering HTTP requests from a HAR file."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FHttpTrafficArchive::Get().StopReplay();
+            }));
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+namespace HttpTrafficArchiveDetail
+{
+    typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> FCondensedJsonWriter;
+
+    /** Headers whose values are credentials; captures keep their names but not their values */
+    static const TCHAR* CredentialHeaders[] =
+    {
+        TEXT("Authorization"),
+        TEXT("Proxy-Authorization"),
+        TEXT("Cookie"),
+        TEXT("Set-Cookie"),
+        TEXT("X-Api-Key"),
+        TEXT("X-Auth-Token"),
+    };
+
+    static const TCHAR* RedactedValue = TEXT("[redacted]");
+
+    static bool IsTextContentType(const FString& ContentType)
+    {
+        return ContentType.IsEmpty() ||
+            ContentType.Contains(TEXT("text")) ||
+            ContentType.Contains(TEXT("json")) ||
+            ContentType.Contains(TEXT("xml")) ||
+            ContentType.Contains(TEXT("javascript")) ||
+            ContentType.Contains(TEXT("x-www-form-urlencoded"));
+    }
+
+    static FString Utf8BytesToString(const TArray<uint8>& Bytes)
+    {
+        FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        return FString(Converter.Length(), Converter.Get());
+    }
+
+    static void WriteHeaders(FCondensedJsonWriter& Writer, const TArray<FString>& Headers)
+    {
+        Writer.WriteArrayStart(TEXT("headers"));
+        for (const FString& HeaderLine : Headers)
+        {
+            FString HeaderName, HeaderValue;
+            if (HeaderLine.Split(TEXT(": "), &HeaderName, &HeaderValue))
+            {
+                Writer.WriteObjectStart();
+                Writer.WriteValue(TEXT("name"), HeaderName);
+                Writer.WriteValue(TEXT("value"), HeaderValue);
+                Writer.WriteObjectEnd();
+            }
+        }
+        Writer.WriteArrayEnd();
+    }
+
+    /** Write body text, base64 encoding anything that is not textual */
+    static void WriteBodyText(FCondensedJsonWriter& Writer, const TArray<uint8>& Body, const FString& ContentType)
+    {
+        if (IsTextContentType(ContentType))
+        {
+            Writer.WriteValue(TEXT("text"), Utf8BytesToString(Body));
+        }
+        else
+        {
+            Writer.WriteValue(TEXT("text"), FBase64::Encode(Body));
+            Writer.WriteValue(TEXT("encoding"), TEXT("base64"));
+        }
+    }
+}
+
+int64 FHttpArchiveEntry::GetAllocatedSize() const
+{
+    int64 Size = sizeof(FHttpArchiveEntry) + RequestBody.GetAllocatedSize() + ResponseBody.GetAllocatedSize() +
+        URL.GetAllocatedSize() + Method.GetAllocatedSize();
+    for (const FString& Header : RequestHeaders)
+    {
+        Size += Header.GetAllocatedSize();
+    }
+    for (const FString& Header : ResponseHeaders)
+    {
+        Size += Header.GetAllocatedSize();
+    }
+    return Size;
+}
+
+// =============================================================================
+// CAPTURE
+// =============================================================================
+
+FHttpTrafficArchive& FHttpTrafficArchive::Get()
+{
+    static FHttpTrafficArchive Instance;
+    return Instance;
+}
+
+FHttpTrafficArchive::FHttpTrafficArchive()
+    : WriterPipe(TEXT("HttpBlueprintHarWriter"))
+{
+}
+
+bool FHttpTrafficArchive::StartCapture(const FString& FilePath)
+{
+    check(IsInGameThread());
+
+    if (bCapturing)
+    {
+        UE_LOG(LogHttpBlueprintAPI, Warning, TEXT("HAR capture is already running"));
+        return false;
+    }
+
+    CapturePath = FilePath.IsEmpty()
+        ? FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("HttpCapture_%s.har"), *FDateTime::Now().ToString()))
+        : FilePath;
+    DroppedEntries = 0;
+    bCapturing = true;
+
+    // Queued behind the end of any previous capture, so its file is closed before this one is opened
+    WriterPipe.Launch(UE_SOURCE_LOCATION, [this, Path = CapturePath]()
+        {
+            CaptureWriter.Reset(IFileManager::Get().CreateFileWriter(*Path));
+            if (!CaptureWriter.IsValid())
+            {
+                UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not open HAR capture file: %s"), *Path);
+                bCapturing = false;
+                return;
+            }
+
+            // The document is written incrementally: header now, one entry per exchange, footer on stop
+            WrittenEntries = 0;
+            WriteText(TEXT("{\"log\":{\"version\":\"1.2\",\"creator\":{\"name\":\"HttpBlueprintAPI\",\"version\":\"1.0\"},\"entries\":["));
+        });
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HAR capture started: %s"), *CapturePath);
+    return true;
+}
+
+void FHttpTrafficArchive::StopCapture(FOnCaptureStopped OnStopped)
+{
+    check(IsInGameThread());
+
+    if (!bCapturing.Exchange(false))
+    {
+        return;
+    }
+
+    // Entries already queued are written first; the game thread does not wait for any of it
+    WriterPipe.Launch(UE_SOURCE_LOCATION, [this, Path = CapturePath, Dropped = DroppedEntries.Load(), OnStopped = MoveTemp(OnStopped)]()
+        {
+            bool bSucceeded = false;
+            if (CaptureWriter.IsValid())
+            {
+                WriteText(TEXT("]}}"));
+                bSucceeded = CaptureWriter->Close();
+                CaptureWriter.Reset();
+
+                UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HAR capture stopped. Entries written: %d, dropped: %d"),
+                    WrittenEntries, Dropped);
+                if (!bSucceeded)
+                {
+                    UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not finish HAR capture file: %s"), *Path);
+                }
+            }
+
+            if (OnStopped)
+            {
+                AsyncTask(ENamedThreads::GameThread, [OnStopped, bSucceeded, Path]()
+                    {
+                        OnStopped(bSucceeded, Path);
+                    });
+            }
+        });
+}
+
+void FHttpTrafficArchive::WaitForWriter()
+{
+    WriterPipe.WaitUntilEmpty();
+}
+
+void FHttpTrafficArchive::CaptureExchange(const FHttpBlueprintRuntimeSettings& Settings, const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, float ElapsedSeconds)
+{
+    if (!bCapturing || !Request.IsValid())
+    {
+        return;
+    }
+
+    FHttpArchiveEntry Entry;
+    Entry.ElapsedSeconds = ElapsedSeconds;
+    Entry.StartedDateTime = FDateTime::UtcNow() - FTimespan::FromSeconds(ElapsedSeconds);
+    Entry.Method = Request->GetVerb();
+    Entry.URL = Request->GetURL();
+    Entry.RequestHeaders = Request->GetAllHeaders();
+    Entry.RequestBody = Request->GetContent();
+    Entry.RequestContentType = Request->GetContentType();
+
+    if (Response.IsValid())
+    {
+        const TArray<uint8>& Content = Response->GetContent();
+        const int32 BodyBytes = FMath::Min(Content.Num(), Settings.HarMaxBodyBytes);
+
+        Entry.ResponseCode = Response->GetResponseCode();
+        Entry.ResponseHeaders = Response->GetAllHeaders();
+        Entry.ResponseBody.Append(Content.GetData(), BodyBytes);
+        Entry.ResponseContentType = Response->GetContentType();
+        Entry.bResponseBodyTruncated = BodyBytes < Content.Num();
+    }
+
+    if (!Settings.bHarIncludeCredentials)
+    {
+        RedactCredentialHeaders(Entry.RequestHeaders);
+        RedactCredentialHeaders(Entry.ResponseHeaders);
+    }
+
+    // Bound the memory held by entries that have not reached the disk yet
+    const int64 EntryBytes = Entry.GetAllocatedSize();
+    if (QueuedBytes.AddExchange(EntryBytes) + EntryBytes > Settings.HarMaxQueuedBytes)
+    {
+        QueuedBytes -= EntryBytes;
+        ++DroppedEntries;
+        return;
+    }
+
+    WriterPipe.Launch(UE_SOURCE_LOCATION, [this, Entry = MoveTemp(Entry), EntryBytes]()
+        {
+            if (CaptureWriter.IsValid())
+            {
+                WriteText((WrittenEntries++ > 0 ? TEXT(",") : TEXT("")) + SerializeEntry(Entry));
+            }
+            QueuedBytes -= EntryBytes;
+        });
+}
+
+FString FHttpTrafficArchive::SerializeEntry(const FHttpArchiveEntry& Entry) const
+{
+    using namespace HttpTrafficArchiveDetail;
+
+    const double TimeMs = Entry.ElapsedSeconds * 1000.0;
+
+    FString Json;
+    TSharedRef<FCondensedJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("startedDateTime"), Entry.StartedDateTime.ToIso8601());
+    Writer->WriteValue(TEXT("time"), TimeMs);
+
+    Writer->WriteObjectStart(TEXT("request"));
+    Writer->WriteValue(TEXT("method"), Entry.Method);
+    Writer->WriteValue(TEXT("url"), Entry.URL);
+    Writer->WriteValue(TEXT("httpVersion"), TEXT("HTTP/1.1"));
+    Writer->WriteArrayStart(TEXT("cookies"));
+    Writer->WriteArrayEnd();
+    WriteHeaders(*Writer, Entry.RequestHeaders);
+    Writer->WriteArrayStart(TEXT("queryString"));
+    Writer->WriteArrayEnd();
+    if (Entry.RequestBody.Num() > 0)
+    {
+        Writer->WriteObjectStart(TEXT("postData"));
+        Writer->WriteValue(TEXT("mimeType"), Entry.RequestContentType);
+        WriteBodyText(*Writer, Entry.RequestBody, Entry.RequestContentType);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteValue(TEXT("headersSize"), -1);
+    Writer->WriteValue(TEXT("bodySize"), Entry.RequestBody.Num());
+    Writer->WriteObjectEnd();
+
+    Writer->WriteObjectStart(TEXT("response"));
+    Writer->WriteValue(TEXT("status"), Entry.ResponseCode);
+    Writer->WriteValue(TEXT("statusText"), UHttpBlueprintFunctionLibrary::GetHttpResponseCodeDescription(Entry.ResponseCode));
+    Writer->WriteValue(TEXT("httpVersion"), TEXT("HTTP/1.1"));
+    Writer->WriteArrayStart(TEXT("cookies"));
+    Writer->WriteArrayEnd();
+    WriteHeaders(*Writer, Entry.ResponseHeaders);
+    Writer->WriteObjectStart(TEXT("content"));
+    Writer->WriteValue(TEXT("size"), Entry.ResponseBody.Num());
+    Writer->WriteValue(TEXT("mimeType"), Entry.ResponseContentType);
+    WriteBodyText(*Writer, Entry.ResponseBody, Entry.ResponseContentType);
+    if (Entry.bResponseBodyTruncated)
+    {
+        Writer->WriteValue(TEXT("comment"), TEXT("truncated"));
+    }
+    Writer->WriteObjectEnd();
+    Writer->WriteValue(TEXT("redirectURL"), TEXT(""));
+    Writer->WriteValue(TEXT("headersSize"), -1);
+    Writer->WriteValue(TEXT("bodySize"), Entry.ResponseBody.Num());
+    Writer->WriteObjectEnd();
+
+    Writer->WriteObjectStart(TEXT("cache"));
+    Writer->WriteObjectEnd();
+
+    // Only the total time is known; report it as server wait time
+    Writer->WriteObjectStart(TEXT("timings"));
+    Writer->WriteValue(TEXT("blocked"), -1);
+    Writer->WriteValue(TEXT("dns"), -1);
+    Writer->WriteValue(TEXT("connect"), -1);
+    Writer->WriteValue(TEXT("ssl"), -1);
+    Writer->WriteValue(TEXT("send"), 0);
+    Writer->WriteValue(TEXT("wait"), TimeMs);
+    Writer->WriteValue(TEXT("receive"), 0);
+    Writer->WriteObjectEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Json;
+}
+
+void FHttpTrafficArchive::RedactCredentialHeaders(TArray<FString>& Headers)
+{
+    for (FString& HeaderLine : Headers)
+    {
+        for (const TCHAR* CredentialHeader : HttpTrafficArchiveDetail::CredentialHeaders)
+        {
+            const int32 NameLength = FCString::Strlen(CredentialHeader);
+            if (HeaderLine.Len() > NameLength && HeaderLine[NameLength] == TEXT(':') &&
+                FCString::Strnicmp(*HeaderLine, CredentialHeader, NameLength) == 0)
+            {
+                HeaderLine = HeaderLine.Left(NameLength) + TEXT(": ") + HttpTrafficArchiveDetail::RedactedValue;
+                break;
+            }
+        }
+    }
+}
+
+void FHttpTrafficArchive::WriteText(const FString& Text)
+{
+    FTCHARToUTF8 Utf8(*Text);
+    CaptureWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
+
+// =============================================================================
+// REPLAY
+// =============================================================================
+
+FString FHttpTrafficArchive::MakeReplayKey(const FString& Method, const FString& URL)
+{
+    return Method.ToUpper() + TEXT(" ") + URL;
+}
+
+bool FHttpTrafficArchive::StartReplay(const FString& FilePath)
+{
+    FString HarText;
+    if (!FFileHelper::LoadFileToString(HarText, *FilePath))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Could not read HAR file: %s"), *FilePath);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HarText);
+    const TSharedPtr<FJsonObject>* Log = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() ||
+        !Root->TryGetObjectField(TEXT("log"), Log) || !(*Log)->TryGetArrayField(TEXT("entries"), Entries))
+    {
+        UE_LOG(LogHttpBlueprintAPI, Error, TEXT("Invalid HAR file: %s"), *FilePath);
+        return false;
+    }
+
+    TMap<FString, FReplayQueue> LoadedResponses;
+    for (const TSharedPtr<FJsonValue>& EntryValue : *Entries)
+    {
+        const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+        const TSharedPtr<FJsonObject>* RequestObject = nullptr;
+        const TSharedPtr<FJsonObject>* ResponseObject = nullptr;
+        if (!EntryValue->TryGetObject(EntryObject) ||
+            !(*EntryObject)->TryGetObjectField(TEXT("request"), RequestObject) ||
+            !(*EntryObject)->TryGetObjectField(TEXT("response"), ResponseObject))
+        {
+            continue;
+        }
+
+        FReplayResponse Replay;
+        Replay.LatencySeconds = (float)((*EntryObject)->GetNumberField(TEXT("time")) / 1000.0);
+
+        FHttpResponseData& Response = Replay.Response;
+        Response.ResponseCode = (*ResponseObject)->GetIntegerField(TEXT("status"));
+        Response.ResponseTimeSeconds = Replay.LatencySeconds;
+
+        const TSharedPtr<FJsonObject>* ContentObject = nullptr;
+        if ((*ResponseObject)->TryGetObjectField(TEXT("content"), ContentObject))
+        {
+            FString Text = (*ContentObject)->GetStringField(TEXT("text"));
+            FString Encoding;
+            if ((*ContentObject)->TryGetStringField(TEXT("encoding"), Encoding) && Encoding == TEXT("base64"))
+            {
+                TArray<uint8> Decoded;
+                FBase64::Decode(Text, Decoded);
+                Text = HttpTrafficArchiveDetail::Utf8BytesToString(Decoded);
+            }
+            Response.ResponseBody = MoveTemp(Text);
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Headers = nullptr;
+        if ((*ResponseObject)->TryGetArrayField(TEXT("headers"), Headers))
+        {
+            for (const TSharedPtr<FJsonValue>& HeaderValue : *Headers)
+            {
+                const TSharedPtr<FJsonObject>* HeaderObject = nullptr;
+                if (HeaderValue->TryGetObject(HeaderObject))
+                {
+                    Response.ResponseHeaders.Add(
+                        (*HeaderObject)->GetStringField(TEXT("name")),
+                        (*HeaderObject)->GetStringField(TEXT("value")));
+                }
+            }
+        }
+
+        // Mirror ProcessHttpResponse so replayed responses look exactly like live ones
+        if (Response.ResponseCode > 0)
+        {
+            Response.bWasSuccessful = UHttpBlueprintFunctionLibrary::IsHttpResponseSuccessful(Response.ResponseCode);
+            Response.ErrorKind = UHttpBlueprintFunctionLibrary::GetHttpErrorKindForStatus(Response.ResponseCode);
+        }
+        else
+        {
+            Response.SetError(EHttpErrorKind::NetworkError);
+        }
+
+        const FString Key = MakeReplayKey(
+            (*RequestObject)->GetStringField(TEXT("method")),
+            (*RequestObject)->GetStringField(TEXT("url")));
+        LoadedResponses.FindOrAdd(Key).Responses.Add(MoveTemp(Replay));
+    }
+
+    {
+        FScopeLock Lock(&ReplayLock);
+        ReplayResponses = MoveTemp(LoadedResponses);
+        bReplaying = true;
+    }
+
+    UE_LOG(LogHttpBlueprintAPI, Log, TEXT("HAR replay started from %s (%d entries)"), *FilePath, Entries->Num());
+    return true;
+}
+
+void FHttpTrafficArchive::StopReplay()
+{
+    FScopeLock Lock(&ReplayLock);
+    bReplaying = false;
+    ReplayResponses.Empty();
+}
+
+bool FHttpTrafficArchive::FindReplayResponse(const FString& Method, const FString& URL, FHttpResponseData& OutResponse, float& OutLatencySeconds)
+{
+    if (!bReplaying)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&ReplayLock);
+
+    FReplayQueue* Queue = ReplayResponses.Find(MakeReplayKey(Method, URL));
+    if (!Queue || Queue->Responses.Num() == 0)
+    {
+        return false;
+    }
+
+    // Repeated requests for the same URL are answered in recorded order, wrapping around
+    const FReplayResponse& Replay = Queue->Responses[Queue->NextIndex];
+    Queue->NextIndex = (Queue->NextIndex + 1) % Queue->Responses.Num();
+
+    OutResponse = Replay.Response;
+    OutLatencySeconds = Replay.LatencySeconds * FMath::Max(0.0f, FHttpBlueprintRuntimeSettings::Get().HarReplayLatencyScale);
+    return true;
+}
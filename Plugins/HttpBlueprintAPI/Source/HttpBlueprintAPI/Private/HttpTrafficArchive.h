@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Tasks/Pipe.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+class FArchive;
+struct FHttpBlueprintRuntimeSettings;
+
+/**
+ * Snapshot of one request/response exchange, taken on the completion thread
+ * and serialized to HAR JSON later on a worker
+ */
+struct FHttpArchiveEntry
+{
+    FDateTime StartedDateTime;
+    float ElapsedSeconds = 0.0f;
+
+    FString Method;
+    FString URL;
+    TArray<FString> RequestHeaders;
+    TArray<uint8> RequestBody;
+    FString RequestContentType;
+
+    int32 ResponseCode = 0;
+    TArray<FString> ResponseHeaders;
+    TArray<uint8> ResponseBody;
+    FString ResponseContentType;
+    bool bResponseBodyTruncated = false;
+
+    /** Approximate memory held by this entry while it waits to be written */
+    int64 GetAllocatedSize() const;
+};
+
+/**
+ * HTTP Archive (HAR 1.2) capture and replay
+ *
+ * Capture: completed exchanges are snapshotted and appended to a HAR file on a
+ * serialized worker pipe. Entries waiting to be written are bounded by
+ * HttpBlueprint.Har.MaxQueuedBytes; anything beyond that is dropped and counted.
+ * Credential headers are redacted unless HttpBlueprint.Har.IncludeCredentials is set.
+ *
+ * Replay: a HAR file is indexed by method + URL and matching requests are answered
+ * in-process, without touching the network, after the originally recorded latency
+ * (scaled by HttpBlueprint.Har.ReplayLatencyScale).
+ */
+class FHttpTrafficArchive
+{
+public:
+
+    static FHttpTrafficArchive& Get();
+
+    // -------------------------------------------------------------------------
+    // Capture
+    // -------------------------------------------------------------------------
+
+    /** Called on the game thread once the HAR file is finished and closed */
+    using FOnCaptureStopped = TFunction<void(bool bSucceeded, const FString& FilePath)>;
+
+    /**
+     * Start streaming captured traffic to a HAR file (empty path picks one in the log dir)
+     * The file is opened on the writer pipe; if that fails the error is logged and the capture ends.
+     */
+    bool StartCapture(const FString& FilePath);
+
+    /**
+     * Stop capturing; the HAR document is finished and closed on the writer pipe without waiting
+     *
+     * @param OnStopped - Optional, called on the game thread once every queued entry is on disk
+     */
+    void StopCapture(FOnCaptureStopped OnStopped = nullptr);
+
+    /** Block until queued entries and pending stops have reached the disk (module shutdown only) */
+    void WaitForWriter();
+
+    bool IsCapturing() const { return bCapturing; }
+
+    /** Snapshot a finished exchange, credential headers redacted unless the settings keep them, and queue it for writing */
+    void CaptureExchange(const FHttpBlueprintRuntimeSettings& Settings, const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, float ElapsedSeconds);
+
+    // -------------------------------------------------------------------------
+    // Replay
+    // -------------------------------------------------------------------------
+
+    /** Load a HAR file and start answering matching requests from it */
+    bool StartReplay(const FString& FilePath);
+
+    /** Stop answering requests from the loaded HAR file */
+    void StopReplay();
+
+    bool IsReplaying() const { return bReplaying; }
+
+    /**
+     * Look up the recorded response for a request
+     *
+     * @param Method - HTTP method of the outgoing request
+     * @param URL - Full URL of the outgoing request
+     * @param OutResponse - Recorded response converted to the Blueprint-friendly structure
+     * @param OutLatencySeconds - Delay to apply before delivering the response
+     * @return True if a recorded response was found
+     */
+    bool FindReplayResponse(const FString& Method, const FString& URL, FHttpResponseData& OutResponse, float& OutLatencySeconds);
+
+private:
+
+    FHttpTrafficArchive();
+
+    /** Serialize one entry as HAR JSON (writer pipe only) */
+    FString SerializeEntry(const FHttpArchiveEntry& Entry) const;
+
+    /** Append UTF-8 text to the capture file (writer pipe only) */
+    void WriteText(const FString& Text);
+
+    /** Replace the values of credential headers ("Name: Value" lines) with a placeholder */
+    static void RedactCredentialHeaders(TArray<FString>& Headers);
+
+    static FString MakeReplayKey(const FString& Method, const FString& URL);
+
+    // Capture state
+    UE::Tasks::FPipe WriterPipe;
+    TAtomic<bool> bCapturing { false };
+    TAtomic<int64> QueuedBytes { 0 };
+    TAtomic<int32> DroppedEntries { 0 };
+    FString CapturePath;
+
+    // Capture file (writer pipe only)
+    TUniquePtr<FArchive> CaptureWriter;
+    int32 WrittenEntries = 0;
+
+    // Replay state
+    struct FReplayResponse
+    {
+        FHttpResponseData Response;
+        float LatencySeconds = 0.0f;
+    };
+
+    struct FReplayQueue
+    {
+        TArray<FReplayResponse> Responses;
+        int32 NextIndex = 0;
+    };
+
+    FCriticalSection ReplayLock;
+    TMap<FString, FReplayQueue> ReplayResponses;
+    TAtomic<bool> bReplaying { false };
+};
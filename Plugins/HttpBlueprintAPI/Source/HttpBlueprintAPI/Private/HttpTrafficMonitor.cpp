@@ -0,0 +1,130 @@
+#include "HttpTrafficMonitor.h"
+#include "HttpCallSites.h"
+#include "HAL/PlatformTime.h"
+
+FHttpTrafficMonitor& FHttpTrafficMonitor::Get()
+{
+    static FHttpTrafficMonitor Instance;
+    return Instance;
+}
+
+FHttpTrafficMonitor::FHttpTrafficMonitor()
+    : Slots(MakeUnique<FSlot[]>(Capacity))
+{
+    for (uint64 Index = 0; Index < Capacity; ++Index)
+    {
+        Slots[Index].Sequence = Index;
+    }
+}
+
+void FHttpTrafficMonitor::SetEnabled(bool bInEnabled)
+{
+    bEnabled = bInEnabled;
+}
+
+void FHttpTrafficMonitor::Record(FHttpTrafficEvent&& Event)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    uint64 Position = EnqueuePosition.Load(EMemoryOrder::Relaxed);
+    for (;;)
+    {
+        FSlot& Slot = Slots[Position & (Capacity - 1)];
+        const int64 Lag = (int64)(Slot.Sequence.Load() - Position);
+        if (Lag == 0)
+        {
+            // The slot is free for this position; claim it (on failure Position is reloaded)
+            if (EnqueuePosition.CompareExchange(Position, Position + 1))
+            {
+                Slot.Event = MoveTemp(Event);
+                Slot.Sequence = Position + 1;
+                return;
+            }
+        }
+        else if (Lag < 0)
+        {
+            // The consumer has not freed this slot yet: the ring is full
+            NumDropped.IncrementExchange();
+            return;
+        }
+        else
+        {
+            // Another producer claimed this position
+            Position = EnqueuePosition.Load(EMemoryOrder::Relaxed);
+        }
+    }
+}
+
+void FHttpTrafficMonitor::Record(uint32 RequestId, EHttpTrafficEventType Type)
+{
+    // Requests rejected before they got an id are not shown
+    if (!IsEnabled() || RequestId == 0)
+    {
+        return;
+    }
+
+    FHttpTrafficEvent Event;
+    Event.RequestId = RequestId;
+    Event.Type = Type;
+    Event.TimeSeconds = FPlatformTime::Seconds();
+    Record(MoveTemp(Event));
+}
+
+void FHttpTrafficMonitor::RecordStarted(uint32 RequestId, const FString& Method, const FString& URL, int64 RequestBytes, EHttpTrafficSource Source, uint32 CallSiteId)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    FHttpTrafficEvent Event;
+    Event.RequestId = RequestId;
+    Event.Type = EHttpTrafficEventType::Started;
+    Event.TimeSeconds = FPlatformTime::Seconds();
+    Event.Method = Method;
+    Event.URL = URL;
+    Event.Caller = FHttpCallSites::GetName(CallSiteId);
+    Event.Source = Source;
+    Event.RequestBytes = RequestBytes;
+    Record(MoveTemp(Event));
+}
+
+void FHttpTrafficMonitor::RecordCompleted(uint32 RequestId, const FHttpResponseData& Response, int64 ResponseBytes)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    FHttpTrafficEvent Event;
+    Event.RequestId = RequestId;
+    Event.Type = EHttpTrafficEventType::Completed;
+    Event.TimeSeconds = FPlatformTime::Seconds();
+    Event.ResponseCode = Response.ResponseCode;
+    Event.ResponseBytes = ResponseBytes;
+    Event.ErrorKind = Response.ErrorKind;
+    Record(MoveTemp(Event));
+}
+
+int32 FHttpTrafficMonitor::Drain(TArray<FHttpTrafficEvent>& OutEvents)
+{
+    int32 NumDrained = 0;
+    for (;;)
+    {
+        FSlot& Slot = Slots[DequeuePosition & (Capacity - 1)];
+        if (Slot.Sequence.Load() != DequeuePosition + 1)
+        {
+            break;
+        }
+
+        OutEvents.Add(MoveTemp(Slot.Event));
+        Slot.Event = FHttpTrafficEvent();
+        Slot.Sequence = DequeuePosition + Capacity;
+        ++DequeuePosition;
+        ++NumDrained;
+    }
+    return NumDrained;
+}
@@ -0,0 +1,315 @@
+#include "HttpBlueprintTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpResponseCache.h"
+#include "HttpModule.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/AutomationTest.h"
+
+namespace HttpBlueprintUnitTestsDetail
+{
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext
+        | EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter;
+}
+
+// =============================================================================
+// REQUEST VALIDATION
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpBlueprintValidateHttpRequestTest, "HttpBlueprint.Unit.ValidateHttpRequest",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+bool FHttpBlueprintValidateHttpRequestTest::RunTest(const FString& Parameters)
+{
+    FString Error;
+
+    TestTrue(TEXT("GET to an https URL"), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(TEXT("https://example.com/api"), TEXT("GET"), Error));
+    TestTrue(TEXT("No error message on success"), Error.IsEmpty());
+
+    for (const TCHAR* Method : { TEXT("GET"), TEXT("POST"), TEXT("PUT"), TEXT("DELETE"), TEXT("PATCH"), TEXT("HEAD"), TEXT("OPTIONS"), TEXT("post") })
+    {
+        TestTrue(FString::Printf(TEXT("Method %s"), Method), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(TEXT("http://example.com"), Method, Error));
+    }
+
+    TestFalse(TEXT("Empty URL"), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(FString(), TEXT("GET"), Error));
+    TestEqual(TEXT("Empty URL message"), Error, FString(TEXT("URL cannot be empty")));
+
+    Error.Reset();
+    TestFalse(TEXT("URL without a scheme"), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(TEXT("example.com"), TEXT("GET"), Error));
+    TestFalse(TEXT("Invalid URL message"), Error.IsEmpty());
+
+    Error.Reset();
+    TestFalse(TEXT("Empty method"), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(TEXT("https://example.com"), FString(), Error));
+    TestFalse(TEXT("Empty method message"), Error.IsEmpty());
+
+    Error.Reset();
+    TestFalse(TEXT("Unsupported method"), FHttpBlueprintFunctionLibraryTestAccess::ValidateHttpRequest(TEXT("https://example.com"), TEXT("TRACE"), Error));
+    TestFalse(TEXT("Unsupported method message"), Error.IsEmpty());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpBlueprintIsValidURLTest, "HttpBlueprint.Unit.IsValidURL",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+bool FHttpBlueprintIsValidURLTest::RunTest(const FString& Parameters)
+{
+    TestTrue(TEXT("http"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("http://example.com")));
+    TestTrue(TEXT("https with path and query"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("https://example.com/a/b?c=d")));
+    TestTrue(TEXT("Scheme is case-insensitive"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("HTTPS://example.com")));
+
+    TestFalse(TEXT("Empty"), UHttpBlueprintFunctionLibrary::IsValidURL(FString()));
+    TestFalse(TEXT("No scheme"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("example.com")));
+    TestFalse(TEXT("Other scheme"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("ftp://example.com")));
+    TestFalse(TEXT("Scheme only"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("https://")));
+    TestFalse(TEXT("Space"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("https://example.com/a b")));
+    TestFalse(TEXT("Angle brackets"), UHttpBlueprintFunctionLibrary::IsValidURL(TEXT("https://example.com/<script>")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpBlueprintGetDomainFromURLTest, "HttpBlueprint.Unit.GetDomainFromURL",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+bool FHttpBlueprintGetDomainFromURLTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("https with path"), UHttpBlueprintFunctionLibrary::GetDomainFromURL(TEXT("https://api.example.com/v1/items")), FString(TEXT("api.example.com")));
+    TestEqual(TEXT("http with query"), UHttpBlueprintFunctionLibrary::GetDomainFromURL(TEXT("http://example.com?q=1")), FString(TEXT("example.com")));
+    TestEqual(TEXT("Port is kept"), UHttpBlueprintFunctionLibrary::GetDomainFromURL(TEXT("http://127.0.0.1:8080/metrics")), FString(TEXT("127.0.0.1:8080")));
+    TestEqual(TEXT("Host only"), UHttpBlueprintFunctionLibrary::GetDomainFromURL(TEXT("https://example.com")), FString(TEXT("example.com")));
+    return true;
+}
+
+// =============================================================================
+// REQUEST SIGNING
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpBlueprintCanonicalizeQueryTest, "HttpBlueprint.Unit.Signing.CanonicalizeQuery",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+bool FHttpBlueprintCanonicalizeQueryTest::RunTest(const FString& Parameters)
+{
+    auto Canonicalize = [](const TCHAR* Query) { return FHttpRequestSignerTestAccess::CanonicalizeQuery(Query); };
+
+    TestEqual(TEXT("Empty"), Canonicalize(TEXT("")), FString());
+    TestEqual(TEXT("Sorted by name"), Canonicalize(TEXT("b=2&a=1")), FString(TEXT("a=1&b=2")));
+    TestEqual(TEXT("Name that prefixes another sorts first"), Canonicalize(TEXT("a1=2&a=1")), FString(TEXT("a=1&a1=2")));
+    TestEqual(TEXT("Prefix order does not depend on input order"), Canonicalize(TEXT("a=1&a1=2")), FString(TEXT("a=1&a1=2")));
+    TestEqual(TEXT("Repeated name sorted by value"), Canonicalize(TEXT("a=2&a=10&a=1")), FString(TEXT("a=1&a=10&a=2")));
+    TestEqual(TEXT("Byte order, uppercase first"), Canonicalize(TEXT("a=1&B=2")), FString(TEXT("B=2&a=1")));
+    TestEqual(TEXT("Name without a value"), Canonicalize(TEXT("flag&a=1")), FString(TEXT("a=1&flag=")));
+    TestEqual(TEXT("Encoded once, whether escaped or not"), Canonicalize(TEXT("q=a b&p=a%20b")), FString(TEXT("p=a%20b&q=a%20b")));
+    return true;
+}
+
+// =============================================================================
+// RESPONSE PROCESSING
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpBlueprintProcessFailedResponseTest, "HttpBlueprint.Unit.ProcessHttpResponse.NetworkError",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+bool FHttpBlueprintProcessFailedResponseTest::RunTest(const FString& Parameters)
+{
+    const FHttpResponseData Response = FHttpBlueprintFunctionLibraryTestAccess::ProcessHttpResponse(nullptr, nullptr, false);
+
+    TestFalse(TEXT("Not successful"), Response.bWasSuccessful);
+    TestEqual(TEXT("No status code"), Response.ResponseCode, 0);
+    TestTrue(TEXT("Network error"), Response.ErrorKind == EHttpErrorKind::NetworkError);
+    TestTrue(TEXT("No body"), Response.ResponseBody.IsEmpty());
+    return true;
+}
+
+/**
+ * ProcessHttpResponse against real responses from FHttpLoopbackTestServer
+ * The requests are completed through the engine HTTP module, then processed directly so the
+ * assertions see exactly what the library builds before delivery.
+ */
+BEGIN_DEFINE_SPEC(FHttpBlueprintProcessResponseSpec, "HttpBlueprint.Unit.ProcessHttpResponse",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+    FHttpLoopbackTestServer Server;
+
+    void Fetch(const TCHAR* Path, const FDoneDelegate& Done, TFunction<void(const FHttpResponseData&)> Check);
+
+END_DEFINE_SPEC(FHttpBlueprintProcessResponseSpec)
+
+void FHttpBlueprintProcessResponseSpec::Fetch(const TCHAR* Path, const FDoneDelegate& Done, TFunction<void(const FHttpResponseData&)> Check)
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Server.GetURL(Path));
+    Request->SetVerb(TEXT("GET"));
+    Request->OnProcessRequestComplete().BindLambda([Done, Check = MoveTemp(Check)](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            Check(FHttpBlueprintFunctionLibraryTestAccess::ProcessHttpResponse(Request, Response, bWasSuccessful));
+            Done.Execute();
+        });
+
+    if (!Request->ProcessRequest())
+    {
+        AddError(TEXT("Could not start the loopback request"));
+        Done.Execute();
+    }
+}
+
+void FHttpBlueprintProcessResponseSpec::Define()
+{
+    BeforeEach([this]()
+        {
+            TestTrue(TEXT("Loopback server started"), Server.Start());
+        });
+
+    AfterEach([this]()
+        {
+            Server.Stop();
+        });
+
+    LatentIt(TEXT("fills code, body and headers for a 200"), FTimespan::FromSeconds(10.0), [this](const FDoneDelegate& Done)
+        {
+            Fetch(TEXT("/ok"), Done, [this](const FHttpResponseData& Response)
+                {
+                    TestTrue(TEXT("Successful"), Response.bWasSuccessful);
+                    TestEqual(TEXT("Status code"), Response.ResponseCode, 200);
+                    TestTrue(TEXT("No error"), Response.ErrorKind == EHttpErrorKind::None);
+                    TestEqual(TEXT("Body"), Response.ResponseBody, FString(FHttpLoopbackTestServer::OkBody));
+
+                    const FString* Header = Response.ResponseHeaders.Find(TEXT("X-HttpBlueprint-Test"));
+                    TestTrue(TEXT("Custom header parsed"), Header && *Header == TEXT("loopback"));
+                });
+        });
+
+    LatentIt(TEXT("classifies a 404"), FTimespan::FromSeconds(10.0), [this](const FDoneDelegate& Done)
+        {
+            Fetch(TEXT("/missing"), Done, [this](const FHttpResponseData& Response)
+                {
+                    TestFalse(TEXT("Not successful"), Response.bWasSuccessful);
+                    TestEqual(TEXT("Status code"), Response.ResponseCode, 404);
+                    TestTrue(TEXT("Client error"), Response.ErrorKind == EHttpErrorKind::HttpClientError);
+                });
+        });
+
+    LatentIt(TEXT("classifies a 500"), FTimespan::FromSeconds(10.0), [this](const FDoneDelegate& Done)
+        {
+            Fetch(TEXT("/error"), Done, [this](const FHttpResponseData& Response)
+                {
+                    TestFalse(TEXT("Not successful"), Response.bWasSuccessful);
+                    TestEqual(TEXT("Status code"), Response.ResponseCode, 500);
+                    TestTrue(TEXT("Server error"), Response.ErrorKind == EHttpErrorKind::HttpServerError);
+                });
+        });
+}
+
+// =============================================================================
+// RESPONSE CACHE
+// =============================================================================
+
+/**
+ * Injected faults fall back to cached responses like real failures
+ * Fault injection is configured through its console variables, restored after each test.
+ */
+BEGIN_DEFINE_SPEC(FHttpBlueprintStaleOnErrorSpec, "HttpBlueprint.Unit.ResponseCache.StaleIfError",
+    HttpBlueprintUnitTestsDetail::TestFlags)
+
+    static constexpr const TCHAR* URL = TEXT("https://stale-if-error.test/items");
+    static constexpr const TCHAR* CachedBody = TEXT("{\"items\":[\"cached\"]}");
+
+    TMap<FString, FString> SavedValues;
+
+    void SetConsoleVariable(const TCHAR* Name, const TCHAR* Value);
+
+END_DEFINE_SPEC(FHttpBlueprintStaleOnErrorSpec)
+
+void FHttpBlueprintStaleOnErrorSpec::SetConsoleVariable(const TCHAR* Name, const TCHAR* Value)
+{
+    if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name))
+    {
+        if (!SavedValues.Contains(Name))
+        {
+            SavedValues.Add(Name, Variable->GetString());
+        }
+        Variable->Set(Value, ECVF_SetByConsole);
+    }
+    else
+    {
+        AddError(FString::Printf(TEXT("Missing console variable %s"), Name));
+    }
+}
+
+void FHttpBlueprintStaleOnErrorSpec::Define()
+{
+    BeforeEach([this]()
+        {
+            // Every request to the test URL fails with a synthetic 503
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.Enable"), TEXT("1"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.UrlFilter"), TEXT("stale-if-error.test"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.DropPercent"), TEXT("0"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.ErrorPercent"), TEXT("100"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.ErrorCodes"), TEXT("503"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.LatencyMs"), TEXT("0"));
+            SetConsoleVariable(TEXT("HttpBlueprint.Fault.JitterMs"), TEXT("0"));
+
+            // Expired at once, but usable for a minute when the server fails
+            FHttpResponseData Cached;
+            Cached.bWasSuccessful = true;
+            Cached.ResponseCode = 200;
+            Cached.ResponseBody = CachedBody;
+            Cached.ResponseHeaders.Add(TEXT("Cache-Control"), TEXT("max-age=0, stale-if-error=60"));
+            FHttpResponseCache::Get().Clear();
+            TestTrue(TEXT("Response cached"), FHttpResponseCache::Get().Store(TEXT("GET"), URL,
+                [](const FString&) { return FString(); }, Cached));
+        });
+
+    AfterEach([this]()
+        {
+            for (const TPair<FString, FString>& Saved : SavedValues)
+            {
+                IConsoleManager::Get().FindConsoleVariable(*Saved.Key)->Set(*Saved.Value, ECVF_SetByConsole);
+            }
+            SavedValues.Reset();
+            FHttpResponseCache::Get().Clear();
+        });
+
+    LatentIt(TEXT("serves the cached response in place of an injected fault"), FTimespan::FromSeconds(10.0), [this](const FDoneDelegate& Done)
+        {
+            FHttpRequestOptions Options;
+            Options.CachePolicy = EHttpCachePolicy::StaleIfError;
+
+            const FHttpResponseCallback Callback(FOnHttpResponseNative::CreateLambda([this, Done](const FHttpResponseData& Response)
+                {
+                    TestTrue(TEXT("Successful"), Response.bWasSuccessful);
+                    TestEqual(TEXT("Status code"), Response.ResponseCode, 200);
+                    TestEqual(TEXT("Cached body"), Response.ResponseBody, FString(CachedBody));
+                    TestTrue(TEXT("Marked stale"), Response.bIsStale);
+                    Done.Execute();
+                }));
+
+            if (!FHttpBlueprintFunctionLibraryTestAccess::TryInjectRequestFault(URL, TEXT("GET"), TMap<FString, FString>(), Callback, Options))
+            {
+                AddError(TEXT("No fault was injected"));
+                Done.Execute();
+            }
+        });
+
+    LatentIt(TEXT("delivers the injected fault without a stale cache policy"), FTimespan::FromSeconds(10.0), [this](const FDoneDelegate& Done)
+        {
+            FHttpRequestOptions Options;
+            Options.CachePolicy = EHttpCachePolicy::FreshOnly;
+
+            const FHttpResponseCallback Callback(FOnHttpResponseNative::CreateLambda([this, Done](const FHttpResponseData& Response)
+                {
+                    TestFalse(TEXT("Not successful"), Response.bWasSuccessful);
+                    TestEqual(TEXT("Injected status code"), Response.ResponseCode, 503);
+                    Done.Execute();
+                }));
+
+            if (!FHttpBlueprintFunctionLibraryTestAccess::TryInjectRequestFault(URL, TEXT("GET"), TMap<FString, FString>(), Callback, Options))
+            {
+                AddError(TEXT("No fault was injected"));
+                Done.Execute();
+            }
+        });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
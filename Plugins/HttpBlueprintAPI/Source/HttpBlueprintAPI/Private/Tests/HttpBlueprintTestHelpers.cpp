@@ -0,0 +1,73 @@
+#include "HttpBlueprintTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpLoopbackRouter.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+
+namespace HttpBlueprintTestHelpersDetail
+{
+    constexpr uint32 FirstPort = 18650;
+    constexpr uint32 NumPorts = 20;
+
+    static FHttpRequestHandler MakeHandler(EHttpServerResponseCodes Code, const TCHAR* Body)
+    {
+        return FHttpRequestHandler::CreateLambda([Code, Body](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+            {
+                TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(FString(Body), TEXT("application/json"));
+                Response->Code = Code;
+                Response->Headers.Add(TEXT("X-HttpBlueprint-Test"), { TEXT("loopback") });
+                OnComplete(MoveTemp(Response));
+                return true;
+            });
+    }
+}
+
+bool FHttpLoopbackTestServer::Start()
+{
+    using namespace HttpBlueprintTestHelpersDetail;
+
+    Stop();
+
+    for (uint32 Candidate = FirstPort; Candidate < FirstPort + NumPorts && !Router.IsValid(); ++Candidate)
+    {
+        FString BindAddress;
+        Router = FHttpLoopbackRouter::Get(Candidate, BindAddress);
+        Port = Router.IsValid() ? Candidate : 0;
+    }
+    if (!Router.IsValid())
+    {
+        return false;
+    }
+
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/ok")), EHttpServerRequestVerbs::VERB_GET, MakeHandler(EHttpServerResponseCodes::Ok, OkBody)));
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/missing")), EHttpServerRequestVerbs::VERB_GET, MakeHandler(EHttpServerResponseCodes::NotFound, TEXT("{}"))));
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/error")), EHttpServerRequestVerbs::VERB_GET, MakeHandler(EHttpServerResponseCodes::ServerError, TEXT("{}"))));
+
+    FHttpServerModule::Get().StartAllListeners();
+    return true;
+}
+
+void FHttpLoopbackTestServer::Stop()
+{
+    if (Router.IsValid())
+    {
+        for (const FHttpRouteHandle& Route : Routes)
+        {
+            Router->UnbindRoute(Route);
+        }
+    }
+    Routes.Reset();
+    Router.Reset();
+    Port = 0;
+}
+
+FString FHttpLoopbackTestServer::GetURL(const TCHAR* Path) const
+{
+    return FString::Printf(TEXT("http://127.0.0.1:%u%s"), Port, Path);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpBlueprintSettings.h"
+#include "HttpRouteHandle.h"
+
+class IHttpRouter;
+
+/**
+ * Calls into UHttpBlueprintFunctionLibrary's private helpers for the automation tests
+ */
+struct FHttpBlueprintFunctionLibraryTestAccess
+{
+    static bool ValidateHttpRequest(const FString& URL, const FString& Method, FString& OutErrorMessage)
+    {
+        return UHttpBlueprintFunctionLibrary::ValidateHttpRequest(URL, Method, OutErrorMessage);
+    }
+
+    static FHttpResponseData ProcessHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+    {
+        return UHttpBlueprintFunctionLibrary::ProcessHttpResponse(Request, Response, bWasSuccessful);
+    }
+
+    static bool TryInjectRequestFault(const FString& URL, const FString& Method, const TMap<FString, FString>& Headers,
+        const FHttpResponseCallback& Callback, const FHttpRequestOptions& Options)
+    {
+        return UHttpBlueprintFunctionLibrary::TryInjectRequestFault(URL, Method, FString(), Headers, Callback, Options,
+            FHttpBlueprintRuntimeSettings::Get(), 0, 0);
+    }
+
+    static void OnHttpRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful,
+        const FHttpResponseCallback& Callback, const FHttpRequestOptions& Options)
+    {
+        UHttpBlueprintFunctionLibrary::OnHttpRequestComplete(Request, Response, bWasSuccessful, Callback, 0, 0, Options);
+    }
+};
+
+/**
+ * Calls into FHttpRequestSigner's private helpers for the automation tests
+ */
+struct FHttpRequestSignerTestAccess
+{
+    static FString CanonicalizeQuery(const FString& Query)
+    {
+        return FHttpRequestSigner::CanonicalizeQuery(Query);
+    }
+};
+
+/**
+ * Local HTTP server with fixed routes, so tests run without network variance
+ *
+ * - GET /ok: 200, a small JSON body and an X-HttpBlueprint-Test header
+ * - GET /missing: 404
+ * - GET /error: 500
+ */
+class FHttpLoopbackTestServer
+{
+public:
+
+    static constexpr const TCHAR* OkBody = TEXT("{\"status\":\"ok\",\"items\":[1,2,3]}");
+
+    ~FHttpLoopbackTestServer() { Stop(); }
+
+    /** Listen on the first free port of a small range on 127.0.0.1 */
+    bool Start();
+
+    void Stop();
+
+    /** e.g. GetURL(TEXT("/ok")) */
+    FString GetURL(const TCHAR* Path) const;
+
+private:
+
+    TSharedPtr<IHttpRouter> Router;
+    TArray<FHttpRouteHandle> Routes;
+    uint32 Port = 0;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,186 @@
+#include "HttpBlueprintTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpMemoryTracker.h"
+#include "HttpModule.h"
+#include "HttpRequestProfiler.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/AutomationTest.h"
+
+// =============================================================================
+// BUDGETS
+// =============================================================================
+
+namespace HttpRequestOverheadTestsDetail
+{
+    static TAutoConsoleVariable<float> CVarStartBudgetUs(
+        TEXT("HttpBlueprint.Perf.Budget.StartUs"),
+        250.0f,
+        TEXT("Average microseconds per request allowed in StartHttpRequest by the HttpBlueprint.Perf tests."));
+
+    static TAutoConsoleVariable<float> CVarCompletionBudgetUs(
+        TEXT("HttpBlueprint.Perf.Budget.CompletionUs"),
+        250.0f,
+        TEXT("Average microseconds per request allowed in OnHttpRequestComplete by the HttpBlueprint.Perf tests."));
+
+    static TAutoConsoleVariable<float> CVarDeliveryBudgetUs(
+        TEXT("HttpBlueprint.Perf.Budget.DeliveryUs"),
+        50.0f,
+        TEXT("Average microseconds per request allowed in DeliverResponse by the HttpBlueprint.Perf tests."));
+
+    static TAutoConsoleVariable<int32> CVarStartBudgetAllocs(
+        TEXT("HttpBlueprint.Perf.Budget.StartAllocs"),
+        200,
+        TEXT("Heap allocations per request allowed while starting a request (engine HTTP module included) by the HttpBlueprint.Perf tests."));
+
+    static TAutoConsoleVariable<int32> CVarCompletionBudgetAllocs(
+        TEXT("HttpBlueprint.Perf.Budget.CompletionAllocs"),
+        100,
+        TEXT("Heap allocations per request allowed in OnHttpRequestComplete by the HttpBlueprint.Perf tests."));
+
+    constexpr int32 NumRequests = 50;
+
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext
+        | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter;
+}
+
+// =============================================================================
+// REQUEST OVERHEAD
+// =============================================================================
+
+/**
+ * Per-request time and allocations of the plugin's own request path, against FHttpLoopbackTestServer
+ * Fails when a phase average is over its HttpBlueprint.Perf.Budget.* budget, so a regression
+ * fails the automation run instead of only logging.
+ */
+BEGIN_DEFINE_SPEC(FHttpRequestOverheadSpec, "HttpBlueprint.Perf.RequestOverhead",
+    HttpRequestOverheadTestsDetail::TestFlags)
+
+    FHttpLoopbackTestServer Server;
+
+    void ExpectAllocationsWithin(const TCHAR* What, uint64 Allocations, int32 BudgetPerRequest);
+
+END_DEFINE_SPEC(FHttpRequestOverheadSpec)
+
+void FHttpRequestOverheadSpec::ExpectAllocationsWithin(const TCHAR* What, uint64 Allocations, int32 BudgetPerRequest)
+{
+    if (!FHttpAllocationCounter::IsAvailable())
+    {
+        AddWarning(FString::Printf(TEXT("%s: allocations are not counted; run with -HttpBlueprintCountAllocs to check their budget"), What));
+        return;
+    }
+
+    const double PerRequest = (double)Allocations / HttpRequestOverheadTestsDetail::NumRequests;
+    AddInfo(FString::Printf(TEXT("%s: %.1f allocations per request (budget %d)"), What, PerRequest, BudgetPerRequest));
+    if (BudgetPerRequest > 0 && PerRequest > BudgetPerRequest)
+    {
+        AddError(FString::Printf(TEXT("%s: %.1f allocations per request is over the budget of %d"), What, PerRequest, BudgetPerRequest));
+    }
+}
+
+void FHttpRequestOverheadSpec::Define()
+{
+    using namespace HttpRequestOverheadTestsDetail;
+
+    BeforeEach([this]()
+        {
+            TestTrue(TEXT("Loopback server started"), Server.Start());
+            FHttpRequestProfiler::Reset();
+        });
+
+    AfterEach([this]()
+        {
+            Server.Stop();
+        });
+
+    LatentIt(TEXT("keeps start, completion and delivery time within budget"), FTimespan::FromSeconds(30.0), [this](const FDoneDelegate& Done)
+        {
+            TSharedRef<int32> Remaining = MakeShared<int32>(NumRequests);
+            const FOnHttpResponseNative OnResponse = FOnHttpResponseNative::CreateLambda([this, Remaining, Done](const FHttpResponseData& Response)
+                {
+                    TestEqual(TEXT("Loopback status code"), Response.ResponseCode, 200);
+                    if (--(*Remaining) > 0)
+                    {
+                        return;
+                    }
+
+                    // Delivery of this last response is recorded once the callback returns
+                    AsyncTask(ENamedThreads::GameThread, [this, Done]()
+                        {
+                            const double Budgets[] = { CVarStartBudgetUs.GetValueOnGameThread(), CVarCompletionBudgetUs.GetValueOnGameThread(), CVarDeliveryBudgetUs.GetValueOnGameThread() };
+
+                            TArray<FString> Failures;
+                            TestTrue(TEXT("Overhead within budget"), FHttpRequestProfiler::CheckBudget(Budgets, Failures));
+                            for (const FString& Failure : Failures)
+                            {
+                                AddError(Failure);
+                            }
+                            Done.Execute();
+                        });
+                });
+
+            uint64 StartAllocations = 0;
+            {
+                FHttpAllocationCounter Counter;
+                for (int32 Index = 0; Index < NumRequests; ++Index)
+                {
+                    UHttpBlueprintFunctionLibrary::MakeHttpRequestNative(Server.GetURL(TEXT("/ok")), TEXT("GET"), FString(),
+                        TMap<FString, FString>(), FHttpRequestOptions(), OnResponse);
+                }
+                StartAllocations = Counter.GetCount();
+            }
+            ExpectAllocationsWithin(TEXT("Start"), StartAllocations, CVarStartBudgetAllocs.GetValueOnGameThread());
+        });
+
+    LatentIt(TEXT("keeps completion allocations within budget"), FTimespan::FromSeconds(30.0), [this](const FDoneDelegate& Done)
+        {
+            // Complete one real loopback exchange, then replay it through the completion path
+            TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+            Request->SetURL(Server.GetURL(TEXT("/ok")));
+            Request->SetVerb(TEXT("GET"));
+            Request->OnProcessRequestComplete().BindLambda([this, Done](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+                {
+                    if (!TestTrue(TEXT("Loopback request succeeded"), bWasSuccessful && Response.IsValid()))
+                    {
+                        Done.Execute();
+                        return;
+                    }
+
+                    TSharedRef<int32> Remaining = MakeShared<int32>(NumRequests);
+                    const FHttpResponseCallback Callback(FOnHttpResponseNative::CreateLambda([Remaining, Done](const FHttpResponseData& Response)
+                        {
+                            if (--(*Remaining) == 0)
+                            {
+                                Done.Execute();
+                            }
+                        }));
+
+                    uint64 CompletionAllocations = 0;
+                    {
+                        FHttpAllocationCounter Counter;
+                        for (int32 Index = 0; Index < NumRequests; ++Index)
+                        {
+                            // Balance the in-flight gauges the completion path releases
+                            FHttpMemoryTracker::AddRequestsInFlight(1);
+                            FHttpMemoryTracker::AddBodyBytes(Request->GetContent().Num());
+                            FHttpBlueprintFunctionLibraryTestAccess::OnHttpRequestComplete(Request, Response, true, Callback, FHttpRequestOptions());
+                        }
+                        CompletionAllocations = Counter.GetCount();
+                    }
+                    ExpectAllocationsWithin(TEXT("Completion"), CompletionAllocations, CVarCompletionBudgetAllocs.GetValueOnGameThread());
+                });
+
+            if (!Request->ProcessRequest())
+            {
+                AddError(TEXT("Could not start the loopback request"));
+                Done.Execute();
+            }
+        });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
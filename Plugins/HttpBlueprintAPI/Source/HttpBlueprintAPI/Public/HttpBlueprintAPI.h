@@ -4,6 +4,8 @@
 
 #include "Modules/ModuleManager.h"
 
+HTTPBLUEPRINTAPI_API DECLARE_LOG_CATEGORY_EXTERN(LogHttpBlueprintAPI, Log, All);
+
 class FHttpBlueprintAPIModule : public IModuleInterface
 {
 public:
@@ -3,8 +3,14 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Http.h"
+#include "HttpRequestSigning.h"
+#include "HttpRequestOptions.h"
+#include "HttpJsonStreamReader.h"
 #include "HttpBlueprintFunctionLibrary.generated.h"
 
+struct FHttpPipelineOutput;
+struct FHttpBlueprintRuntimeSettings;
+
 /**
  * Blueprint delegate that gets called when an HTTP request completes
  * This is the "callback function" that Blueprints can hook into
@@ -23,6 +29,83 @@ DECLARE_DYNAMIC_DELEGATE_FourParams(
     FString, ErrorMessage
 );
 
+/**
+ * Blueprint delegate that receives elements of a streamed JSON array while it downloads
+ *
+ * Parameters:
+ * - Elements: JSON text of each element in this batch
+ * - FirstIndex: Index of the first element within the whole array
+ */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(
+    FOnHttpJsonElementsReceived,
+    const TArray<FString>&, Elements,
+    int32, FirstIndex
+);
+
+/**
+ * Blueprint delegate that receives fields extracted from a JSON response
+ *
+ * Parameters:
+ * - bWasSuccessful: True if the request completed successfully and every field was found
+ * - ResponseCode: HTTP status code
+ * - Fields: Value of each path that was found (strings unquoted, objects and arrays as JSON)
+ * - ErrorMessage: Description of any error that occurred
+ */
+DECLARE_DYNAMIC_DELEGATE_FourParams(
+    FOnHttpFieldsReceived,
+    bool, bWasSuccessful,
+    int32, ResponseCode,
+    const TMap<FString, FString>&, Fields,
+    FString, ErrorMessage
+);
+
+/**
+ * Why a request failed, so retry and error handling can branch without parsing messages
+ * Engine HTTP backends report DNS, TCP and TLS failures alike, so all of them are ConnectionFailed.
+ */
+UENUM(BlueprintType)
+enum class EHttpErrorKind : uint8
+{
+    /** The request succeeded */
+    None                    UMETA(DisplayName = "None"),
+
+    /** Rejected before it was sent (bad URL or method, signing failure, request could not be started) */
+    InvalidRequest          UMETA(DisplayName = "Invalid Request"),
+
+    /** Could not reach the server: DNS lookup, TCP connect or TLS handshake failed */
+    ConnectionFailed        UMETA(DisplayName = "Connection Failed"),
+
+    /** The request or activity timeout elapsed (ErrorValue/ErrorLimit hold elapsed/timeout milliseconds) */
+    Timeout                 UMETA(DisplayName = "Timeout"),
+
+    /** The request was cancelled before it completed */
+    Cancelled               UMETA(DisplayName = "Cancelled"),
+
+    /** Failed at the network level for any other reason */
+    NetworkError            UMETA(DisplayName = "Network Error"),
+
+    /** 4xx response */
+    HttpClientError         UMETA(DisplayName = "HTTP Client Error (4xx)"),
+
+    /** 5xx response */
+    HttpServerError         UMETA(DisplayName = "HTTP Server Error (5xx)"),
+
+    /** Any other response outside 2xx (1xx, unfollowed 3xx, nonstandard codes) */
+    HttpUnexpectedStatus    UMETA(DisplayName = "HTTP Unexpected Status"),
+
+    /** The body is over a size limit (ErrorValue/ErrorLimit hold body/limit bytes) */
+    BodyTooLarge            UMETA(DisplayName = "Body Too Large"),
+
+    /** The body could not be decompressed, decoded or parsed */
+    DecodeError             UMETA(DisplayName = "Decode Error"),
+
+    /** A custom response pipeline stage rejected the response */
+    PipelineStageFailed     UMETA(DisplayName = "Pipeline Stage Failed"),
+
+    /** Fixture replay is active and no fixture was recorded for the request */
+    FixtureMissing          UMETA(DisplayName = "Fixture Missing")
+};
+
 /**
  * Structure to hold HTTP response data in a Blueprint-friendly format
  */
@@ -43,7 +126,22 @@ struct HTTPBLUEPRINTAPI_API FHttpResponseData
     UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
     FString ResponseBody;
 
-    /** Error message if the request failed */
+    /** Why the request failed (None if it succeeded) */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+
+    /** Measured value behind ErrorKind (elapsed milliseconds for Timeout, body bytes for BodyTooLarge) */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
+    int64 ErrorValue = 0;
+
+    /** Limit behind ErrorKind (timeout milliseconds for Timeout, maximum body bytes for BodyTooLarge) */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
+    int64 ErrorLimit = 0;
+
+    /**
+     * Details that cannot be rebuilt from ErrorKind (e.g., parser errors)
+     * Usually empty; GetErrorMessage formats a message from ErrorKind when it is
+     */
     UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
     FString ErrorMessage;
 
@@ -54,6 +152,66 @@ struct HTTPBLUEPRINTAPI_API FHttpResponseData
     /** HTTP response headers */
     UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
     TMap<FString, FString> ResponseHeaders;
+
+    /** Values of FHttpRequestOptions::ExtractFields paths found in the body, keyed by path */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
+    TMap<FString, FString> ExtractedFields;
+
+    /** Served from the cache past its lifetime (FHttpRequestOptions::CachePolicy); a refresh may follow */
+    UPROPERTY(BlueprintReadOnly, Category = "HTTP Response")
+    bool bIsStale = false;
+
+    /** Decoded body, JSON and struct produced by FHttpRequestOptions::Pipeline (C++ only; null if no pipeline ran) */
+    TSharedPtr<const FHttpPipelineOutput> PipelineOutput;
+
+    /**
+     * Error message of a failed request, formatted only when asked for
+     * (e.g., "HTTP Error 404: Not Found"); empty for successful requests
+     */
+    FString GetErrorMessage() const;
+
+    /** Mark the response as failed */
+    void SetError(EHttpErrorKind Kind, int64 Value = 0, int64 Limit = 0);
+
+    /** Message for an error, from ErrorKind and its detail fields alone */
+    static FString FormatErrorMessage(EHttpErrorKind Kind, int32 ResponseCode, int64 Value, int64 Limit);
+};
+
+/**
+ * Blueprint delegate that receives the whole response, including ErrorKind
+ *
+ * Parameters:
+ * - Response: Status, body, headers and structured error of the request
+ */
+DECLARE_DYNAMIC_DELEGATE_OneParam(
+    FOnHttpResponseDataReceived,
+    const FHttpResponseData&, Response
+);
+
+/**
+ * Native (C++) delegate that gets called when an HTTP request completes
+ * Runs on the thread selected by FHttpRequestOptions::CompletionThread
+ */
+DECLARE_DELEGATE_OneParam(FOnHttpResponseNative, const FHttpResponseData& /*Response*/);
+
+/**
+ * Completion target carried through the request pipeline: a Blueprint delegate or a native delegate
+ */
+struct HTTPBLUEPRINTAPI_API FHttpResponseCallback
+{
+    FOnHttpResponseReceived BlueprintDelegate;
+    FOnHttpResponseNative NativeDelegate;
+
+    FHttpResponseCallback() = default;
+    FHttpResponseCallback(const FOnHttpResponseReceived& InDelegate) : BlueprintDelegate(InDelegate) {}
+    FHttpResponseCallback(const FOnHttpResponseNative& InDelegate) : NativeDelegate(InDelegate) {}
+
+    bool IsBound() const { return BlueprintDelegate.IsBound() || NativeDelegate.IsBound(); }
+
+    /** Blueprint delegates may only run on the game thread */
+    bool RequiresGameThread() const { return BlueprintDelegate.IsBound(); }
+
+    void Execute(const FHttpResponseData& ResponseData) const;
 };
 
 /**
@@ -131,6 +289,247 @@ public:
         UObject* WorldContextObject = nullptr
     );
 
+    /**
+     * Make an HTTP request with custom headers and per-request options
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param Options - Per-request settings (e.g., callback priority)
+     * @param OnResponseReceived - Blueprint delegate that gets called when response arrives; it cannot tell a stale
+     *                             cached response (Options.CachePolicy) from a fresh one, use Make HTTP Request with
+     *                             Response Struct and its Is Stale flag for that
+     * @param WorldContextObject - Reference to the game world
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP",
+        Meta = (DisplayName = "Make HTTP Request with Options",
+            CallInEditor = true,
+            Keywords = "http request api web headers options priority"))
+    static void MakeHttpRequestWithOptions(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FOnHttpResponseReceived& OnResponseReceived,
+        UObject* WorldContextObject = nullptr
+    );
+
+    /**
+     * Make an HTTP request and receive the whole response struct
+     *
+     * Use this instead of the string-based callback to branch on ErrorKind (e.g., to retry
+     * only timeouts and 5xx responses) without parsing the error message.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param Options - Per-request settings (e.g., callback priority)
+     * @param OnResponse - Blueprint delegate that gets called with the response
+     * @param WorldContextObject - Reference to the game world
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP",
+        Meta = (DisplayName = "Make HTTP Request with Response Struct",
+            CallInEditor = true,
+            Keywords = "http request api web headers options error kind retry"))
+    static void MakeHttpRequestWithResponse(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FOnHttpResponseDataReceived& OnResponse,
+        UObject* WorldContextObject = nullptr
+    );
+
+    /**
+     * Make an HTTP request and receive only a few fields of its JSON response
+     *
+     * The body is scanned once for the requested paths and never parsed into JSON objects,
+     * which is much cheaper than parsing a large response to read one or two values.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param Paths - JSON paths to extract, e.g. "data.version", "items[0].id", "meta['build.id']"
+     * @param OnFieldsReceived - Blueprint delegate that gets called with the extracted values
+     * @param WorldContextObject - Reference to the game world
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP",
+        Meta = (DisplayName = "Make HTTP Request and Extract Fields",
+            CallInEditor = true,
+            Keywords = "http request api web json path extract field projection"))
+    static void MakeHttpRequestAndExtractFields(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const TArray<FString>& Paths,
+        const FOnHttpFieldsReceived& OnFieldsReceived,
+        UObject* WorldContextObject = nullptr
+    );
+
+    /**
+     * Make an HTTP request from C++ with a native completion delegate
+     *
+     * Unlike the Blueprint nodes, the delegate receives the full FHttpResponseData and can run
+     * off the game thread (Options.CompletionThread), in which case the response is processed
+     * on the HTTP thread and never touches the game thread.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param Options - Per-request settings (completion thread, callback priority)
+     * @param OnResponse - Native delegate that gets called when the response arrives
+     */
+    static void MakeHttpRequestNative(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FOnHttpResponseNative& OnResponse
+    );
+
+    /**
+     * Make an HTTP request whose JSON array response is handed over in batches while it downloads
+     *
+     * The body is never buffered in full: elements are split out as chunks arrive, so a UI can
+     * start filling in before the download finishes and memory stays bounded for huge arrays.
+     * OnResponseReceived is called last, with an empty ResponseBody.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param ArrayField - Field of the top-level object holding the array (empty if the body is the array)
+     * @param BatchSize - Elements per batch (0 = HttpBlueprint.Stream.BatchSize)
+     * @param OnElementsReceived - Blueprint delegate that gets called for each batch of elements, in order
+     * @param OnResponseReceived - Blueprint delegate that gets called when the request completes
+     * @param WorldContextObject - Reference to the game world
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP",
+        Meta = (DisplayName = "Make Streaming JSON Request",
+            CallInEditor = true,
+            Keywords = "http request api web json stream array batch large"))
+    static void MakeStreamingJsonRequest(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FString& ArrayField,
+        int32 BatchSize,
+        const FOnHttpJsonElementsReceived& OnElementsReceived,
+        const FOnHttpResponseReceived& OnResponseReceived,
+        UObject* WorldContextObject = nullptr
+    );
+
+    /**
+     * Make a streaming JSON request from C++ with native delegates
+     *
+     * Batches hold the raw UTF-8 text of each element (see FHttpStructDeserializer::ReadStruct)
+     * and are delivered on Options.CompletionThread. Use NamedPipe rather than AnyWorker if
+     * batches must be handled one at a time, in order.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (empty for GET requests)
+     * @param Headers - Custom headers to include with the request
+     * @param Options - Per-request settings (completion thread, callback priority)
+     * @param ArrayField - Field of the top-level object holding the array (empty if the body is the array)
+     * @param BatchSize - Elements per batch (0 = HttpBlueprint.Stream.BatchSize)
+     * @param OnBatch - Native delegate that gets called for each batch of elements
+     * @param OnResponse - Native delegate that gets called when the request completes
+     */
+    static void MakeStreamingJsonRequestNative(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FString& ArrayField,
+        int32 BatchSize,
+        const FOnHttpJsonBatchNative& OnBatch,
+        const FOnHttpResponseNative& OnResponse
+    );
+
+    /**
+     * Make an HTTP request that is signed with HMAC-SHA256 before it is sent
+     *
+     * Body hashing and signing run on a worker thread, so large bodies (including bodies
+     * streamed from SigningConfig.BodyFilePath) never block the game thread.
+     *
+     * @param URL - The web address to request from
+     * @param Method - HTTP method (GET, POST, PUT, DELETE)
+     * @param RequestBody - Data to send (ignored when SigningConfig.BodyFilePath is set)
+     * @param Headers - Custom headers to include with the request (Content-Type is signed)
+     * @param SigningConfig - Credentials and signing scheme (AWS SigV4 or custom HMAC)
+     * @param OnResponseReceived - Blueprint delegate that gets called when response arrives
+     * @param WorldContextObject - Reference to the game world
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP",
+        Meta = (DisplayName = "Make Signed HTTP Request",
+            CallInEditor = true,
+            Keywords = "http request api web headers auth hmac sigv4 sign"))
+    static void MakeSignedHttpRequest(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpSigningConfig& SigningConfig,
+        const FOnHttpResponseReceived& OnResponseReceived,
+        UObject* WorldContextObject = nullptr
+    );
+
+    // =============================================================================
+    // PREFETCH AND CACHE
+    // Warm the response cache while the game is idle; later GET requests to the same URLs
+    // with a cache policy are answered from memory
+    // =============================================================================
+
+    /**
+     * Fetch URLs in the background into the response cache
+     * Prefetches only run while few other requests are in flight, at low priority. Only requests
+     * with a Cache Policy other than Default are answered from the cache.
+     *
+     * @param URLs - GET URLs that are likely to be requested soon (e.g., the next menu's data)
+     * @return Number of URLs queued (already cached or queued URLs are skipped)
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Cache",
+        Meta = (DisplayName = "Prefetch HTTP URLs", Keywords = "http prefetch cache warm preload"))
+    static int32 PrefetchHttpUrls(const TArray<FString>& URLs);
+
+    /**
+     * Prefetch a route template once per value
+     * E.g. "https://api.example.com/items/{id}" with Parameter "id" and Values ["1", "2"]
+     *
+     * @param RouteTemplate - URL with a {Parameter} placeholder
+     * @param Parameter - Name of the placeholder, without braces
+     * @param Values - Values substituted for the placeholder (URL-encoded)
+     * @return Number of URLs queued
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Cache",
+        Meta = (DisplayName = "Prefetch HTTP Route", Keywords = "http prefetch cache warm preload route template"))
+    static int32 PrefetchHttpRoute(const FString& RouteTemplate, const FString& Parameter, const TArray<FString>& Values);
+
+    /**
+     * Cancel every queued or sent prefetch (e.g., when the player leaves the menu they were for)
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Cache",
+        Meta = (DisplayName = "Cancel HTTP Prefetches"))
+    static void CancelHttpPrefetches();
+
+    /**
+     * Drop every cached response
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Cache",
+        Meta = (DisplayName = "Clear HTTP Response Cache"))
+    static void ClearHttpResponseCache();
+
     // =============================================================================
     // UTILITY FUNCTIONS
     // =============================================================================
@@ -156,6 +555,58 @@ public:
         Meta = (DisplayName = "Get HTTP Response Description"))
     static FString GetHttpResponseCodeDescription(int32 ResponseCode);
 
+    /**
+     * Get the description of an HTTP response code as text, without allocating
+     *
+     * @param ResponseCode - The HTTP response code
+     * @return Registered reason phrase, or "HTTP <Code>" for unregistered codes
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities", BlueprintPure,
+        Meta = (DisplayName = "Get HTTP Response Description (Text)"))
+    static FText GetHttpResponseCodeText(int32 ResponseCode);
+
+    /**
+     * Get the registered reason phrase of an HTTP response code as a name, without allocating
+     * Cheap to compare and switch on (e.g., against "Too Many Requests")
+     *
+     * @param ResponseCode - The HTTP response code
+     * @return Reason phrase, or None if the code is not in the IANA registry
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities", BlueprintPure,
+        Meta = (DisplayName = "Get HTTP Response Reason Name"))
+    static FName GetHttpResponseCodeName(int32 ResponseCode);
+
+    /**
+     * Get the error kind of an HTTP response code
+     *
+     * @param ResponseCode - The HTTP response code
+     * @return None for 2xx, HttpClientError for 4xx, HttpServerError for 5xx, HttpUnexpectedStatus otherwise
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities", BlueprintPure,
+        Meta = (DisplayName = "Get HTTP Error Kind for Status"))
+    static EHttpErrorKind GetHttpErrorKindForStatus(int32 ResponseCode);
+
+    /**
+     * Check whether sending a failed request again may succeed
+     * True for connection failures, timeouts, other network errors, 408, 429 and 5xx other than 501/505
+     *
+     * @param Response - The failed response
+     * @return True if the request is worth retrying
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities", BlueprintPure,
+        Meta = (DisplayName = "Is HTTP Error Retryable"))
+    static bool IsHttpErrorRetryable(const FHttpResponseData& Response);
+
+    /**
+     * Get a readable message for a failed response (formatted on demand)
+     *
+     * @param Response - The response
+     * @return Error message, or empty if the request succeeded
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities", BlueprintPure,
+        Meta = (DisplayName = "Get HTTP Error Message"))
+    static FString GetHttpErrorMessage(const FHttpResponseData& Response);
+
     /**
      * Parse a URL to extract the base domain
      *
@@ -176,13 +627,65 @@ public:
         Meta = (DisplayName = "Is Valid URL"))
     static bool IsValidURL(const FString& URL);
 
+    /**
+     * Extract a few values from a JSON string by path, without parsing the whole document
+     *
+     * @param Json - JSON text (e.g., a Response Body)
+     * @param Paths - JSON paths, e.g. "data.version", "items[0].id", "meta['build.id']"
+     * @param OutValues - Value of each path that was found (strings unquoted, objects and arrays as JSON)
+     * @return True if every path was found
+     */
+    UFUNCTION(BlueprintCallable, Category = "HTTP|Utilities",
+        Meta = (DisplayName = "Extract JSON Fields", Keywords = "json path field value extract"))
+    static bool ExtractJsonFields(const FString& Json, const TArray<FString>& Paths, TMap<FString, FString>& OutValues);
+
 private:
 
+    /** Automation tests (HttpBlueprint.Unit, HttpBlueprint.Perf) reach the internal helpers through this */
+    friend struct FHttpBlueprintFunctionLibraryTestAccess;
+
+    /** Keeps the requests it sends, so cancelling prefetches stops them */
+    friend class FHttpPrefetcher;
+
     // =============================================================================
     // INTERNAL CALLBACK HANDLERS
     // These functions handle the raw HTTP responses and convert them to Blueprint format
     // =============================================================================
 
+    /**
+     * Validate, create and send a request (shared by all public request functions)
+     * The request is attributed to the calling Blueprint, or to WorldContextObject outside of script
+     * @return The request sent, or null if it was answered without one (invalid, recorded, cached or fault-injected)
+     */
+    static FHttpRequestPtr StartHttpRequest(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FHttpResponseCallback& Callback,
+        const UObject* WorldContextObject = nullptr
+    );
+
+    /**
+     * Report the time to first byte of a sent request to the traffic inspector (only while one is open)
+     */
+    static void BindTrafficMonitor(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+        uint32 RequestId
+    );
+
+    /**
+     * Count a request in flight (FHttpMemoryTracker) and start it
+     * OnHttpRequestComplete releases the count; it also runs for requests that fail to start,
+     * so a failed start is reported through the completion delegate and nowhere else
+     *
+     * @return False if the request could not be started
+     */
+    static bool ProcessTrackedRequest(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request
+    );
+
     /**
      * Internal callback that gets called when HTTP request completes
      * This processes the raw HTTP response and calls the user's Blueprint delegate
@@ -191,7 +694,158 @@ private:
         FHttpRequestPtr Request,
         FHttpResponsePtr Response,
         bool bWasSuccessful,
-        FOnHttpResponseReceived UserCallback
+        FHttpResponseCallback Callback,
+        uint32 RequestId,
+        uint32 CallSiteId,
+        FHttpRequestOptions Options
+    );
+
+    /**
+     * Hand a processed response to the user's delegate
+     * Game-thread callbacks run through the per-frame dispatch budget in Options.CallbackPriority order;
+     * native delegates may instead run on a worker (Options.CompletionThread)
+     */
+    static void DeliverResponse(
+        const FHttpResponseData& ResponseData,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        uint32 RequestId = 0
+    );
+
+    /**
+     * Deliver a processed response after a delay (0 delivers immediately)
+     * Used to reproduce recorded or injected latency without blocking a thread
+     */
+    static void DeliverResponseAfter(
+        const FHttpResponseData& ResponseData,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        float DelaySeconds,
+        uint32 RequestId = 0
+    );
+
+    /**
+     * Fill ResponseData.ExtractedFields from Options.ExtractFields
+     */
+    static void ExtractResponseFields(
+        FHttpResponseData& ResponseData,
+        TArrayView<const uint8> Body,
+        const FHttpRequestOptions& Options
+    );
+
+    /**
+     * Fail a request locally when fault injection drops it or returns a synthetic status
+     * @return True if the request was answered and must not be sent
+     */
+    static bool TryInjectRequestFault(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const TMap<FString, FString>& Headers,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        const FHttpBlueprintRuntimeSettings& Settings,
+        uint32 RequestId,
+        uint32 CallSiteId
+    );
+
+    /**
+     * Answer a request from recorded traffic (fixtures or HAR replay) instead of the network
+     * @return True if the request was answered and must not be sent
+     */
+    static bool TryServeRecordedResponse(
+        const FString& URL,
+        const FString& Method,
+        const FString& RequestBody,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        const FHttpBlueprintRuntimeSettings& Settings,
+        uint32 RequestId,
+        uint32 CallSiteId
+    );
+
+    /**
+     * Answer a GET request from the response cache (fresh entries, or stale ones under a stale-while-revalidate policy)
+     * Only requests with a cache policy other than Default look up the cache
+     * @return True if the request was answered and must not be sent
+     */
+    static bool TryServeCachedResponse(
+        const FString& URL,
+        const FString& Method,
+        const TMap<FString, FString>& Headers,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        const FHttpBlueprintRuntimeSettings& Settings,
+        uint32 RequestId,
+        uint32 CallSiteId
+    );
+
+    /**
+     * Refresh a stale cached response in the background (once per URL at a time)
+     * Sends RequestHeaders (the original request's) with conditional headers added. Updates the cache,
+     * and calls Callback again with a changed response for StaleWhileRevalidateAndNotify
+     */
+    static void RevalidateCachedResponse(
+        const FString& URL,
+        const TMap<FString, FString>& RequestHeaders,
+        const FHttpResponseData& CachedResponse,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options
+    );
+
+    /**
+     * Deliver a cached response in place of a failed GET within its stale-if-error window
+     * (stale cache policies only); Vary is matched against the headers the request was sent with
+     * @return True if the stale response was delivered instead of the failure
+     */
+    static bool TryServeStaleOnError(
+        const IHttpRequest& Request,
+        const FHttpResponseData& FailedResponse,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        float DelaySeconds,
+        uint32 RequestId
+    );
+
+    /**
+     * As above, for a request that failed before it was created (injected faults)
+     * Vary is matched against the caller's headers and the defaults CreateHttpRequest would add
+     */
+    static bool TryServeStaleOnError(
+        const FString& URL,
+        const FString& Method,
+        const TMap<FString, FString>& Headers,
+        const FHttpResponseData& FailedResponse,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        float DelaySeconds,
+        uint32 RequestId
+    );
+
+    /** Shared by both TryServeStaleOnError overloads; GetRequestHeader resolves the cached response's Vary headers */
+    static bool ServeStaleOnError(
+        const FString& URL,
+        const FString& Method,
+        TFunctionRef<FString(const FString&)> GetRequestHeader,
+        const FHttpResponseData& FailedResponse,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        float DelaySeconds,
+        uint32 RequestId
+    );
+
+    /**
+     * Deliver a response that was not received from the network (recorded or cached)
+     * Runs the same transcoding, field extraction, JSON streaming and pipeline as live responses;
+     * RawBody holds a recorded binary body, which is transcoded to ResponseBody first
+     */
+    static void DeliverStoredResponse(
+        FHttpResponseData ResponseData,
+        const FHttpResponseCallback& Callback,
+        const FHttpRequestOptions& Options,
+        float DelaySeconds,
+        uint32 RequestId,
+        TArray<uint8> RawBody = TArray<uint8>()
     );
 
     /**
@@ -205,12 +859,28 @@ private:
 
     /**
      * Helper function to create and configure an HTTP request
+     * With a binary PayloadFormat, a JSON body is re-encoded and Accept/Content-Type are negotiated
+     * (Protobuf bodies are encoded through RequestSchema)
+     * Settings is the snapshot the caller loaded for this request
      */
     static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest(
         const FString& URL,
         const FString& Method,
         const FString& RequestBody,
-        const TMap<FString, FString>& Headers
+        const TMap<FString, FString>& Headers,
+        const FHttpBlueprintRuntimeSettings& Settings,
+        EHttpPayloadFormat PayloadFormat = EHttpPayloadFormat::Json,
+        const UScriptStruct* RequestSchema = nullptr
+    );
+
+    /**
+     * Value a request header will be sent with: the caller's, or the default CreateHttpRequest adds
+     * Lets the response cache match Vary headers before the request exists
+     */
+    static FString GetSentRequestHeader(
+        const TMap<FString, FString>& Headers,
+        const FHttpRequestOptions& Options,
+        const FString& Name
     );
 
     /**
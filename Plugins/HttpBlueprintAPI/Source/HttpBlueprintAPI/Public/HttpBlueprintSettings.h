@@ -0,0 +1,272 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "HttpBlueprintSettings.generated.h"
+
+/**
+ * Immutable copy of every plugin tunable
+ *
+ * Built on the game thread whenever a HttpBlueprint.* console variable changes and
+ * published with a single atomic pointer swap, so hot paths on any thread read
+ * settings without taking a lock. Superseded snapshots are kept alive until module
+ * shutdown; settings change rarely, so this costs a few hundred bytes per change.
+ */
+struct HTTPBLUEPRINTAPI_API FHttpBlueprintRuntimeSettings
+{
+    // Requests
+    float RequestTimeoutSeconds = 30.0f;
+    float ActivityTimeoutSeconds = 0.0f;
+    FString UserAgent = TEXT("UnrealEngine/5.0 HttpBlueprintAPI/1.0");
+    FString DefaultContentType = TEXT("application/json");
+
+    // Logging
+    float LogSampleRate = 1.0f;
+    float LogFailureSampleRate = 1.0f;
+    int32 LogMaxBodyBytes = 1024;
+
+    // HAR capture/replay
+    int32 HarMaxQueuedBytes = 32 * 1024 * 1024;
+    int32 HarMaxBodyBytes = 1024 * 1024;
+    float HarReplayLatencyScale = 1.0f;
+    bool bHarIncludeCredentials = false;
+
+    // Fixtures
+    int32 FixtureMode = 0;
+    FString FixtureDirectory;
+    bool bFixtureSimulateTiming = false;
+
+    // Callback dispatch
+    float DispatchBudgetMs = 4.0f;
+
+    // Response pipeline
+    int32 PipelineMaxInFlight = 8;
+
+    // Streaming JSON
+    int32 StreamBatchSize = 256;
+
+    // Tracing
+    bool bTraceEnabled = false;
+    float TraceSampleRate = 0.01f;
+    FString TraceRouteSampleRates;
+    FString TraceState;
+
+    /** TraceRouteSampleRates parsed into (URL wildcard, sample rate) rules, in order */
+    TArray<TPair<FString, float>> TraceRouteRules;
+
+    // Metrics export
+    float MetricsIntervalSeconds = 10.0f;
+    FString MetricsPrometheusFile;
+    int32 MetricsPrometheusPort = 0;
+    FString MetricsStatsDAddress;
+
+    // Response cache and prefetch
+    int32 CacheMaxBytes = 16 * 1024 * 1024;
+    float CacheDefaultTtlSeconds = 300.0f;
+    float CacheStaleWhileRevalidateSeconds = 3600.0f;
+    float CacheStaleIfErrorSeconds = 86400.0f;
+    int32 PrefetchMaxInteractiveInFlight = 2;
+    int32 PrefetchMaxConcurrent = 2;
+
+    /**
+     * Current snapshot. Lock-free; safe on any thread
+     *
+     * Load it once per request and pass the reference down, so one request never
+     * mixes values from two snapshots.
+     */
+    static const FHttpBlueprintRuntimeSettings& Get();
+
+    /** Push project settings and command line overrides into the console variables, then publish */
+    static void Initialize();
+
+    /** Rebuild the snapshot from the console variables and publish it (game thread) */
+    static void Refresh();
+
+    /** Free retired snapshots. Only call when no other thread can be reading settings */
+    static void Shutdown();
+
+    bool operator==(const FHttpBlueprintRuntimeSettings& Other) const;
+};
+
+/**
+ * Project Settings > Plugins > HTTP Blueprint API
+ *
+ * Every property is mirrored by a console variable (shown in its tooltip). The ini value
+ * is applied to the console variable at startup with project-setting priority, so the
+ * console, device profiles and the command line can still override it live.
+ */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "HTTP Blueprint API"))
+class HTTPBLUEPRINTAPI_API UHttpBlueprintSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+
+    UHttpBlueprintSettings();
+
+    /** Push all properties into their console variables */
+    void ApplyToConsoleVariables() const;
+
+    //~ Begin UDeveloperSettings Interface
+    virtual FName GetCategoryName() const override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+    //~ End UDeveloperSettings Interface
+
+    // =============================================================================
+    // REQUESTS
+    // =============================================================================
+
+    /** Total time (seconds) a request may take before it fails */
+    UPROPERTY(config, EditAnywhere, Category = "Requests", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Request.TimeoutSeconds"))
+    float RequestTimeoutSeconds = 30.0f;
+
+    /** Time (seconds) without any data received before a request fails (0 = engine default) */
+    UPROPERTY(config, EditAnywhere, Category = "Requests", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Request.ActivityTimeoutSeconds"))
+    float ActivityTimeoutSeconds = 0.0f;
+
+    /** User-Agent sent when the caller does not provide one */
+    UPROPERTY(config, EditAnywhere, Category = "Requests", meta = (ConsoleVariable = "HttpBlueprint.Request.UserAgent"))
+    FString UserAgent = TEXT("UnrealEngine/5.0 HttpBlueprintAPI/1.0");
+
+    /** Content-Type used by Make HTTP GET/POST Request when none is given */
+    UPROPERTY(config, EditAnywhere, Category = "Requests", meta = (ConsoleVariable = "HttpBlueprint.Request.DefaultContentType"))
+    FString DefaultContentType = TEXT("application/json");
+
+    // =============================================================================
+    // LOGGING
+    // =============================================================================
+
+    /** Fraction (0-1) of successful requests that are logged */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "0", ClampMax = "1", ConsoleVariable = "HttpBlueprint.Log.SampleRate"))
+    float LogSampleRate = 1.0f;
+
+    /** Fraction (0-1) of failed requests that are logged */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "0", ClampMax = "1", ConsoleVariable = "HttpBlueprint.Log.FailureSampleRate"))
+    float LogFailureSampleRate = 1.0f;
+
+    /** Request body characters kept for Verbose logging (0 disables body logging) */
+    UPROPERTY(config, EditAnywhere, Category = "Logging", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Log.MaxBodyBytes"))
+    int32 LogMaxBodyBytes = 1024;
+
+    // =============================================================================
+    // CAPTURE
+    // =============================================================================
+
+    /** Memory budget for captured HAR entries waiting to be written */
+    UPROPERTY(config, EditAnywhere, Category = "Capture", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Har.MaxQueuedBytes"))
+    int32 HarMaxQueuedBytes = 32 * 1024 * 1024;
+
+    /** Response bytes stored per captured HAR entry */
+    UPROPERTY(config, EditAnywhere, Category = "Capture", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Har.MaxBodyBytes"))
+    int32 HarMaxBodyBytes = 1024 * 1024;
+
+    /** Multiplier on recorded latencies when replaying a HAR file (0 = immediate) */
+    UPROPERTY(config, EditAnywhere, Category = "Capture", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Har.ReplayLatencyScale"))
+    float HarReplayLatencyScale = 1.0f;
+
+    /** Write Authorization, Cookie and other credential headers to HAR captures instead of redacting them */
+    UPROPERTY(config, EditAnywhere, Category = "Capture", meta = (ConsoleVariable = "HttpBlueprint.Har.IncludeCredentials"))
+    bool bHarIncludeCredentials = false;
+
+    // =============================================================================
+    // FIXTURES
+    // =============================================================================
+
+    /** 0 = off, 1 = record responses to fixtures, 2 = answer requests from fixtures only */
+    UPROPERTY(config, EditAnywhere, Category = "Fixtures", meta = (ClampMin = "0", ClampMax = "2", ConsoleVariable = "HttpBlueprint.Fixture.Mode"))
+    int32 FixtureMode = 0;
+
+    /** Fixture directory (empty = <Project>/Saved/HttpFixtures) */
+    UPROPERTY(config, EditAnywhere, Category = "Fixtures", meta = (ConsoleVariable = "HttpBlueprint.Fixture.Dir"))
+    FString FixtureDirectory;
+
+    /** Delay replayed fixture responses by their recorded latency */
+    UPROPERTY(config, EditAnywhere, Category = "Fixtures", meta = (ConsoleVariable = "HttpBlueprint.Fixture.SimulateTiming"))
+    bool bFixtureSimulateTiming = false;
+
+    // =============================================================================
+    // DISPATCH
+    // =============================================================================
+
+    /** Game-thread time (ms) spent running response callbacks per frame; the rest wait for the next frame (0 = unlimited) */
+    UPROPERTY(config, EditAnywhere, Category = "Dispatch", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Dispatch.BudgetMs"))
+    float DispatchBudgetMs = 4.0f;
+
+    /** Responses post-processed by response pipelines at once; the rest wait for a free slot */
+    UPROPERTY(config, EditAnywhere, Category = "Dispatch", meta = (ClampMin = "1", ConsoleVariable = "HttpBlueprint.Pipeline.MaxInFlight"))
+    int32 PipelineMaxInFlight = 8;
+
+    /** Array elements handed to the consumer at once by streaming JSON requests that do not set a batch size */
+    UPROPERTY(config, EditAnywhere, Category = "Dispatch", meta = (ClampMin = "1", ConsoleVariable = "HttpBlueprint.Stream.BatchSize"))
+    int32 StreamBatchSize = 256;
+
+    // =============================================================================
+    // TRACING
+    // =============================================================================
+
+    /** Send W3C traceparent (and tracestate) headers so backend traces can be tied to client requests */
+    UPROPERTY(config, EditAnywhere, Category = "Tracing", meta = (ConsoleVariable = "HttpBlueprint.Trace.Enabled"))
+    bool bTraceEnabled = false;
+
+    /** Fraction (0-1) of requests marked as sampled when no route rule matches */
+    UPROPERTY(config, EditAnywhere, Category = "Tracing", meta = (ClampMin = "0", ClampMax = "1", ConsoleVariable = "HttpBlueprint.Trace.SampleRate"))
+    float TraceSampleRate = 0.01f;
+
+    /** Per-route sample rates as "Wildcard=Rate" pairs separated by ';', first match wins (e.g., "*api.example.com/store*=1;*telemetry*=0") */
+    UPROPERTY(config, EditAnywhere, Category = "Tracing", meta = (ConsoleVariable = "HttpBlueprint.Trace.RouteSampleRates"))
+    FString TraceRouteSampleRates;
+
+    /** tracestate header value sent with every traced request (empty = no tracestate) */
+    UPROPERTY(config, EditAnywhere, Category = "Tracing", meta = (ConsoleVariable = "HttpBlueprint.Trace.State"))
+    FString TraceState;
+
+    // =============================================================================
+    // METRICS
+    // =============================================================================
+
+    /** Seconds between metric exports (0 disables exporting) */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Metrics.IntervalSeconds"))
+    float MetricsIntervalSeconds = 10.0f;
+
+    /** File rewritten with Prometheus exposition text on every export, e.g. for node_exporter's textfile collector (empty = off) */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics", meta = (ConsoleVariable = "HttpBlueprint.Metrics.PrometheusFile"))
+    FString MetricsPrometheusFile;
+
+    /** Loopback port serving Prometheus exposition text at /metrics (0 = off) */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics", meta = (ClampMin = "0", ClampMax = "65535", ConsoleVariable = "HttpBlueprint.Metrics.PrometheusPort"))
+    int32 MetricsPrometheusPort = 0;
+
+    /** StatsD "Ip:Port" receiving UDP metric packets on every export (empty = off) */
+    UPROPERTY(config, EditAnywhere, Category = "Metrics", meta = (ConsoleVariable = "HttpBlueprint.Metrics.StatsDAddress"))
+    FString MetricsStatsDAddress;
+
+    // =============================================================================
+    // CACHE
+    // =============================================================================
+
+    /** Memory budget of the response cache; least recently used entries are evicted beyond it (0 disables caching) */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Cache.MaxBytes"))
+    int32 CacheMaxBytes = 16 * 1024 * 1024;
+
+    /** Lifetime (seconds) of cached responses without a Cache-Control max-age */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Cache.DefaultTtlSeconds"))
+    float CacheDefaultTtlSeconds = 300.0f;
+
+    /** How long (seconds) past its lifetime a response may still be served while it is refreshed, without a Cache-Control stale-while-revalidate */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Cache.StaleWhileRevalidateSeconds"))
+    float CacheStaleWhileRevalidateSeconds = 3600.0f;
+
+    /** How long (seconds) past its lifetime a response may stand in for a failed request, without a Cache-Control stale-if-error */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "0", ConsoleVariable = "HttpBlueprint.Cache.StaleIfErrorSeconds"))
+    float CacheStaleIfErrorSeconds = 86400.0f;
+
+    /** Prefetches only start while fewer other requests than this are in flight */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "1", ConsoleVariable = "HttpBlueprint.Prefetch.MaxInteractiveInFlight"))
+    int32 PrefetchMaxInteractiveInFlight = 2;
+
+    /** Prefetches in flight at once */
+    UPROPERTY(config, EditAnywhere, Category = "Cache", meta = (ClampMin = "1", ConsoleVariable = "HttpBlueprint.Prefetch.MaxConcurrent"))
+    int32 PrefetchMaxConcurrent = 2;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** JSON type of an extracted value */
+enum class EHttpJsonValueType : uint8
+{
+    /** Path not present in the document */
+    None,
+    Null,
+    Bool,
+    Number,
+    String,
+    Object,
+    Array
+};
+
+/** One value pulled out of a JSON document by FHttpJsonFieldExtractor */
+struct HTTPBLUEPRINTAPI_API FHttpJsonFieldValue
+{
+    EHttpJsonValueType Type = EHttpJsonValueType::None;
+
+    /** Unescaped string, number as written, true/false/null, or the raw JSON of an object or array */
+    FString Text;
+
+    /** Numeric value of numbers and bools */
+    double Number = 0.0;
+
+    bool IsFound() const { return Type != EHttpJsonValueType::None; }
+};
+
+/**
+ * Pulls a few fields out of a JSON document without parsing the rest of it
+ *
+ * Paths use dotted JSONPath syntax: "data.version", "$.items[0].id", "meta['build.id']".
+ * Paths are compiled into a tree once; Extract then makes a single forward pass over the
+ * UTF-8 text, descending only into objects and arrays on a requested path and skipping
+ * everything else by searching for structural characters a machine word at a time. The
+ * scan stops as soon as every path has been found. No JSON objects are allocated.
+ *
+ * Wildcards and filters are not supported. Safe to share between threads once constructed.
+ */
+class HTTPBLUEPRINTAPI_API FHttpJsonFieldExtractor
+{
+public:
+
+    /** @param Paths - Paths to extract; values are returned in the same order */
+    explicit FHttpJsonFieldExtractor(const TArray<FString>& Paths);
+
+    /** False if a path could not be parsed (see GetError) */
+    bool IsValid() const { return Error.IsEmpty(); }
+    const FString& GetError() const { return Error; }
+
+    const TArray<FString>& GetPaths() const { return Paths; }
+
+    /**
+     * Scan a document for the compiled paths
+     *
+     * @param Json - UTF-8 JSON text
+     * @param OutValues - One entry per path; Type is None for paths that are not present
+     * @param OutError - Filled in when the JSON is malformed before every path was found
+     * @return True if the scan finished without errors (some paths may still be missing)
+     */
+    bool Extract(TArrayView<const uint8> Json, TArray<FHttpJsonFieldValue>& OutValues, FString& OutError) const;
+
+    /** Extract into a path -> text map, leaving out missing paths. Returns true if every path was found */
+    bool Extract(TArrayView<const uint8> Json, TMap<FString, FString>& OutValues) const;
+
+private:
+
+    /** Path tree; node 0 is the document root */
+    struct FNode
+    {
+        /** Object key (UTF-8) or array index this node matches in its parent */
+        TArray<uint8> Key;
+        int32 Index = INDEX_NONE;
+
+        TArray<int32> Children;
+
+        /** Paths that end at this node (more than one if a path is repeated) */
+        TArray<int32, TInlineAllocator<1>> PathIndices;
+    };
+
+    bool CompilePath(int32 PathIndex);
+    int32 FindOrAddChild(int32 Parent, TArray<uint8>&& Key, int32 Index);
+
+    /** Single-pass scanner over one document (defined in the .cpp) */
+    struct FScanner;
+
+    TArray<FString> Paths;
+    TArray<FNode> Nodes;
+
+    /** Nodes with at least one path ending at them */
+    int32 NumTerminalNodes = 0;
+
+    FString Error;
+};
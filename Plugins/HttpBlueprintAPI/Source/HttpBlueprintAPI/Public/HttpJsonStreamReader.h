@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FArchive;
+
+/**
+ * A batch of consecutive elements from a streamed JSON array
+ * Element text is kept as raw UTF-8, back to back, so a batch is two allocations however many elements it holds
+ */
+struct HTTPBLUEPRINTAPI_API FHttpJsonElementBatch
+{
+    /** Index of the first element of this batch within the whole array */
+    int32 FirstIndex = 0;
+
+    /** UTF-8 text of every element in the batch */
+    TArray<uint8> Data;
+
+    /** Offset and length of each element in Data */
+    TArray<TPair<int32, int32>> Elements;
+
+    int32 Num() const { return Elements.Num(); }
+
+    /** Raw JSON of one element, e.g. for FHttpStructDeserializer::ReadStruct */
+    TArrayView<const uint8> GetElement(int32 Index) const
+    {
+        return TArrayView<const uint8>(Data.GetData() + Elements[Index].Key, Elements[Index].Value);
+    }
+
+    /** JSON text of one element */
+    FString GetElementString(int32 Index) const;
+};
+
+/** Native delegate receiving streamed array elements, in order */
+DECLARE_DELEGATE_OneParam(FOnHttpJsonBatchNative, const FHttpJsonElementBatch& /*Batch*/);
+
+/**
+ * Incremental (SAX-style) JSON reader that splits a large array into elements as bytes arrive
+ *
+ * The reader tracks strings, escapes and nesting across chunk boundaries and never holds
+ * more than the element being read plus one batch, so memory stays bounded no matter how
+ * large the response is. The array is either the top-level value or, when ArrayField is
+ * set, the value of that field of the top-level object (e.g. {"entries": [...]}).
+ *
+ * Feed() and Finish() must be called from one thread at a time (the HTTP thread while
+ * downloading, then the completion thread).
+ */
+class HTTPBLUEPRINTAPI_API FHttpJsonStreamReader
+{
+public:
+
+    using FBatchHandler = TFunction<void(FHttpJsonElementBatch&& Batch)>;
+
+    static constexpr int32 MaxDepth = 512;
+
+    /**
+     * @param ArrayField - Field of the top-level object holding the array (empty = the body is the array)
+     * @param BatchSize - Elements per batch handed to OnBatch
+     * @param OnBatch - Receives each full batch on the thread that called Feed/Finish
+     */
+    FHttpJsonStreamReader(const FString& ArrayField, int32 BatchSize, FBatchHandler&& OnBatch);
+
+    /** Consume the next chunk of the body */
+    void Feed(const uint8* Data, int64 Length);
+
+    /** End of body: hand over the last partial batch and check the array was complete */
+    void Finish();
+
+    bool HasError() const { return !Error.IsEmpty(); }
+    const FString& GetError() const { return Error; }
+
+    /** Elements read so far */
+    int32 GetNumElements() const { return NumElements; }
+
+    /** Largest amount of element text held at once */
+    int64 GetPeakBufferedBytes() const { return PeakBufferedBytes; }
+
+    /** Archive to pass to IHttpRequest::SetResponseBodyReceiveStream; every write is fed to the reader */
+    static TSharedRef<FArchive> CreateReceiveArchive(const TSharedRef<FHttpJsonStreamReader>& Reader);
+
+private:
+
+    bool IsCapturing() const { return ElementStart != INDEX_NONE; }
+    bool IsTargetArray() const;
+
+    void BeginElement(bool bScalar);
+    void EndElement();
+    void FlushBatch();
+    void SetError(const FString& Message);
+
+    TArray<uint8> ArrayFieldUtf8;
+    int32 BatchSize;
+    FBatchHandler OnBatch;
+
+    FHttpJsonElementBatch Batch;
+
+    /** Offset in Batch.Data where the element being read starts */
+    int32 ElementStart = INDEX_NONE;
+    bool bScalarElement = false;
+
+    /** Container nesting at the current position */
+    int32 Depth = 0;
+
+    /** Depth inside the target array (elements start here), or INDEX_NONE when not inside it */
+    int32 ElementDepth = INDEX_NONE;
+    bool bArrayFound = false;
+    bool bArrayDone = false;
+
+    bool bInString = false;
+    bool bEscape = false;
+
+    /** Last key read at depth 1, to find ArrayField */
+    bool bExpectKey = false;
+    bool bReadingKey = false;
+    TArray<uint8> CurrentKey;
+
+    int32 NumElements = 0;
+    int64 PeakBufferedBytes = 0;
+    FString Error;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRequestOptions.h"
+
+class FJsonValue;
+class FJsonObject;
+class UScriptStruct;
+struct FHttpResponseData;
+
+/**
+ * Encodes and decodes request/response bodies as JSON, MessagePack, CBOR or Protobuf
+ *
+ * JSON, MessagePack and CBOR share the FJsonValue data model, so anything that can be written
+ * as JSON can be sent as MessagePack or CBOR and read back unchanged: integers are written
+ * in the smallest integer encoding, other numbers as float32 when that is exact and as
+ * float64 otherwise. Binary blobs in received MessagePack/CBOR become Base64 strings.
+ * Protobuf is not self-describing and needs a struct type (see FHttpProtobufCodec); the
+ * value-tree Encode/Decode reject it.
+ *
+ * Stateless; safe to call from any thread.
+ */
+class HTTPBLUEPRINTAPI_API FHttpPayloadCodec
+{
+public:
+
+    /** Content-Type sent for a body in this format */
+    static const TCHAR* GetContentType(EHttpPayloadFormat Format);
+
+    /** Accept header that prefers this format and falls back to JSON */
+    static FString GetAcceptHeader(EHttpPayloadFormat Format);
+
+    /** Format of a Content-Type header value (JSON for anything that is not MessagePack, CBOR or Protobuf) */
+    static EHttpPayloadFormat FormatFromContentType(const FString& ContentType);
+
+    /** Format of a received response, from its Content-Type header */
+    static EHttpPayloadFormat GetResponseFormat(const FHttpResponseData& Response);
+
+    /** Encode a value tree */
+    static bool Encode(EHttpPayloadFormat Format, const TSharedRef<FJsonValue>& Value, TArray<uint8>& OutBytes);
+    static bool Encode(EHttpPayloadFormat Format, const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes);
+
+    /** Encode a USTRUCT, using the same field names as FJsonObjectConverter (or field numbers, for Protobuf) */
+    static bool EncodeStruct(EHttpPayloadFormat Format, const UScriptStruct* StructType, const void* StructData, TArray<uint8>& OutBytes);
+
+    template<typename StructType>
+    static bool EncodeStruct(EHttpPayloadFormat Format, const StructType& Struct, TArray<uint8>& OutBytes)
+    {
+        return EncodeStruct(Format, StructType::StaticStruct(), &Struct, OutBytes);
+    }
+
+    /** Decode a body into a value tree; null (with OutError set) if it is malformed */
+    static TSharedPtr<FJsonValue> Decode(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes, FString& OutError);
+
+    /** Decode a body into an initialized struct */
+    static bool DecodeStruct(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes,
+        const UScriptStruct* StructType, void* StructData, FString& OutError);
+
+    template<typename StructType>
+    static bool DecodeStruct(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes, StructType& OutStruct, FString& OutError)
+    {
+        return DecodeStruct(Format, Bytes, StructType::StaticStruct(), &OutStruct, OutError);
+    }
+
+    /**
+     * JSON text -> binary body (request bodies written as JSON strings, e.g. from Blueprints)
+     * @param Schema - Message type, required for Protobuf; the JSON is read into it first
+     */
+    static bool TranscodeFromJson(EHttpPayloadFormat Format, const FString& Json, TArray<uint8>& OutBytes, FString& OutError,
+        const UScriptStruct* Schema = nullptr);
+
+    /**
+     * Binary body -> condensed JSON text (responses delivered to Blueprints)
+     * @param Schema - Message type, required for Protobuf
+     */
+    static bool TranscodeToJson(EHttpPayloadFormat Format, TArrayView<const uint8> Bytes, FString& OutJson, FString& OutError,
+        const UScriptStruct* Schema = nullptr);
+};
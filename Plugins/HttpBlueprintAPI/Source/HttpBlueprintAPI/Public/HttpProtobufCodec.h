@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+/**
+ * Forward-only reader over protobuf wire data
+ *
+ * Strings and bytes are returned as views into the buffer being read, so hand-written
+ * consumers can inspect a message without copying anything. Malformed input stops the
+ * reader (HasError) rather than reading out of bounds.
+ */
+class HTTPBLUEPRINTAPI_API FHttpProtobufReader
+{
+public:
+
+    enum class EWireType : uint8
+    {
+        Varint = 0,
+        Fixed64 = 1,
+        LengthDelimited = 2,
+        Fixed32 = 5
+    };
+
+    explicit FHttpProtobufReader(TArrayView<const uint8> Data)
+        : Cur(Data.GetData())
+        , End(Data.GetData() + Data.Num())
+    {
+    }
+
+    bool AtEnd() const { return Cur >= End; }
+    bool HasError() const { return bError; }
+
+    /** Read the next field key; false at the end of the message or on malformed input */
+    bool NextField(uint32& OutFieldNumber, EWireType& OutWireType);
+
+    FORCEINLINE bool ReadVarint(uint64& OutValue)
+    {
+        // Most varints on the wire (tags, small numbers, lengths) are a single byte
+        if (Cur < End && *Cur < 0x80)
+        {
+            OutValue = *Cur++;
+            return true;
+        }
+        return ReadVarintSlow(OutValue);
+    }
+
+    bool ReadFixed32(uint32& OutValue);
+    bool ReadFixed64(uint64& OutValue);
+
+    /** Length-delimited payload, as a view into the buffer */
+    bool ReadBytes(TArrayView<const uint8>& OutBytes);
+
+    /** Length-delimited UTF-8 string, as a view into the buffer */
+    bool ReadString(FUtf8StringView& OutString);
+
+    /** Skip the value of a field whose key was just read */
+    bool SkipField(EWireType WireType);
+
+private:
+
+    bool ReadVarintSlow(uint64& OutValue);
+    bool Fail() { bError = true; Cur = End; return false; }
+
+    const uint8* Cur;
+    const uint8* End;
+    bool bError = false;
+};
+
+/**
+ * Code-generation-free protobuf encoder/decoder for USTRUCTs
+ *
+ * The wire format is protobuf (proto3): a USTRUCT is a message and each supported
+ * UPROPERTY is a field. Field numbers come from RegisterFieldNumbers, else from
+ * meta = (ProtoField = "N") in builds that keep metadata, else from declaration order.
+ * UPROPERTY metadata is editor-only, so structs exchanged by cooked builds should register
+ * their numbers at startup (or keep declaration order in step with the .proto file).
+ *
+ * Type mapping:
+ *     bool -> bool; int8/16/32 -> int32; int64 -> int64; uint8/16/32 -> uint32; uint64 -> uint64
+ *     float -> float; double -> double; enums -> enum; FString/FName/FText -> string
+ *     TArray<uint8> -> bytes; USTRUCT -> message; TArray<T> -> repeated T (numeric ones packed)
+ * Maps, sets and object references are skipped. Unknown fields are skipped when decoding.
+ * Zero scalars and empty strings/arrays are not written, as in proto3.
+ *
+ * Schemas are compiled once per struct type and cached until the struct is reinstanced or,
+ * for user-defined structs, until the next garbage collection; safe to call from any thread.
+ */
+class HTTPBLUEPRINTAPI_API FHttpProtobufCodec
+{
+public:
+
+    /** Append StructData encoded as a protobuf message */
+    static bool Encode(const UScriptStruct* StructType, const void* StructData, TArray<uint8>& OutBytes);
+
+    /** Decode a protobuf message into an initialized struct */
+    static bool Decode(const UScriptStruct* StructType, TArrayView<const uint8> Bytes, void* StructData, FString& OutError);
+
+    template<typename StructType>
+    static bool Encode(const StructType& Struct, TArray<uint8>& OutBytes)
+    {
+        return Encode(StructType::StaticStruct(), &Struct, OutBytes);
+    }
+
+    template<typename StructType>
+    static bool Decode(TArrayView<const uint8> Bytes, StructType& OutStruct, FString& OutError)
+    {
+        return Decode(StructType::StaticStruct(), Bytes, &OutStruct, OutError);
+    }
+
+    /**
+     * Set field numbers for a struct's properties (by property name), for builds without metadata
+     * Call at startup, before the struct is encoded or decoded
+     */
+    static void RegisterFieldNumbers(const UScriptStruct* StructType, const TMap<FName, int32>& FieldNumbers);
+
+    /** Forget compiled schemas (e.g., after hot reload changed a struct layout); encodes and decodes in progress keep theirs */
+    static void ClearSchemaCache();
+
+    /** Flush cached schemas when structs are reinstanced or garbage collected (module startup, game thread) */
+    static void Startup();
+
+    /** Stop watching for reinstancing and garbage collection, and drop every schema and registered number */
+    static void Shutdown();
+};
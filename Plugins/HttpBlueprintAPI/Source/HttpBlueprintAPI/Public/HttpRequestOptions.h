@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectPtr.h"
+#include "HttpRequestOptions.generated.h"
+
+class UScriptStruct;
+class FHttpResponsePipeline;
+class FHttpJsonStreamReader;
+
+/**
+ * Order in which completed-response callbacks are run when the per-frame
+ * callback budget (HttpBlueprint.Dispatch.BudgetMs) is exceeded
+ */
+UENUM(BlueprintType)
+enum class EHttpCallbackPriority : uint8
+{
+    /** Run before anything else (e.g., responses the player is waiting on) */
+    High        UMETA(DisplayName = "High"),
+
+    /** Default priority */
+    Normal      UMETA(DisplayName = "Normal"),
+
+    /** Run only when there is budget left (e.g., telemetry acknowledgements, prefetches) */
+    Low         UMETA(DisplayName = "Low")
+};
+
+/**
+ * Wire format of request and response bodies
+ */
+UENUM(BlueprintType)
+enum class EHttpPayloadFormat : uint8
+{
+    /** application/json */
+    Json            UMETA(DisplayName = "JSON"),
+
+    /** application/msgpack */
+    MessagePack     UMETA(DisplayName = "MessagePack"),
+
+    /** application/cbor */
+    Cbor            UMETA(DisplayName = "CBOR"),
+
+    /** application/x-protobuf; needs a schema struct (RequestSchema/ResponseSchema) */
+    Protobuf        UMETA(DisplayName = "Protobuf")
+};
+
+/**
+ * Thread that runs a native (C++) completion delegate
+ * Blueprint delegates always run on the game thread.
+ */
+enum class EHttpCompletionThread : uint8
+{
+    /** Through the per-frame callback budget on the game thread */
+    GameThread,
+
+    /** Any task graph worker; callbacks may run concurrently */
+    AnyWorker,
+
+    /** Worker tasks serialized on the named pipe in FHttpRequestOptions::CompletionPipe */
+    NamedPipe
+};
+
+/**
+ * How a GET request uses the response cache
+ * Cached responses are served with Is Stale set once they are past their Cache-Control max-age.
+ */
+UENUM(BlueprintType)
+enum class EHttpCachePolicy : uint8
+{
+    /** The response cache is not used: the request is always sent and its response is not cached */
+    Default                         UMETA(DisplayName = "Default"),
+
+    /** Answered from fresh cached responses (e.g., prefetched ones), and the response is cached; expired responses are not served */
+    FreshOnly                       UMETA(DisplayName = "Fresh Only"),
+
+    /**
+     * Cache the response. Within its stale-while-revalidate window an expired response is delivered
+     * at once and refreshed in the background; past it, the request is sent and falls back like StaleIfError.
+     */
+    StaleWhileRevalidate            UMETA(DisplayName = "Stale While Revalidate"),
+
+    /** As StaleWhileRevalidate, and the callback runs a second time with the refreshed response if it changed */
+    StaleWhileRevalidateAndNotify   UMETA(DisplayName = "Stale While Revalidate (Notify)"),
+
+    /** Cache the response; expired responses are not served, except within their stale-if-error window when the request fails */
+    StaleIfError                    UMETA(DisplayName = "Stale If Error")
+};
+
+/**
+ * Optional per-request settings for Make HTTP Request with Options
+ */
+USTRUCT(BlueprintType)
+struct HTTPBLUEPRINTAPI_API FHttpRequestOptions
+{
+    GENERATED_BODY()
+
+    /** Priority class of the completion callback within the per-frame callback budget */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    EHttpCallbackPriority CallbackPriority = EHttpCallbackPriority::Normal;
+
+    /**
+     * Body format to negotiate with the server
+     * MessagePack/CBOR/Protobuf: the JSON request body is sent in that format and it is preferred in Accept.
+     * Binary responses are always decoded back to JSON text for the Response Body.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    EHttpPayloadFormat PayloadFormat = EHttpPayloadFormat::Json;
+
+    /** Protobuf: message type of the request body (the JSON body is converted through this struct) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    TObjectPtr<UScriptStruct> RequestSchema = nullptr;
+
+    /** Protobuf: message type of the response body, used to decode it back to JSON */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    TObjectPtr<UScriptStruct> ResponseSchema = nullptr;
+
+    /**
+     * JSON paths (e.g., "data.version", "items[0].id") to pull out of the response body into
+     * FHttpResponseData::ExtractedFields, without parsing the rest of the document
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    TArray<FString> ExtractFields;
+
+    /**
+     * How a GET request uses the response cache (e.g., serve stale data at once and refresh it)
+     * Only the response struct (Is Stale) says whether a response was stale; the string callback
+     * of Make HTTP Request with Options receives it like a fresh one.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Request")
+    EHttpCachePolicy CachePolicy = EHttpCachePolicy::Default;
+
+    /**
+     * Thread that runs a native completion delegate (C++ only)
+     * When not GameThread, the response is also processed off the game thread.
+     */
+    EHttpCompletionThread CompletionThread = EHttpCompletionThread::GameThread;
+
+    /** Pipe name for EHttpCompletionThread::NamedPipe; callbacks sharing a name never run concurrently */
+    FName CompletionPipe;
+
+    /** Post-processing stages run on workers before the response is delivered (C++ only) */
+    TSharedPtr<const FHttpResponsePipeline> Pipeline;
+
+    /**
+     * Streams the body through this reader as it downloads instead of buffering it (C++ only)
+     * Set by Make Streaming JSON Request; a reader holds per-request state and cannot be shared.
+     */
+    TSharedPtr<FHttpJsonStreamReader> JsonStream;
+
+    /**
+     * Set by the owner when it gives up on the request (C++ only)
+     * A response completing afterwards is not stored in the response cache; cancel the sent request too to stop the transfer.
+     */
+    TSharedPtr<const TAtomic<bool>, ESPMode::ThreadSafe> CancelFlag;
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HttpRequestSigning.generated.h"
+
+/**
+ * Signing schemes supported by the built-in request signing stage
+ */
+UENUM(BlueprintType)
+enum class EHttpSigningScheme : uint8
+{
+    /** Request is sent unsigned */
+    None            UMETA(DisplayName = "None"),
+
+    /** AWS Signature Version 4 (HMAC-SHA256 over the canonical request) */
+    AwsSigV4        UMETA(DisplayName = "AWS SigV4"),
+
+    /** HMAC-SHA256 over method, path, timestamp, signed headers and body hash */
+    CustomHmac      UMETA(DisplayName = "Custom HMAC")
+};
+
+/**
+ * Credentials and options used to sign an outgoing HTTP request
+ */
+USTRUCT(BlueprintType)
+struct HTTPBLUEPRINTAPI_API FHttpSigningConfig
+{
+    GENERATED_BODY()
+
+    /** Which signing scheme to apply */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    EHttpSigningScheme Scheme = EHttpSigningScheme::AwsSigV4;
+
+    /** Public key identifier (AWS access key id, or the key id sent with custom HMAC) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString AccessKeyId;
+
+    /** Shared secret used to derive the signing key */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString SecretKey;
+
+    /** Region the request is scoped to (e.g., "us-east-1") */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString Region = TEXT("us-east-1");
+
+    /** Service the request is scoped to (e.g., "execute-api") */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString Service = TEXT("execute-api");
+
+    /** Header that receives the signature when using custom HMAC */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString SignatureHeader = TEXT("X-Signature");
+
+    /** Optional file to stream as the request body instead of the string body */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HTTP Signing")
+    FString BodyFilePath;
+};
+
+/**
+ * Incremental SHA-256 hasher
+ * Data can be fed in any number of chunks, so large bodies never need to be held in memory at once
+ */
+class HTTPBLUEPRINTAPI_API FHttpSha256
+{
+public:
+
+    static constexpr int32 DigestSize = 32;
+    static constexpr int32 BlockSize = 64;
+
+    FHttpSha256();
+
+    /** Reset the hasher so it can be reused for a new message */
+    void Reset();
+
+    /** Feed more bytes into the digest */
+    void Update(const uint8* Data, int64 Length);
+
+    /** Feed the UTF-8 encoding of a string into the digest */
+    void UpdateString(const FString& Value);
+
+    /** Finish the digest. The hasher must be Reset() before it is used again */
+    void Final(uint8 OutDigest[DigestSize]);
+
+    /** One-shot helper returning the digest of a buffer */
+    static TArray<uint8> HashBuffer(const uint8* Data, int64 Length);
+
+    /** Lowercase hex encoding, as required by SigV4 */
+    static FString ToHex(const uint8* Data, int32 Length);
+
+private:
+
+    void ProcessBlock(const uint8* Block);
+
+    uint32 State[8];
+    uint8 Buffer[BlockSize];
+    uint64 TotalLength;
+    int32 BufferLength;
+};
+
+/**
+ * Signs HTTP requests with HMAC-SHA256
+ *
+ * Signing is designed to run on a worker thread: the body is hashed incrementally
+ * (streamed in chunks when it comes from a file) and derived signing keys are cached per
+ * day, region and service so only one HMAC is computed per request after the first.
+ */
+class HTTPBLUEPRINTAPI_API FHttpRequestSigner
+{
+public:
+
+    /**
+     * Sign a fully configured (but not yet started) request in place
+     *
+     * @param Request - Request to add signature headers to
+     * @param Config - Credentials and signing scheme
+     * @param OutErrorMessage - Filled in when signing fails
+     * @return True if the request was signed
+     */
+    static bool SignRequest(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+        const FHttpSigningConfig& Config,
+        FString& OutErrorMessage
+    );
+
+    /** HMAC-SHA256 of a message using the given key */
+    static TArray<uint8> HmacSha256(const TArray<uint8>& Key, const FString& Message);
+
+    /** Drop all cached derived keys (e.g., after rotating credentials) */
+    static void ClearKeyCache();
+
+private:
+
+    friend struct FHttpRequestSignerTestAccess;
+
+    /** Encode query parameter names and values and sort them by name, then value, as SigV4 requires */
+    static FString CanonicalizeQuery(const FString& Query);
+
+    /** Hash the request body (in memory or streamed from file) */
+    static bool HashRequestBody(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+        const FHttpSigningConfig& Config,
+        FString& OutHexDigest,
+        FString& OutErrorMessage
+    );
+
+    /** Get (or derive and cache) the SigV4 signing key for a day/region/service */
+    static TArray<uint8> GetSigV4SigningKey(const FHttpSigningConfig& Config, const FString& DateStamp);
+
+    static bool SignAwsSigV4(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+        const FHttpSigningConfig& Config,
+        const FString& PayloadHash
+    );
+
+    static bool SignCustomHmac(
+        const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request,
+        const FHttpSigningConfig& Config,
+        const FString& PayloadHash
+    );
+};
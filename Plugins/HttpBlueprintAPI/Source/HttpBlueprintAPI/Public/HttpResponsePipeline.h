@@ -0,0 +1,146 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpBlueprintFunctionLibrary.h"
+#include "HttpStructDeserializer.h"
+
+class FJsonValue;
+class FStructOnScope;
+
+/**
+ * Everything the post-processing stages produced for one response
+ * Attached to FHttpResponseData::PipelineOutput when the pipeline finishes
+ */
+struct HTTPBLUEPRINTAPI_API FHttpPipelineOutput
+{
+    /** Response body after decompression */
+    TArray<uint8> Body;
+
+    /** Parsed body (DecodeJson stage) */
+    TSharedPtr<FJsonValue> Json;
+
+    /** Body mapped into a USTRUCT (ToStruct stage) */
+    TSharedPtr<FStructOnScope> Struct;
+
+    /** Anything custom stages want to hand to the consumer */
+    TMap<FName, TSharedPtr<void>> UserData;
+
+    /** Time spent in each stage that ran, in order */
+    TArray<TPair<FName, double>> StageTimesMs;
+
+    /** Typed access to UserData (e.g., the records added by ToStructArray) */
+    template<typename T>
+    TSharedPtr<T> GetUserData(FName Key) const
+    {
+        return StaticCastSharedPtr<T>(UserData.FindRef(Key));
+    }
+};
+
+/**
+ * State passed from stage to stage. Stages run one at a time per response, so no locking is needed
+ */
+struct HTTPBLUEPRINTAPI_API FHttpPipelineContext
+{
+    /** Response that will be delivered; stages may rewrite it (e.g., ResponseBody after decompression) */
+    FHttpResponseData Response;
+
+    /** Shared with the delivered FHttpResponseData */
+    TSharedRef<FHttpPipelineOutput> Output = MakeShared<FHttpPipelineOutput>();
+
+    /** Set when a stage fails; later stages are skipped */
+    bool bFailed = false;
+};
+
+/**
+ * Composable post-processing for responses: decompress, validate, decode JSON, map into a
+ * USTRUCT and any custom stages, in the order they were added
+ *
+ * Each stage runs as its own UE::Tasks task chained on the previous one, so different
+ * responses can occupy different stages at the same time. At most
+ * HttpBlueprint.Pipeline.MaxInFlight responses are processed at once; the rest wait their
+ * turn (backpressure). A stage that returns false fails the response and skips the
+ * remaining stages. Only the final delivery goes to the game thread.
+ *
+ * Build once, always owned by a shared pointer, and share between requests (FHttpRequestOptions::Pipeline):
+ *
+ *     TSharedRef<FHttpResponsePipeline> Pipeline = MakeShared<FHttpResponsePipeline>();
+ *     Pipeline->Decompress().ValidateStatus().DecodeJson().ToStruct(FMyRecord::StaticStruct());
+ */
+class HTTPBLUEPRINTAPI_API FHttpResponsePipeline : public TSharedFromThis<FHttpResponsePipeline>
+{
+public:
+
+    /** Stage body: return false (and optionally set Context.Response.ErrorMessage) to fail the response */
+    using FStageFunction = TFunction<bool(FHttpPipelineContext& Context)>;
+
+    /**
+     * Inflate gzip or zlib bodies (no-op if the transport already decompressed them)
+     * With Content-Encoding gzip/deflate a body that fails to inflate fails the response; without the
+     * header, a body that merely looks compressed but does not inflate is passed through unchanged.
+     */
+    FHttpResponsePipeline& Decompress();
+
+    /** Fail responses with a non-2xx status or a body larger than MaxBodyBytes (0 = no limit) */
+    FHttpResponsePipeline& ValidateStatus(int64 MaxBodyBytes = 0);
+
+    /** Parse the body into Output.Json (MessagePack and CBOR bodies are detected from Content-Type) */
+    FHttpResponsePipeline& DecodeJson();
+
+    /**
+     * Read the body into an instance of StructType (Output.Struct)
+     * Uses FHttpStructDeserializer on the raw body unless DecodeJson already ran; MessagePack and
+     * CBOR bodies are decoded with FHttpPayloadCodec
+     */
+    FHttpResponsePipeline& ToStruct(const UScriptStruct* StructType);
+
+    /**
+     * Stream a JSON array body straight into a TArray of structs, without an FJsonObject tree
+     * The array is stored in Output.UserData under OutputKey: Output->GetUserData<TArray<T>>(OutputKey)
+     */
+    template<typename StructType>
+    FHttpResponsePipeline& ToStructArray(FName OutputKey = TEXT("Records"))
+    {
+        return Then(TEXT("ToStructArray"), [OutputKey](FHttpPipelineContext& Context)
+            {
+                TSharedRef<TArray<StructType>> Records = MakeShared<TArray<StructType>>();
+                if (!FHttpStructDeserializer::ReadArray(Context.Output->Body, *Records, Context.Response.ErrorMessage))
+                {
+                    return false;
+                }
+                Context.Output->UserData.Add(OutputKey, Records);
+                return true;
+            });
+    }
+
+    /** Append a custom stage */
+    FHttpResponsePipeline& Then(FName StageName, FStageFunction&& Stage);
+
+    int32 NumStages() const { return Stages.Num(); }
+
+    /**
+     * Run all stages for a response on worker threads
+     *
+     * @param ResponseData - Processed response (status, headers, string body)
+     * @param RawBody - Undecoded body bytes; empty to use the UTF-8 encoding of ResponseData.ResponseBody
+     * @param OnFinished - Called on a worker with the final response; PipelineOutput is set
+     */
+    void Run(const FHttpResponseData& ResponseData, TArray<uint8>&& RawBody,
+        TUniqueFunction<void(const FHttpResponseData&)>&& OnFinished) const;
+
+    /** Log total/average/max time per stage name across all pipelines */
+    static void DumpStageStats();
+
+private:
+
+    struct FStage
+    {
+        FName Name;
+        FStageFunction Function;
+    };
+
+    /** Chain one task per stage, then hand the response back (called once a pipeline slot is free) */
+    void LaunchStages(const TSharedRef<FHttpPipelineContext>& Context,
+        TUniqueFunction<void(const FHttpResponseData&)>&& OnFinished) const;
+
+    TArray<FStage> Stages;
+};
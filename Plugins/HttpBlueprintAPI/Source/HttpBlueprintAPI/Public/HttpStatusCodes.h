@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * HTTP status codes from the IANA HTTP Status Code Registry
+ *
+ * Reason phrases live in a table built at compile time, so looking one up never allocates.
+ * Names and texts are interned on first use for every code from 100 to 599; copying an
+ * FName or FText does not allocate either. Safe to call from any thread.
+ */
+class HTTPBLUEPRINTAPI_API FHttpStatusCodes
+{
+public:
+
+    static constexpr int32 MinCode = 100;
+    static constexpr int32 MaxCode = 599;
+
+    /** Registered reason phrase (e.g., "Not Found"); empty if the code is not in the registry */
+    static FStringView GetReasonPhrase(int32 Code);
+
+    /** Registered reason phrase as an interned name; NAME_None if the code is not in the registry */
+    static FName GetReasonName(int32 Code);
+
+    /** Reason phrase, or "HTTP <Code>" for codes not in the registry */
+    static FText GetDescription(int32 Code);
+
+    /** "HTTP Error <Code>: <Description>" (allocates; meant for messages that are actually shown) */
+    static FString FormatError(int32 Code);
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+/**
+ * Reads JSON straight into USTRUCTs without building an FJsonObject tree
+ *
+ * The first time a struct type is seen, its properties are compiled into a lookup table
+ * keyed by a case-insensitive hash of the JSON field name (the same matching rules as
+ * FJsonObjectConverter). The table is cached until the struct is reinstanced or, for
+ * user-defined structs, until the next garbage collection, so deserializing a record
+ * is a single forward scan of the UTF-8 body with one hash lookup per field.
+ *
+ * Bool, numeric, enum, string, name, text, nested struct and array properties are written
+ * directly; anything else (maps, sets, object references) falls back to FJsonObjectConverter
+ * for that field only. Safe to call from any thread.
+ */
+class HTTPBLUEPRINTAPI_API FHttpStructDeserializer
+{
+public:
+
+    /**
+     * Read a JSON object into an existing struct instance
+     *
+     * @param StructType - Type of the struct at StructData
+     * @param Json - UTF-8 JSON text
+     * @param StructData - Initialized struct memory to fill in
+     * @param OutError - Filled in when the JSON is malformed
+     * @return True if the whole object was read
+     */
+    static bool ReadStruct(const UScriptStruct* StructType, TArrayView<const uint8> Json, void* StructData, FString& OutError);
+
+    /**
+     * Read a JSON array of objects, adding one struct per element
+     *
+     * @param StructType - Type of each element
+     * @param Json - UTF-8 JSON text whose top-level value is an array
+     * @param AddElement - Returns initialized memory for the next element
+     * @param OutError - Filled in when the JSON is malformed
+     * @return True if the whole array was read
+     */
+    static bool ReadArray(const UScriptStruct* StructType, TArrayView<const uint8> Json,
+        TFunctionRef<void*()> AddElement, FString& OutError);
+
+    template<typename StructType>
+    static bool ReadStruct(TArrayView<const uint8> Json, StructType& OutStruct, FString& OutError)
+    {
+        return ReadStruct(StructType::StaticStruct(), Json, &OutStruct, OutError);
+    }
+
+    template<typename StructType>
+    static bool ReadArray(TArrayView<const uint8> Json, TArray<StructType>& OutArray, FString& OutError)
+    {
+        return ReadArray(StructType::StaticStruct(), Json,
+            [&OutArray]() -> void* { return &OutArray.AddDefaulted_GetRef(); }, OutError);
+    }
+
+    /** Forget compiled field tables (e.g., after hot reload changed a struct layout); reads in progress keep theirs */
+    static void ClearFieldMapCache();
+
+    /** Flush cached tables when structs are reinstanced or garbage collected (module startup, game thread) */
+    static void Startup();
+
+    /** Stop watching for reinstancing and garbage collection, and drop every table */
+    static void Shutdown();
+};
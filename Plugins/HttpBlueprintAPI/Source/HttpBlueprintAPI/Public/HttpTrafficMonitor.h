@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpBlueprintFunctionLibrary.h"
+
+/** Point in a request's life reported to the traffic inspector */
+enum class EHttpTrafficEventType : uint8
+{
+    /** Request accepted by the plugin (carries method, URL, caller and request size) */
+    Started,
+
+    /** Status line received: everything before it (engine queue, DNS, connect, TLS, server time) is waiting */
+    ResponseStarted,
+
+    /** Response complete (carries status, error kind and response size) */
+    Completed,
+
+    /** Processed response handed to the callback dispatcher */
+    Dispatched,
+
+    CallbackStarted,
+    CallbackFinished
+};
+
+/** Where a response came from */
+enum class EHttpTrafficSource : uint8
+{
+    Network,
+
+    /** Test fixture or HAR replay */
+    Recorded,
+
+    /** Synthetic failure from fault injection */
+    FaultInjected,
+
+    /** Response cache filled by prefetches */
+    Cache
+};
+
+struct HTTPBLUEPRINTAPI_API FHttpTrafficEvent
+{
+    uint32 RequestId = 0;
+    EHttpTrafficEventType Type = EHttpTrafficEventType::Started;
+
+    /** FPlatformTime::Seconds() */
+    double TimeSeconds = 0.0;
+
+    // Started
+    FString Method;
+    FString URL;
+    FString Caller;
+    EHttpTrafficSource Source = EHttpTrafficSource::Network;
+    int64 RequestBytes = 0;
+
+    // Completed
+    int32 ResponseCode = 0;
+    int64 ResponseBytes = 0;
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+};
+
+/**
+ * Request lifecycle events for the editor's HTTP traffic inspector
+ *
+ * Events go through a fixed-size lock-free ring (bounded MPSC queue with per-slot sequence
+ * numbers): producers on any thread claim a slot with one compare-and-swap, and the
+ * inspector drains it on the game thread. Nothing is recorded unless an inspector is open,
+ * so the cost on the request path is a relaxed load; when the ring is full events are dropped.
+ */
+class HTTPBLUEPRINTAPI_API FHttpTrafficMonitor
+{
+public:
+
+    static FHttpTrafficMonitor& Get();
+
+    bool IsEnabled() const { return bEnabled.Load(EMemoryOrder::Relaxed); }
+
+    void SetEnabled(bool bInEnabled);
+
+    /** Queue an event (any thread, no-op when disabled) */
+    void Record(FHttpTrafficEvent&& Event);
+
+    /** Queue a timestamp-only event (any thread, no-op when disabled) */
+    void Record(uint32 RequestId, EHttpTrafficEventType Type);
+
+    /** Queue a Started event; CallSiteId names the caller (see FHttpCallSites) */
+    void RecordStarted(uint32 RequestId, const FString& Method, const FString& URL, int64 RequestBytes, EHttpTrafficSource Source, uint32 CallSiteId);
+
+    /** Queue a Completed event for a response */
+    void RecordCompleted(uint32 RequestId, const FHttpResponseData& Response, int64 ResponseBytes);
+
+    /**
+     * Move queued events to OutEvents (single consumer)
+     *
+     * @return Number of events appended
+     */
+    int32 Drain(TArray<FHttpTrafficEvent>& OutEvents);
+
+    /** Events lost because the ring was full */
+    uint64 GetNumDropped() const { return NumDropped.Load(EMemoryOrder::Relaxed); }
+
+private:
+
+    FHttpTrafficMonitor();
+
+    static constexpr uint64 Capacity = 4096;
+    static_assert((Capacity & (Capacity - 1)) == 0, "Ring capacity must be a power of two");
+
+    struct FSlot
+    {
+        /** Position + 1 once the event is written; position + Capacity once it is consumed */
+        TAtomic<uint64> Sequence { 0 };
+        FHttpTrafficEvent Event;
+    };
+
+    TUniquePtr<FSlot[]> Slots;
+    TAtomic<uint64> EnqueuePosition { 0 };
+    uint64 DequeuePosition = 0;
+
+    TAtomic<bool> bEnabled { false };
+    TAtomic<uint64> NumDropped { 0 };
+};
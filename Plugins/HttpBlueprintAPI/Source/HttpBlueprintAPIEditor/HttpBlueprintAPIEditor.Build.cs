@@ -0,0 +1,24 @@
+using UnrealBuildTool;
+
+public class HttpBlueprintAPIEditor : ModuleRules
+{
+    public HttpBlueprintAPIEditor(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(new string[]
+        {
+            "Core"
+        });
+
+        PrivateDependencyModuleNames.AddRange(new string[]
+        {
+            "CoreUObject",
+            "Engine",
+            "Slate",
+            "SlateCore",
+            "WorkspaceMenuStructure",
+            "HttpBlueprintAPI"
+        });
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HttpBlueprintAPIEditor.h"
+#include "SHttpTrafficInspector.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
+
+#define LOCTEXT_NAMESPACE "FHttpBlueprintAPIEditorModule"
+
+static const FName HttpTrafficInspectorTabName(TEXT("HttpTrafficInspector"));
+
+void FHttpBlueprintAPIEditorModule::StartupModule()
+{
+	// Window > Developer Tools > Debug > HTTP Traffic
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(HttpTrafficInspectorTabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs& Args)
+		{
+			return SNew(SDockTab)
+				.TabRole(ETabRole::NomadTab)
+				[
+					SNew(SHttpTrafficInspector)
+				];
+		}))
+		.SetDisplayName(LOCTEXT("HttpTrafficInspectorTabTitle", "HTTP Traffic"))
+		.SetTooltipText(LOCTEXT("HttpTrafficInspectorTooltip", "Live and recent HTTP Blueprint API requests with a timing waterfall"))
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsDebugCategory());
+}
+
+void FHttpBlueprintAPIEditorModule::ShutdownModule()
+{
+	if (FSlateApplication::IsInitialized())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(HttpTrafficInspectorTabName);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FHttpBlueprintAPIEditorModule, HttpBlueprintAPIEditor)
@@ -0,0 +1,540 @@
+#include "SHttpTrafficInspector.h"
+#include "HAL/PlatformTime.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SHttpTrafficInspector"
+
+namespace HttpTrafficInspectorDetail
+{
+    static const FName ColumnMethod(TEXT("Method"));
+    static const FName ColumnURL(TEXT("URL"));
+    static const FName ColumnStatus(TEXT("Status"));
+    static const FName ColumnSource(TEXT("Source"));
+    static const FName ColumnSent(TEXT("Sent"));
+    static const FName ColumnReceived(TEXT("Received"));
+    static const FName ColumnTime(TEXT("Time"));
+    static const FName ColumnCaller(TEXT("Caller"));
+    static const FName ColumnWaterfall(TEXT("Waterfall"));
+
+    /** Waterfall phases, in order */
+    enum class EPhase : uint8
+    {
+        Waiting,
+        Download,
+        Processing,
+        CallbackQueued,
+        Callback,
+        Num
+    };
+
+    static const FLinearColor PhaseColors[] =
+    {
+        FLinearColor(0.90f, 0.60f, 0.15f),
+        FLinearColor(0.20f, 0.55f, 0.95f),
+        FLinearColor(0.60f, 0.35f, 0.85f),
+        FLinearColor(0.45f, 0.45f, 0.45f),
+        FLinearColor(0.25f, 0.75f, 0.35f),
+    };
+    static_assert(UE_ARRAY_COUNT(PhaseColors) == (int32)EPhase::Num, "One color per waterfall phase");
+
+    static FText GetPhaseName(EPhase Phase)
+    {
+        switch (Phase)
+        {
+        case EPhase::Waiting:        return LOCTEXT("PhaseWaiting", "Waiting (queue, DNS, connect, TTFB)");
+        case EPhase::Download:       return LOCTEXT("PhaseDownload", "Download");
+        case EPhase::Processing:     return LOCTEXT("PhaseProcessing", "Processing");
+        case EPhase::CallbackQueued: return LOCTEXT("PhaseCallbackQueued", "Callback queued");
+        case EPhase::Callback:       return LOCTEXT("PhaseCallback", "Callback");
+        default:                     return FText::GetEmpty();
+        }
+    }
+
+    /** Start and end of a phase; an end of 0 means it is still running */
+    static void GetPhaseSpan(const FHttpTrafficRow& Row, EPhase Phase, double& OutStart, double& OutEnd)
+    {
+        // Responses that never reported a status line (recorded, failed) have no separate download
+        const double DownloadStart = Row.ResponseStartedTime > 0.0 ? Row.ResponseStartedTime : Row.CompletedTime;
+
+        switch (Phase)
+        {
+        case EPhase::Waiting:        OutStart = Row.StartedTime;         OutEnd = DownloadStart;            break;
+        case EPhase::Download:       OutStart = DownloadStart;           OutEnd = Row.CompletedTime;        break;
+        case EPhase::Processing:     OutStart = Row.CompletedTime;       OutEnd = Row.DispatchedTime;       break;
+        case EPhase::CallbackQueued: OutStart = Row.DispatchedTime;      OutEnd = Row.CallbackStartedTime;  break;
+        case EPhase::Callback:       OutStart = Row.CallbackStartedTime; OutEnd = Row.CallbackFinishedTime; break;
+        default:                     OutStart = OutEnd = 0.0;                                               break;
+        }
+    }
+
+    static FText GetSourceText(EHttpTrafficSource Source)
+    {
+        switch (Source)
+        {
+        case EHttpTrafficSource::Network:       return LOCTEXT("SourceNetwork", "Network");
+        case EHttpTrafficSource::Recorded:      return LOCTEXT("SourceRecorded", "Recorded");
+        case EHttpTrafficSource::FaultInjected: return LOCTEXT("SourceFaultInjected", "Fault injected");
+        case EHttpTrafficSource::Cache:         return LOCTEXT("SourceCache", "Cache");
+        default:                                return FText::GetEmpty();
+        }
+    }
+
+    static FText GetStatusText(const FHttpTrafficRow& Row)
+    {
+        if (Row.CompletedTime <= 0.0)
+        {
+            return LOCTEXT("StatusPending", "Pending");
+        }
+        if (Row.ResponseCode > 0)
+        {
+            return FText::AsNumber(Row.ResponseCode, &FNumberFormattingOptions::DefaultNoGrouping());
+        }
+        return StaticEnum<EHttpErrorKind>()->GetDisplayNameTextByValue((int64)Row.ErrorKind);
+    }
+
+    static FText FormatMilliseconds(double Seconds)
+    {
+        FNumberFormattingOptions Options;
+        Options.MaximumFractionalDigits = 1;
+        return FText::Format(LOCTEXT("Milliseconds", "{0} ms"), FText::AsNumber(Seconds * 1000.0, &Options));
+    }
+}
+
+// =============================================================================
+// WATERFALL BAR
+// =============================================================================
+
+/** Phases of one request, scaled to the inspector's time span */
+class SHttpWaterfallBar : public SLeafWidget
+{
+public:
+
+    SLATE_BEGIN_ARGS(SHttpWaterfallBar) {}
+        SLATE_ARGUMENT(TSharedPtr<FHttpTrafficRow>, Row)
+        SLATE_ATTRIBUTE(double, ViewStart)
+        SLATE_ATTRIBUTE(double, ViewEnd)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs)
+    {
+        Row = InArgs._Row;
+        ViewStart = InArgs._ViewStart;
+        ViewEnd = InArgs._ViewEnd;
+        SetToolTipText(TAttribute<FText>::CreateSP(this, &SHttpWaterfallBar::GetTooltip));
+    }
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+    {
+        using namespace HttpTrafficInspectorDetail;
+
+        const double Start = ViewStart.Get();
+        const double Span = FMath::Max(ViewEnd.Get() - Start, 0.001);
+        const double Now = FPlatformTime::Seconds();
+        const FVector2D Size = AllottedGeometry.GetLocalSize();
+        const FSlateBrush* Brush = FAppStyle::GetBrush(TEXT("WhiteBrush"));
+
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)EPhase::Num; ++PhaseIndex)
+        {
+            double PhaseStart = 0.0;
+            double PhaseEnd = 0.0;
+            GetPhaseSpan(*Row, (EPhase)PhaseIndex, PhaseStart, PhaseEnd);
+            if (PhaseStart <= 0.0)
+            {
+                continue;
+            }
+
+            // A running phase grows until its end event arrives
+            if (PhaseEnd <= 0.0)
+            {
+                PhaseEnd = Now;
+            }
+
+            const double Left = FMath::Clamp((PhaseStart - Start) / Span, 0.0, 1.0) * Size.X;
+            const double Right = FMath::Clamp((PhaseEnd - Start) / Span, 0.0, 1.0) * Size.X;
+            FSlateDrawElement::MakeBox(
+                OutDrawElements,
+                LayerId,
+                AllottedGeometry.ToPaintGeometry(FVector2D(FMath::Max(Right - Left, 1.0), Size.Y - 4.0), FSlateLayoutTransform(FVector2D(Left, 2.0))),
+                Brush,
+                ESlateDrawEffect::None,
+                PhaseColors[PhaseIndex] * InWidgetStyle.GetColorAndOpacityTint());
+        }
+        return LayerId;
+    }
+
+    virtual FVector2D ComputeDesiredSize(float) const override
+    {
+        return FVector2D(300.0, 16.0);
+    }
+
+private:
+
+    FText GetTooltip() const
+    {
+        using namespace HttpTrafficInspectorDetail;
+
+        TArray<FText> Lines;
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)EPhase::Num; ++PhaseIndex)
+        {
+            double PhaseStart = 0.0;
+            double PhaseEnd = 0.0;
+            GetPhaseSpan(*Row, (EPhase)PhaseIndex, PhaseStart, PhaseEnd);
+            if (PhaseStart > 0.0 && PhaseEnd > 0.0)
+            {
+                Lines.Add(FText::Format(LOCTEXT("PhaseTooltip", "{0}: {1}"), GetPhaseName((EPhase)PhaseIndex), FormatMilliseconds(PhaseEnd - PhaseStart)));
+            }
+        }
+        return FText::Join(FText::FromString(TEXT("\n")), Lines);
+    }
+
+    TSharedPtr<FHttpTrafficRow> Row;
+    TAttribute<double> ViewStart;
+    TAttribute<double> ViewEnd;
+};
+
+// =============================================================================
+// TABLE ROW
+// =============================================================================
+
+class SHttpTrafficRowWidget : public SMultiColumnTableRow<TSharedPtr<FHttpTrafficRow>>
+{
+public:
+
+    SLATE_BEGIN_ARGS(SHttpTrafficRowWidget) {}
+        SLATE_ARGUMENT(TSharedPtr<FHttpTrafficRow>, Row)
+        SLATE_ATTRIBUTE(double, ViewStart)
+        SLATE_ATTRIBUTE(double, ViewEnd)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable)
+    {
+        Row = InArgs._Row;
+        ViewStart = InArgs._ViewStart;
+        ViewEnd = InArgs._ViewEnd;
+        SMultiColumnTableRow<TSharedPtr<FHttpTrafficRow>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+    }
+
+    virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+    {
+        using namespace HttpTrafficInspectorDetail;
+
+        const TSharedPtr<FHttpTrafficRow> RowData = Row;
+
+        if (ColumnName == ColumnWaterfall)
+        {
+            return SNew(SHttpWaterfallBar)
+                .Row(RowData)
+                .ViewStart(ViewStart)
+                .ViewEnd(ViewEnd);
+        }
+
+        TAttribute<FText> Text;
+        if (ColumnName == ColumnMethod)
+        {
+            Text = FText::FromString(RowData->Method);
+        }
+        else if (ColumnName == ColumnURL)
+        {
+            Text = FText::FromString(RowData->URL);
+        }
+        else if (ColumnName == ColumnStatus)
+        {
+            Text = TAttribute<FText>::CreateLambda([RowData]() { return GetStatusText(*RowData); });
+        }
+        else if (ColumnName == ColumnSource)
+        {
+            Text = GetSourceText(RowData->Source);
+        }
+        else if (ColumnName == ColumnSent)
+        {
+            Text = FText::AsMemory(RowData->RequestBytes);
+        }
+        else if (ColumnName == ColumnReceived)
+        {
+            Text = TAttribute<FText>::CreateLambda([RowData]()
+                {
+                    return RowData->CompletedTime > 0.0 ? FText::AsMemory(RowData->ResponseBytes) : FText::GetEmpty();
+                });
+        }
+        else if (ColumnName == ColumnTime)
+        {
+            Text = TAttribute<FText>::CreateLambda([RowData]()
+                {
+                    return FormatMilliseconds((RowData->IsFinished() ? RowData->GetEndTime() : FPlatformTime::Seconds()) - RowData->StartedTime);
+                });
+        }
+        else if (ColumnName == ColumnCaller)
+        {
+            Text = FText::FromString(RowData->Caller);
+        }
+
+        return SNew(STextBlock)
+            .Text(Text)
+            .ToolTipText(ColumnName == ColumnURL ? Text : TAttribute<FText>());
+    }
+
+private:
+
+    TSharedPtr<FHttpTrafficRow> Row;
+    TAttribute<double> ViewStart;
+    TAttribute<double> ViewEnd;
+};
+
+// =============================================================================
+// INSPECTOR
+// =============================================================================
+
+double FHttpTrafficRow::GetEndTime() const
+{
+    return FMath::Max(FMath::Max3(StartedTime, ResponseStartedTime, CompletedTime),
+        FMath::Max3(DispatchedTime, CallbackStartedTime, CallbackFinishedTime));
+}
+
+void SHttpTrafficInspector::Construct(const FArguments& InArgs)
+{
+    using namespace HttpTrafficInspectorDetail;
+
+    FHttpTrafficMonitor::Get().SetEnabled(true);
+
+    TSharedRef<SHorizontalBox> Legend = SNew(SHorizontalBox);
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)EPhase::Num; ++PhaseIndex)
+    {
+        Legend->AddSlot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(8.0f, 0.0f)
+            [
+                SNew(STextBlock)
+                .Text(GetPhaseName((EPhase)PhaseIndex))
+                .ColorAndOpacity(FSlateColor(PhaseColors[PhaseIndex]))
+            ];
+    }
+
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.0f)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("Clear", "Clear"))
+                .OnClicked(this, &SHttpTrafficInspector::OnClear)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(8.0f, 0.0f)
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([this]() { return bPaused ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                .OnCheckStateChanged_Lambda([this](ECheckBoxState State)
+                    {
+                        // Pausing stops recording, so a paused inspector costs nothing either
+                        bPaused = State == ECheckBoxState::Checked;
+                        FHttpTrafficMonitor::Get().SetEnabled(!bPaused);
+                    })
+                [
+                    SNew(STextBlock).Text(LOCTEXT("Pause", "Pause"))
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(1.0f)
+            .VAlign(VAlign_Center)
+            .Padding(8.0f, 0.0f)
+            [
+                SNew(STextBlock)
+                .Text(this, &SHttpTrafficInspector::GetSummaryText)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            [
+                Legend
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .FillHeight(1.0f)
+        [
+            SNew(SBorder)
+            .BorderImage(FAppStyle::GetBrush(TEXT("ToolPanel.GroupBorder")))
+            [
+                SAssignNew(ListView, SListView<TSharedPtr<FHttpTrafficRow>>)
+                .ListItemsSource(&Rows)
+                .SelectionMode(ESelectionMode::Single)
+                .OnGenerateRow(this, &SHttpTrafficInspector::OnGenerateRow)
+                .HeaderRow
+                (
+                    SNew(SHeaderRow)
+                    + SHeaderRow::Column(ColumnMethod).DefaultLabel(LOCTEXT("ColumnMethod", "Method")).FillWidth(0.05f)
+                    + SHeaderRow::Column(ColumnURL).DefaultLabel(LOCTEXT("ColumnURL", "URL")).FillWidth(0.25f)
+                    + SHeaderRow::Column(ColumnStatus).DefaultLabel(LOCTEXT("ColumnStatus", "Status")).FillWidth(0.07f)
+                    + SHeaderRow::Column(ColumnSource).DefaultLabel(LOCTEXT("ColumnSource", "Source")).FillWidth(0.06f)
+                    + SHeaderRow::Column(ColumnSent).DefaultLabel(LOCTEXT("ColumnSent", "Sent")).FillWidth(0.05f)
+                    + SHeaderRow::Column(ColumnReceived).DefaultLabel(LOCTEXT("ColumnReceived", "Received")).FillWidth(0.05f)
+                    + SHeaderRow::Column(ColumnTime).DefaultLabel(LOCTEXT("ColumnTime", "Time")).FillWidth(0.05f)
+                    + SHeaderRow::Column(ColumnCaller).DefaultLabel(LOCTEXT("ColumnCaller", "Caller")).FillWidth(0.14f)
+                    + SHeaderRow::Column(ColumnWaterfall).DefaultLabel(LOCTEXT("ColumnWaterfall", "Waterfall")).FillWidth(0.28f)
+                )
+            ]
+        ]
+    ];
+
+    RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &SHttpTrafficInspector::Refresh));
+}
+
+SHttpTrafficInspector::~SHttpTrafficInspector()
+{
+    FHttpTrafficMonitor::Get().SetEnabled(false);
+}
+
+EActiveTimerReturnType SHttpTrafficInspector::Refresh(double InCurrentTime, float InDeltaTime)
+{
+    DrainedEvents.Reset();
+    bool bRowsChanged = FHttpTrafficMonitor::Get().Drain(DrainedEvents) > 0;
+    for (FHttpTrafficEvent& Event : DrainedEvents)
+    {
+        ApplyEvent(Event);
+    }
+
+    // Idle rows age out even when no events arrive
+    bRowsChanged |= EvictRows(FPlatformTime::Seconds());
+
+    if (bRowsChanged)
+    {
+        ListView->RequestListRefresh();
+    }
+
+    // The waterfall spans every listed request, up to now while any of them is running
+    ViewStart = Rows.Num() > 0 ? Rows[0]->StartedTime : 0.0;
+    ViewEnd = ViewStart;
+    for (const TSharedPtr<FHttpTrafficRow>& Row : Rows)
+    {
+        ViewEnd = FMath::Max(ViewEnd, Row->IsFinished() ? Row->GetEndTime() : FPlatformTime::Seconds());
+    }
+
+    return EActiveTimerReturnType::Continue;
+}
+
+bool SHttpTrafficInspector::EvictRows(double Now)
+{
+    const int32 NumBefore = Rows.Num();
+
+    // Rows are in start order: drop idle unfinished rows, and the oldest finished ones while over the limit
+    int32 Excess = Rows.Num() - MaxRows;
+    Rows.RemoveAll([this, Now, &Excess](const TSharedPtr<FHttpTrafficRow>& Row)
+        {
+            const bool bIdle = !Row->IsFinished() && Now - Row->GetEndTime() > MaxIdleRowSeconds;
+            if (!bIdle && (Excess <= 0 || !Row->IsFinished()))
+            {
+                return false;
+            }
+            --Excess;
+            RowsById.Remove(Row->RequestId);
+            return true;
+        });
+
+    // Still over with only live requests left: drop the oldest of them too
+    if (Excess > 0)
+    {
+        for (int32 Index = 0; Index < Excess; ++Index)
+        {
+            RowsById.Remove(Rows[Index]->RequestId);
+        }
+        Rows.RemoveAt(0, Excess);
+    }
+
+    return Rows.Num() != NumBefore;
+}
+
+void SHttpTrafficInspector::ApplyEvent(FHttpTrafficEvent& Event)
+{
+    if (Event.Type == EHttpTrafficEventType::Started)
+    {
+        TSharedPtr<FHttpTrafficRow> Row = MakeShared<FHttpTrafficRow>();
+        Row->RequestId = Event.RequestId;
+        Row->Method = MoveTemp(Event.Method);
+        Row->URL = MoveTemp(Event.URL);
+        Row->Caller = MoveTemp(Event.Caller);
+        Row->Source = Event.Source;
+        Row->RequestBytes = Event.RequestBytes;
+        Row->StartedTime = Event.TimeSeconds;
+        Rows.Add(Row);
+        RowsById.Add(Row->RequestId, Row);
+        return;
+    }
+
+    // Requests started before the inspector was opened are not shown
+    TSharedPtr<FHttpTrafficRow>* Found = RowsById.Find(Event.RequestId);
+    if (!Found)
+    {
+        return;
+    }
+
+    FHttpTrafficRow& Row = **Found;
+    switch (Event.Type)
+    {
+    case EHttpTrafficEventType::ResponseStarted:
+        Row.ResponseStartedTime = Event.TimeSeconds;
+        break;
+    case EHttpTrafficEventType::Completed:
+        Row.CompletedTime = Event.TimeSeconds;
+        Row.ResponseCode = Event.ResponseCode;
+        Row.ResponseBytes = Event.ResponseBytes;
+        Row.ErrorKind = Event.ErrorKind;
+        break;
+    case EHttpTrafficEventType::Dispatched:
+        Row.DispatchedTime = Event.TimeSeconds;
+        break;
+    case EHttpTrafficEventType::CallbackStarted:
+        Row.CallbackStartedTime = Event.TimeSeconds;
+        break;
+    case EHttpTrafficEventType::CallbackFinished:
+        Row.CallbackFinishedTime = Event.TimeSeconds;
+        break;
+    default:
+        break;
+    }
+}
+
+TSharedRef<ITableRow> SHttpTrafficInspector::OnGenerateRow(TSharedPtr<FHttpTrafficRow> Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    return SNew(SHttpTrafficRowWidget, OwnerTable)
+        .Row(Row)
+        .ViewStart(this, &SHttpTrafficInspector::GetViewStart)
+        .ViewEnd(this, &SHttpTrafficInspector::GetViewEnd);
+}
+
+FReply SHttpTrafficInspector::OnClear()
+{
+    Rows.Reset();
+    RowsById.Reset();
+    ListView->RequestListRefresh();
+    return FReply::Handled();
+}
+
+FText SHttpTrafficInspector::GetSummaryText() const
+{
+    int32 NumLive = 0;
+    for (const TSharedPtr<FHttpTrafficRow>& Row : Rows)
+    {
+        NumLive += Row->IsFinished() ? 0 : 1;
+    }
+    return FText::Format(LOCTEXT("Summary", "{0} requests, {1} in progress, {2} events dropped"),
+        Rows.Num(), NumLive, FText::AsNumber(FHttpTrafficMonitor::Get().GetNumDropped()));
+}
+
+#undef LOCTEXT_NAMESPACE
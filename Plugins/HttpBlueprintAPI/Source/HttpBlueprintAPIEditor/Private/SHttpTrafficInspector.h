@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "HttpTrafficMonitor.h"
+
+/** One request as shown by the inspector, assembled from its traffic events */
+struct FHttpTrafficRow
+{
+    uint32 RequestId = 0;
+    FString Method;
+    FString URL;
+    FString Caller;
+    EHttpTrafficSource Source = EHttpTrafficSource::Network;
+    int64 RequestBytes = 0;
+    int64 ResponseBytes = 0;
+    int32 ResponseCode = 0;
+    EHttpErrorKind ErrorKind = EHttpErrorKind::None;
+
+    /** FPlatformTime::Seconds() of each event, 0 until it happens */
+    double StartedTime = 0.0;
+    double ResponseStartedTime = 0.0;
+    double CompletedTime = 0.0;
+    double DispatchedTime = 0.0;
+    double CallbackStartedTime = 0.0;
+    double CallbackFinishedTime = 0.0;
+
+    bool IsFinished() const { return CallbackFinishedTime > 0.0; }
+
+    /** Time of the last event so far */
+    double GetEndTime() const;
+};
+
+/**
+ * Editor tab listing live and recent HTTP Blueprint API requests with a timing waterfall
+ *
+ * Events are only recorded while the tab is open; they are drained from the
+ * FHttpTrafficMonitor ring a few times per second on the game thread.
+ */
+class SHttpTrafficInspector : public SCompoundWidget
+{
+public:
+
+    SLATE_BEGIN_ARGS(SHttpTrafficInspector) {}
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+    virtual ~SHttpTrafficInspector() override;
+
+    /** Time span covered by the waterfall column */
+    double GetViewStart() const { return ViewStart; }
+    double GetViewEnd() const { return ViewEnd; }
+
+private:
+
+    EActiveTimerReturnType Refresh(double InCurrentTime, float InDeltaTime);
+
+    void ApplyEvent(FHttpTrafficEvent& Event);
+
+    /**
+     * Drop rows beyond MaxRows, oldest finished ones first, and unfinished rows idle for MaxIdleRowSeconds
+     *
+     * @return Whether any row was removed
+     */
+    bool EvictRows(double Now);
+
+    TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FHttpTrafficRow> Row, const TSharedRef<STableViewBase>& OwnerTable);
+
+    FReply OnClear();
+
+    FText GetSummaryText() const;
+
+    /** Rows kept once requests start being evicted */
+    static constexpr int32 MaxRows = 1000;
+
+    /** Unfinished rows with no event for this long are dropped; their remaining events were lost to a full ring or never come */
+    static constexpr double MaxIdleRowSeconds = 300.0;
+
+    TArray<TSharedPtr<FHttpTrafficRow>> Rows;
+    TMap<uint32, TSharedPtr<FHttpTrafficRow>> RowsById;
+    TSharedPtr<SListView<TSharedPtr<FHttpTrafficRow>>> ListView;
+
+    /** Reused between refreshes */
+    TArray<FHttpTrafficEvent> DrainedEvents;
+
+    double ViewStart = 0.0;
+    double ViewEnd = 0.0;
+    bool bPaused = false;
+};